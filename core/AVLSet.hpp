@@ -16,6 +16,7 @@
 #ifndef AVLSET_HPP
 #define AVLSET_HPP
 
+#include "BatchLookup.hpp"
 #include "Set.hpp"
 #include <algorithm>
 #include <stdlib.h>
@@ -61,6 +62,12 @@ public:
     virtual bool contains(const T& element) const;
 
 
+    // containsBatch() looks up all of the given elements, interleaving
+    // their walks down the tree so that one's cache misses overlap the
+    // others'.
+    virtual void containsBatch(const T* elements, unsigned int count, bool* found) const;
+
+
     // size() returns the number of elements in the set.
     virtual unsigned int size() const;
 
@@ -577,6 +584,13 @@ bool AVLSet<T>::contains(const T& element) const
 }
 
 
+template <typename T>
+void AVLSet<T>::containsBatch(const T* elements, unsigned int count, bool* found) const
+{
+    BatchLookup::searchTree(root, elements, count, found);
+}
+
+
 template <typename T>
 unsigned int AVLSet<T>::size() const
 {
@@ -0,0 +1,272 @@
+// BKTree.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <utility>
+#include "BKTree.hpp"
+#include "EditDistance.hpp"
+
+
+
+BKTree::BKTreeException::BKTreeException(const std::string& reason)
+    : reason_{reason}
+{
+}
+
+
+std::string BKTree::BKTreeException::reason() const
+{
+    return reason_;
+}
+
+
+
+BKTree::BKTree(unsigned int maxDistance)
+    : maxDistance_{maxDistance}, finished{false}
+{
+    if (maxDistance == 0)
+    {
+        throw BKTreeException{"The distance for a BKTree must be at least 1"};
+    }
+}
+
+
+void BKTree::addWord(const std::string& word)
+{
+    if (finished)
+    {
+        throw BKTreeException{"Cannot add a word to a BKTree that has been finished"};
+    }
+
+    std::uint32_t parent = 0;
+    std::uint16_t label = 0;
+
+    if (!nodes.empty())
+    {
+        // Descend along the children labeled with the word's distance from
+        // each node, until there's no such child; the word becomes one.
+        for (std::uint32_t n = 0; ; )
+        {
+            std::string_view existing = wordAt(nodes[n]);
+
+            unsigned int distance = EditDistance::levenshtein(
+                word, existing, std::max(word.size(), existing.size()));
+
+            if (distance == 0)
+            {
+                return;
+            }
+
+            std::uint32_t child = nodes[n].firstChild;
+
+            while (child != 0 && nodes[child].label != distance)
+            {
+                child = nodes[child].nextSibling;
+            }
+
+            if (child == 0)
+            {
+                parent = n;
+                label = distance;
+                break;
+            }
+
+            n = child;
+        }
+    }
+
+    Node node;
+    node.start = arena.size();
+    node.length = word.size();
+    node.firstChild = 0;
+    node.childCount = 0;
+    node.label = label;
+    node.nextSibling = 0;
+
+    arena.insert(arena.end(), word.begin(), word.end());
+
+    if (!nodes.empty())
+    {
+        node.nextSibling = nodes[parent].firstChild;
+        nodes[parent].firstChild = nodes.size();
+        ++nodes[parent].childCount;
+    }
+
+    nodes.push_back(node);
+}
+
+
+void BKTree::finish()
+{
+    if (finished)
+    {
+        return;
+    }
+
+    finished = true;
+
+    if (nodes.empty())
+    {
+        return;
+    }
+
+    // Breadth-first, so that the nodes are laid out in the same order they
+    // come out of the queue: node i of the new layout is queue[i] in the
+    // old one, and its children are appended together as it's reached.
+    std::vector<Node> laidOut;
+    laidOut.reserve(nodes.size());
+
+    std::vector<std::uint32_t> queue{0};
+    laidOut.push_back(nodes[0]);
+
+    std::vector<std::uint32_t> children;
+
+    for (std::vector<std::uint32_t>::size_type i = 0; i < queue.size(); ++i)
+    {
+        children.clear();
+
+        for (std::uint32_t c = nodes[queue[i]].firstChild; c != 0; c = nodes[c].nextSibling)
+        {
+            children.push_back(c);
+        }
+
+        std::sort(
+            children.begin(), children.end(),
+            [this](std::uint32_t a, std::uint32_t b)
+            {
+                return nodes[a].label < nodes[b].label;
+            });
+
+        laidOut[i].firstChild = laidOut.size();
+        laidOut[i].nextSibling = 0;
+
+        for (std::uint32_t c : children)
+        {
+            queue.push_back(c);
+            laidOut.push_back(nodes[c]);
+        }
+    }
+
+    nodes = std::move(laidOut);
+    arena.shrink_to_fit();
+}
+
+
+std::vector<std::string> BKTree::findSuggestions(const std::string& word) const
+{
+    return findWithin(word, maxDistance_);
+}
+
+
+std::size_t BKTree::memoryUsage() const
+{
+    return arena.capacity() * sizeof(char) + nodes.capacity() * sizeof(Node);
+}
+
+
+std::vector<std::string> BKTree::findWithin(
+    const std::string& word, unsigned int maxDistance, std::size_t& visited) const
+{
+    visited = 0;
+
+    std::vector<std::string> suggestions;
+
+    if (!finished || nodes.empty())
+    {
+        return suggestions;
+    }
+
+    std::vector<std::pair<unsigned int, std::uint32_t>> found;
+
+    thread_local std::vector<std::uint32_t> pending;
+    pending.assign(1, 0);
+
+    while (!pending.empty())
+    {
+        std::uint32_t n = pending.back();
+        pending.pop_back();
+
+        const Node& node = nodes[n];
+
+        // A distance more than k past the largest label rules out every
+        // child, so that's as far as it needs to be measured.
+        unsigned int largestLabel = node.childCount > 0
+            ? nodes[node.firstChild + node.childCount - 1].label : 0;
+
+        unsigned int distance = EditDistance::levenshtein(
+            word, wordAt(node), maxDistance + largestLabel);
+
+        ++visited;
+
+        if (distance <= maxDistance)
+        {
+            found.emplace_back(distance, n);
+        }
+
+        unsigned int lowest = distance > maxDistance ? distance - maxDistance : 0;
+        unsigned int highest = distance + maxDistance;
+
+        for (std::uint32_t c = node.firstChild; c < node.firstChild + node.childCount; ++c)
+        {
+            if (nodes[c].label > highest)
+            {
+                break;
+            }
+            else if (nodes[c].label >= lowest)
+            {
+                pending.push_back(c);
+            }
+        }
+    }
+
+    std::sort(
+        found.begin(), found.end(),
+        [this](const std::pair<unsigned int, std::uint32_t>& a, const std::pair<unsigned int, std::uint32_t>& b)
+        {
+            return a.first != b.first
+                ? a.first < b.first
+                : wordAt(nodes[a.second]) < wordAt(nodes[b.second]);
+        });
+
+    suggestions.reserve(found.size());
+
+    for (const std::pair<unsigned int, std::uint32_t>& f : found)
+    {
+        suggestions.emplace_back(wordAt(nodes[f.second]));
+    }
+
+    return suggestions;
+}
+
+
+std::vector<std::string> BKTree::findWithin(const std::string& word, unsigned int maxDistance) const
+{
+    std::size_t visited;
+    return findWithin(word, maxDistance, visited);
+}
+
+
+unsigned int BKTree::maxDistance() const
+{
+    return maxDistance_;
+}
+
+
+std::size_t BKTree::wordCount() const
+{
+    return nodes.size();
+}
+
+
+bool BKTree::isFinished() const
+{
+    return finished;
+}
+
+
+std::string_view BKTree::wordAt(const Node& node) const
+{
+    return std::string_view{arena.data() + node.start, node.length};
+}
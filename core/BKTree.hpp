@@ -0,0 +1,145 @@
+// BKTree.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A BKTree (Burkhard-Keller tree) is a SuggestionStrategy that finds every
+// dictionary word within some Levenshtein distance of a misspelled word,
+// by organizing the words according to their distances from one another.
+// Each node holds a word, and each of its children is labeled with a
+// distance d: every word in that child's subtree is exactly d from the
+// node's word.
+//
+// Searching for the words within k of a query q starts by measuring the
+// distance d from q to the root's word.  By the triangle inequality, a
+// word w that is exactly e from the root's word is at least |d - e| from
+// q, so only the children labeled d - k through d + k can hold anything
+// within k of q; the rest are skipped, along with everything beneath them.
+// The same reasoning applies at every node visited.  The smaller k is,
+// the more is skipped; for k = 1, only a few percent of a large dictionary
+// is visited.
+//
+// The triangle inequality is essential here, which is why the distance is
+// Levenshtein distance, where swapping two adjacent characters counts as
+// two edits (a deletion and an insertion), rather than the swap-aware
+// distance used elsewhere, which doesn't obey it.  So a BKTree searching
+// within distance 1 won't suggest words that differ from the misspelling
+// by a swap; one searching within distance 2 will.
+//
+// Measuring the distance to each node visited dominates the cost of a
+// search, but it only needs to be known exactly up to the largest label
+// of the node's children plus k, which lets the distance calculation give
+// up early on nodes far from the query.
+//
+// Words are added one at a time, each one descending from the root along
+// the children labeled with its distances until it finds a place of its
+// own.  Once every word has been added, finish() lays the nodes out again
+// in breadth-first order, with each node's children together and sorted
+// by label, so that a search reads the children it needs from one place.
+
+#ifndef BKTREE_HPP
+#define BKTREE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "SuggestionStrategy.hpp"
+
+
+
+class BKTree : public SuggestionStrategy
+{
+public:
+    // A BKTreeException is thrown when a tree is asked to search within a
+    // distance of 0, or when a word is added after it has been finished.
+    class BKTreeException
+    {
+    public:
+        BKTreeException(const std::string& reason);
+
+        std::string reason() const;
+
+    private:
+        std::string reason_;
+    };
+
+
+public:
+    // Initializes an empty BKTree whose findSuggestions() will find the
+    // words within the given Levenshtein distance (at least 1).
+    explicit BKTree(unsigned int maxDistance = 2);
+
+
+    // addWord() adds a dictionary word to the tree.  It throws a
+    // BKTreeException if the tree has already been finished.
+    virtual void addWord(const std::string& word);
+
+
+    // finish() lays the tree out for searching, after which no more words
+    // can be added.  Calling finish() on a tree that has already been
+    // finished has no effect.
+    virtual void finish();
+
+
+    // findSuggestions() returns findWithin(word, maxDistance()).
+    virtual std::vector<std::string> findSuggestions(const std::string& word) const;
+
+
+    // memoryUsage() returns the number of bytes taken up by the words and
+    // the nodes.
+    virtual std::size_t memoryUsage() const;
+
+
+    // findWithin() returns every word within the given Levenshtein distance
+    // of the given word (including the word itself, if it's in the tree),
+    // closest first, with ties in sorted order.  The number of nodes whose
+    // distance had to be measured is stored into visited.  A tree that
+    // hasn't been finished finds nothing.
+    std::vector<std::string> findWithin(
+        const std::string& word, unsigned int maxDistance, std::size_t& visited) const;
+
+    std::vector<std::string> findWithin(const std::string& word, unsigned int maxDistance) const;
+
+
+    unsigned int maxDistance() const;
+
+    // wordCount() returns the number of distinct words in the tree.
+    std::size_t wordCount() const;
+
+    bool isFinished() const;
+
+
+private:
+    // Until the tree is finished, each node's children are linked through
+    // nextSibling, starting at firstChild; 0 ends the list, since the root
+    // is never anyone's child.  Once it's finished, a node's children are
+    // nodes[firstChild] up to but not including
+    // nodes[firstChild + childCount], in order of their labels.
+    struct Node
+    {
+        std::uint32_t start;
+        std::uint32_t firstChild;
+        std::uint32_t nextSibling;
+        std::uint16_t length;
+        std::uint16_t childCount;
+        std::uint16_t label;
+    };
+
+
+    unsigned int maxDistance_;
+
+    std::vector<char> arena;
+    std::vector<Node> nodes;
+
+    bool finished;
+
+
+private:
+    std::string_view wordAt(const Node& node) const;
+};
+
+
+
+#endif // BKTREE_HPP
@@ -16,6 +16,7 @@
 #ifndef BSTSET_HPP
 #define BSTSET_HPP
 
+#include "BatchLookup.hpp"
 #include "Set.hpp"
 
 
@@ -63,6 +64,12 @@ public:
     virtual bool contains(const T& element) const;
 
 
+    // containsBatch() looks up all of the given elements, interleaving
+    // their walks down the tree so that one's cache misses overlap the
+    // others'.
+    virtual void containsBatch(const T* elements, unsigned int count, bool* found) const;
+
+
     // size() returns the number of elements in the set.
     virtual unsigned int size() const;
 
@@ -224,6 +231,13 @@ bool BSTSet<T>::contains(const T& element) const
 
 
 
+template <typename T>
+void BSTSet<T>::containsBatch(const T* elements, unsigned int count, bool* found) const
+{
+    BatchLookup::searchTree(root, elements, count, found);
+}
+
+
 template <typename T>
 unsigned int BSTSet<T>::size() const
 {
@@ -0,0 +1,101 @@
+// BatchLookup.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Support for the sets' containsBatch() overrides.  Looking up one element
+// at a time, each step of a lookup waits for the memory it needs before
+// the next can start, so a lookup that misses the cache a few times spends
+// most of its time waiting.  Lookups of different elements don't depend on
+// one another, though, so a batch of them can be interleaved: each takes a
+// step, prefetching the memory its next step will need, and then waits
+// its turn while the others take theirs, by which time that memory has
+// usually arrived.  Up to groupSize lookups are kept in flight at once,
+// which is about as many outstanding cache misses as a core can track.
+
+#ifndef BATCHLOOKUP_HPP
+#define BATCHLOOKUP_HPP
+
+#include <algorithm>
+
+
+
+namespace BatchLookup
+{
+    constexpr unsigned int groupSize = 16;
+
+
+    // prefetch() asks for the cache line holding the given address to be
+    // loaded, without waiting for it.
+    inline void prefetch(const void* p)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(p);
+#endif
+    }
+
+
+    // searchTree() looks up count elements in the binary search tree with
+    // the given root, setting found[i] to whether elements[i] is in it, in
+    // groups of up to groupSize interleaved lookups.  Node can be any type
+    // with data, left, and right members.
+    template <typename Node, typename T>
+    void searchTree(const Node* root, const T* elements, unsigned int count, bool* found)
+    {
+        for (unsigned int start = 0; start < count; start += groupSize)
+        {
+            unsigned int groupCount = std::min(groupSize, count - start);
+
+            // at[i] is where the group's lookup i is, and the first
+            // activeCount entries of active are the lookups that are
+            // still going.
+            const Node* at[groupSize];
+            unsigned int active[groupSize];
+            unsigned int activeCount = 0;
+
+            for (unsigned int i = 0; i < groupCount; ++i)
+            {
+                found[start + i] = false;
+
+                if (root != nullptr)
+                {
+                    at[i] = root;
+                    active[activeCount++] = i;
+                }
+            }
+
+            while (activeCount > 0)
+            {
+                unsigned int stillActive = 0;
+
+                for (unsigned int a = 0; a < activeCount; ++a)
+                {
+                    unsigned int i = active[a];
+                    const Node* node = at[i];
+                    const T& element = elements[start + i];
+
+                    if (element == node->data)
+                    {
+                        found[start + i] = true;
+                        continue;
+                    }
+
+                    node = element < node->data ? node->left : node->right;
+
+                    if (node != nullptr)
+                    {
+                        prefetch(node);
+                        at[i] = node;
+                        active[stillActive++] = i;
+                    }
+                }
+
+                activeCount = stillActive;
+            }
+        }
+    }
+}
+
+
+
+#endif // BATCHLOOKUP_HPP
@@ -0,0 +1,274 @@
+// BinaryFuseFilter.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A BinaryFuseFilter is a MembershipFilter that is a (3-wise) binary fuse
+// filter, a refinement of the xor filter.  It is an array of small
+// fingerprints, arranged so that, for every element it was built from,
+// the fingerprints at three positions determined by the element's hash,
+// xor'ed together, equal a fingerprint computed from the hash itself.  A
+// lookup reads those three positions and compares; for an element that
+// wasn't among them, the xor is effectively random, so it matches with
+// probability 1 in 2^(bits in a fingerprint).
+//
+// Building one means finding an order in which to assign the fingerprints
+// so that each element has a position nothing assigned later will touch.
+// This is done by "peeling": repeatedly removing an element that is alone
+// at one of its positions, until none are left.  The array is divided into
+// segments, and each element's three positions lie in three consecutive
+// segments, which makes peeling succeed with an array only about 12.5%
+// larger than the number of elements (rather than the xor filter's 23%).
+// If peeling gets stuck, the hashes are reseeded and it starts over; this
+// rarely happens more than once or twice.
+//
+// With 8-bit fingerprints, the filter takes about 9 bits per element and
+// has a false positive rate of about 0.4%; with 16-bit ones, twice the
+// space and a rate of about 0.0015%.  Unlike a Bloom filter, it can't have
+// elements added once it has been built.
+
+#ifndef BINARYFUSEFILTER_HPP
+#define BINARYFUSEFILTER_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Hashing.hpp"
+#include "MembershipFilter.hpp"
+
+
+
+template <typename Fingerprint>
+class BinaryFuseFilter : public MembershipFilter
+{
+public:
+    // Builds a BinaryFuseFilter containing the elements with the given
+    // hashes.  Repeated hashes are fine; they're only stored once.
+    BinaryFuseFilter(const std::vector<std::uint64_t>& hashes);
+
+
+    virtual bool mightContain(std::uint64_t hash) const;
+
+    virtual std::size_t memoryUsage() const;
+
+
+    // attemptCount() returns how many seeds were tried before peeling
+    // succeeded.
+    unsigned int attemptCount() const;
+
+
+private:
+    std::vector<Fingerprint> fingerprints;
+
+    std::uint64_t seed;
+    std::uint32_t segmentLength;
+    std::uint32_t segmentLengthMask;
+    std::uint32_t segmentCountLength;
+
+    unsigned int attempts;
+
+
+private:
+    static Fingerprint fingerprintOf(std::uint64_t mixed);
+
+    void positionsOf(std::uint64_t mixed, std::uint32_t positions[3]) const;
+    bool peel(
+        const std::vector<std::uint64_t>& keys,
+        std::vector<std::uint64_t>& order, std::vector<std::uint8_t>& orderPositions) const;
+};
+
+
+
+template <typename Fingerprint>
+BinaryFuseFilter<Fingerprint>::BinaryFuseFilter(const std::vector<std::uint64_t>& hashes)
+    : seed{0}, attempts{0}
+{
+    std::vector<std::uint64_t> keys = hashes;
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    // These sizes are the ones recommended by the filter's designers; the
+    // segments get longer (and the array relatively smaller) as the number
+    // of elements grows.
+    std::size_t size = keys.size();
+
+    segmentLength = size == 0
+        ? 4
+        : std::uint32_t{1} << static_cast<int>(std::floor(std::log(double(size)) / std::log(3.33) + 2.25));
+
+    segmentLength = std::min(segmentLength, std::uint32_t{262144});
+    segmentLengthMask = segmentLength - 1;
+
+    double sizeFactor = size <= 1
+        ? 0.0
+        : std::max(1.125, 0.875 + 0.25 * std::log(1000000.0) / std::log(double(size)));
+
+    std::size_t capacity = static_cast<std::size_t>(std::round(size * sizeFactor));
+    std::size_t segmentCount = (capacity + segmentLength - 1) / segmentLength;
+    segmentCount = segmentCount > 2 ? segmentCount - 2 : 1;
+
+    segmentCountLength = segmentCount * segmentLength;
+    fingerprints.assign((segmentCount + 2) * segmentLength, 0);
+
+    // Peeling fails only when the hashes happen to put too many elements
+    // at the same positions, so a new seed (chosen by splitmix64) soon
+    // finds an order that works.
+    std::vector<std::uint64_t> order;
+    std::vector<std::uint8_t> orderPositions;
+    std::uint64_t state = 0x726b2b9d438b9d4dull;
+
+    do
+    {
+        state += 0x9e3779b97f4a7c15ull;
+        seed = Hashing::mix64(state);
+        ++attempts;
+    }
+    while (!peel(keys, order, orderPositions));
+
+    // Each element, in the reverse of the order it was peeled, is given the
+    // one position that nothing assigned after it will touch.
+    for (std::size_t i = order.size(); i-- > 0; )
+    {
+        std::uint32_t positions[3];
+        positionsOf(order[i], positions);
+
+        std::uint8_t alone = orderPositions[i];
+
+        fingerprints[positions[alone]] = fingerprintOf(order[i])
+            ^ fingerprints[positions[(alone + 1) % 3]]
+            ^ fingerprints[positions[(alone + 2) % 3]];
+    }
+}
+
+
+template <typename Fingerprint>
+bool BinaryFuseFilter<Fingerprint>::mightContain(std::uint64_t hash) const
+{
+    std::uint64_t mixed = Hashing::mix64(hash + seed);
+
+    std::uint32_t positions[3];
+    positionsOf(mixed, positions);
+
+    Fingerprint f = fingerprintOf(mixed)
+        ^ fingerprints[positions[0]] ^ fingerprints[positions[1]] ^ fingerprints[positions[2]];
+
+    return f == 0;
+}
+
+
+template <typename Fingerprint>
+std::size_t BinaryFuseFilter<Fingerprint>::memoryUsage() const
+{
+    return fingerprints.size() * sizeof(Fingerprint);
+}
+
+
+template <typename Fingerprint>
+unsigned int BinaryFuseFilter<Fingerprint>::attemptCount() const
+{
+    return attempts;
+}
+
+
+template <typename Fingerprint>
+Fingerprint BinaryFuseFilter<Fingerprint>::fingerprintOf(std::uint64_t mixed)
+{
+    return static_cast<Fingerprint>(mixed ^ (mixed >> 32));
+}
+
+
+template <typename Fingerprint>
+void BinaryFuseFilter<Fingerprint>::positionsOf(std::uint64_t mixed, std::uint32_t positions[3]) const
+{
+    // The high bits of the hash choose the first position, anywhere but in
+    // the last two segments (scaled into range with a multiplication, not
+    // a division); the other two are at the same offset in the next two
+    // segments, with some low bits of the hash flipped.
+    positions[0] = static_cast<std::uint32_t>(
+        (static_cast<unsigned __int128>(mixed) * segmentCountLength) >> 64);
+
+    positions[1] = (positions[0] + segmentLength) ^ (static_cast<std::uint32_t>(mixed >> 18) & segmentLengthMask);
+    positions[2] = (positions[0] + 2 * segmentLength) ^ (static_cast<std::uint32_t>(mixed) & segmentLengthMask);
+}
+
+
+template <typename Fingerprint>
+bool BinaryFuseFilter<Fingerprint>::peel(
+    const std::vector<std::uint64_t>& keys,
+    std::vector<std::uint64_t>& order, std::vector<std::uint8_t>& orderPositions) const
+{
+    // For each position: how many elements are there, and the xor of their
+    // mixed hashes, which is the hash of the element itself when only one
+    // is left.
+    std::vector<std::uint32_t> counts(fingerprints.size(), 0);
+    std::vector<std::uint64_t> xors(fingerprints.size(), 0);
+
+    for (std::uint64_t key : keys)
+    {
+        std::uint64_t mixed = Hashing::mix64(key + seed);
+
+        std::uint32_t positions[3];
+        positionsOf(mixed, positions);
+
+        for (std::uint32_t position : positions)
+        {
+            ++counts[position];
+            xors[position] ^= mixed;
+        }
+    }
+
+    std::vector<std::uint32_t> alone;
+
+    for (std::uint32_t position = 0; position < counts.size(); ++position)
+    {
+        if (counts[position] == 1)
+        {
+            alone.push_back(position);
+        }
+    }
+
+    order.clear();
+    orderPositions.clear();
+
+    while (!alone.empty())
+    {
+        std::uint32_t position = alone.back();
+        alone.pop_back();
+
+        // It may have lost its last element since it was queued.
+        if (counts[position] != 1)
+        {
+            continue;
+        }
+
+        std::uint64_t mixed = xors[position];
+
+        std::uint32_t positions[3];
+        positionsOf(mixed, positions);
+
+        for (std::uint8_t i = 0; i < 3; ++i)
+        {
+            if (positions[i] == position)
+            {
+                order.push_back(mixed);
+                orderPositions.push_back(i);
+            }
+
+            --counts[positions[i]];
+            xors[positions[i]] ^= mixed;
+
+            if (counts[positions[i]] == 1)
+            {
+                alone.push_back(positions[i]);
+            }
+        }
+    }
+
+    return order.size() == keys.size();
+}
+
+
+
+#endif // BINARYFUSEFILTER_HPP
@@ -0,0 +1,355 @@
+// BitParallelDistance.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include "BitParallelDistance.hpp"
+#include "EditDistance.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define BITPARALLEL_AVX2 1
+#include <immintrin.h>
+#endif
+
+
+
+namespace
+{
+    // Compares the pattern with s one character of s at a time, as
+    // described in BitParallelDistance.hpp.  Bit i of the column vectors
+    // is about row i + 1 of the table (the first i + 1 characters of the
+    // pattern): vp and vn are set where the entry is one more or one less
+    // than the one above it, and d0 where it's the same as the entry
+    // diagonally up and to the left.  The distance is the entry in the
+    // last row, which is tracked as the column advances.
+    template <bool withSwaps>
+    unsigned int scalarDistance(const BitParallelDistance::Pattern& pattern, std::string_view s)
+    {
+        const std::string::size_type m = pattern.length();
+
+        if (m == 0)
+        {
+            return s.size();
+        }
+        else if (m > BitParallelDistance::maxPatternLength)
+        {
+            unsigned int limit = std::max(m, s.size());
+
+            return withSwaps
+                ? EditDistance::distance(pattern.text(), s, limit)
+                : EditDistance::levenshtein(pattern.text(), s, limit);
+        }
+
+        const std::uint64_t last = std::uint64_t{1} << (m - 1);
+
+        std::uint64_t vp = ~std::uint64_t{0};
+        std::uint64_t vn = 0;
+        std::uint64_t d0 = 0;
+        std::uint64_t previousEq = 0;
+        unsigned int score = m;
+
+        for (char c : s)
+        {
+            const std::uint64_t eq = pattern.mask(c);
+            std::uint64_t d = (((eq & vp) + vp) ^ vp) | eq | vn;
+
+            if (withSwaps)
+            {
+                // A swap makes an entry the same as the one two rows up
+                // and two columns left, where the characters match crosswise
+                // and the entry in between didn't already match.
+                d |= ((~d0 & eq) << 1) & previousEq;
+                d0 = d;
+                previousEq = eq;
+            }
+
+            std::uint64_t hp = vn | ~(d | vp);
+            std::uint64_t hn = vp & d;
+
+            score += (hp & last) != 0;
+            score -= (hn & last) != 0;
+
+            // The first row of the table counts up by one per column.
+            hp = (hp << 1) | 1;
+            hn = hn << 1;
+
+            vp = hn | ~(d | hp);
+            vn = hp & d;
+        }
+
+        return score;
+    }
+
+
+    template <bool withSwaps>
+    void scalarMany(
+        const BitParallelDistance::Pattern& pattern, const std::string_view* strings,
+        unsigned int count, unsigned int* distances)
+    {
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            distances[i] = scalarDistance<withSwaps>(pattern, strings[i]);
+        }
+    }
+
+
+#ifdef BITPARALLEL_AVX2
+#define AVX2_FUNCTION __attribute__((target("avx2")))
+
+    // Lanes<Lane> wraps the AVX2 operations on 256-bit registers divided
+    // into lanes of type Lane, so that the same algorithm can be written
+    // once for 16-bit and 32-bit lanes.
+    template <typename Lane>
+    struct Lanes;
+
+
+    template <>
+    struct Lanes<std::uint16_t>
+    {
+        static constexpr unsigned int count = 16;
+
+        AVX2_FUNCTION static __m256i set1(unsigned int x) { return _mm256_set1_epi16(static_cast<short>(x)); }
+        AVX2_FUNCTION static __m256i add(__m256i a, __m256i b) { return _mm256_add_epi16(a, b); }
+        AVX2_FUNCTION static __m256i sub(__m256i a, __m256i b) { return _mm256_sub_epi16(a, b); }
+        AVX2_FUNCTION static __m256i shiftLeft1(__m256i a) { return _mm256_slli_epi16(a, 1); }
+        AVX2_FUNCTION static __m256i equal(__m256i a, __m256i b) { return _mm256_cmpeq_epi16(a, b); }
+        AVX2_FUNCTION static __m256i greater(__m256i a, __m256i b) { return _mm256_cmpgt_epi16(a, b); }
+    };
+
+
+    template <>
+    struct Lanes<std::uint32_t>
+    {
+        static constexpr unsigned int count = 8;
+
+        AVX2_FUNCTION static __m256i set1(unsigned int x) { return _mm256_set1_epi32(static_cast<int>(x)); }
+        AVX2_FUNCTION static __m256i add(__m256i a, __m256i b) { return _mm256_add_epi32(a, b); }
+        AVX2_FUNCTION static __m256i sub(__m256i a, __m256i b) { return _mm256_sub_epi32(a, b); }
+        AVX2_FUNCTION static __m256i shiftLeft1(__m256i a) { return _mm256_slli_epi32(a, 1); }
+        AVX2_FUNCTION static __m256i equal(__m256i a, __m256i b) { return _mm256_cmpeq_epi32(a, b); }
+        AVX2_FUNCTION static __m256i greater(__m256i a, __m256i b) { return _mm256_cmpgt_epi32(a, b); }
+    };
+
+
+    // Strings longer than this are left to scalarDistance(), so that
+    // lengths and distances always fit in a signed lane of either width.
+    constexpr std::string::size_type longestLaneString = 30000;
+
+
+    // Compares the pattern with up to Lanes<Lane>::count strings at once,
+    // each lane of the registers holding the column for one of them; it's
+    // scalarDistance() with every operation done on all of the lanes.  A
+    // lane's distance stops changing once its string runs out, while the
+    // others carry on to the end of theirs.
+    template <typename Lane, bool withSwaps>
+    AVX2_FUNCTION void avx2Group(
+        const Lane* masks, unsigned int m, const std::string_view* strings, unsigned int n,
+        unsigned int* distances)
+    {
+        using L = Lanes<Lane>;
+
+        alignas(32) Lane eqs[L::count] = {};
+        alignas(32) Lane lengths[L::count] = {};
+        alignas(32) Lane scores[L::count];
+
+        std::string::size_type longest = 0;
+
+        for (unsigned int lane = 0; lane < n; ++lane)
+        {
+            lengths[lane] = static_cast<Lane>(strings[lane].size());
+            longest = std::max(longest, strings[lane].size());
+        }
+
+        const __m256i allOnes = _mm256_set1_epi32(-1);
+        const __m256i one = L::set1(1);
+        const __m256i last = L::set1(1u << (m - 1));
+        const __m256i stringLengths = _mm256_load_si256(reinterpret_cast<const __m256i*>(lengths));
+
+        __m256i vp = allOnes;
+        __m256i vn = _mm256_setzero_si256();
+        __m256i d0 = _mm256_setzero_si256();
+        __m256i previousEq = _mm256_setzero_si256();
+        __m256i score = L::set1(m);
+
+        for (std::string::size_type j = 0; j < longest; ++j)
+        {
+            for (unsigned int lane = 0; lane < n; ++lane)
+            {
+                eqs[lane] = j < strings[lane].size()
+                    ? masks[static_cast<unsigned char>(strings[lane][j])]
+                    : 0;
+            }
+
+            const __m256i eq = _mm256_load_si256(reinterpret_cast<const __m256i*>(eqs));
+
+            __m256i d = _mm256_or_si256(
+                _mm256_xor_si256(L::add(_mm256_and_si256(eq, vp), vp), vp),
+                _mm256_or_si256(eq, vn));
+
+            if (withSwaps)
+            {
+                d = _mm256_or_si256(
+                    d, _mm256_and_si256(L::shiftLeft1(_mm256_andnot_si256(d0, eq)), previousEq));
+                d0 = d;
+                previousEq = eq;
+            }
+
+            __m256i hp = _mm256_or_si256(vn, _mm256_andnot_si256(_mm256_or_si256(d, vp), allOnes));
+            __m256i hn = _mm256_and_si256(vp, d);
+
+            // Comparisons give all ones (-1) in the lanes where they hold,
+            // so subtracting the first and adding the second counts the
+            // last row up or down, in the lanes whose strings aren't done.
+            const __m256i active = L::greater(stringLengths, L::set1(j));
+            const __m256i up = _mm256_and_si256(active, L::equal(_mm256_and_si256(hp, last), last));
+            const __m256i down = _mm256_and_si256(active, L::equal(_mm256_and_si256(hn, last), last));
+            score = L::add(L::sub(score, up), down);
+
+            hp = _mm256_or_si256(L::shiftLeft1(hp), one);
+            hn = L::shiftLeft1(hn);
+
+            vp = _mm256_or_si256(hn, _mm256_andnot_si256(_mm256_or_si256(d, hp), allOnes));
+            vn = _mm256_and_si256(hp, d);
+        }
+
+        _mm256_store_si256(reinterpret_cast<__m256i*>(scores), score);
+
+        for (unsigned int lane = 0; lane < n; ++lane)
+        {
+            distances[lane] = scores[lane];
+        }
+    }
+
+
+    template <typename Lane, bool withSwaps>
+    void avx2Many(
+        const BitParallelDistance::Pattern& pattern, const std::string_view* strings,
+        unsigned int count, unsigned int* distances)
+    {
+        constexpr unsigned int laneCount = Lanes<Lane>::count;
+
+        Lane masks[256];
+
+        for (unsigned int c = 0; c < 256; ++c)
+        {
+            masks[c] = static_cast<Lane>(pattern.mask(static_cast<char>(c)));
+        }
+
+        for (unsigned int start = 0; start < count; start += laneCount)
+        {
+            unsigned int n = std::min(laneCount, count - start);
+
+            bool fits = std::all_of(
+                strings + start, strings + start + n,
+                [](std::string_view s) { return s.size() <= longestLaneString; });
+
+            if (fits)
+            {
+                avx2Group<Lane, withSwaps>(masks, pattern.length(), strings + start, n, distances + start);
+            }
+            else
+            {
+                scalarMany<withSwaps>(pattern, strings + start, n, distances + start);
+            }
+        }
+    }
+#endif
+
+
+    template <bool withSwaps>
+    void many(
+        const BitParallelDistance::Pattern& pattern, const std::string_view* strings,
+        unsigned int count, unsigned int* distances)
+    {
+#ifdef BITPARALLEL_AVX2
+        if (BitParallelDistance::usesAvx2() && pattern.length() > 0)
+        {
+            if (pattern.length() <= 16)
+            {
+                avx2Many<std::uint16_t, withSwaps>(pattern, strings, count, distances);
+                return;
+            }
+            else if (pattern.length() <= 32)
+            {
+                avx2Many<std::uint32_t, withSwaps>(pattern, strings, count, distances);
+                return;
+            }
+        }
+#endif
+
+        scalarMany<withSwaps>(pattern, strings, count, distances);
+    }
+}
+
+
+
+BitParallelDistance::Pattern::Pattern(std::string_view pattern)
+    : text_{pattern}, masks{}
+{
+    if (pattern.size() <= maxPatternLength)
+    {
+        for (std::string_view::size_type i = 0; i < pattern.size(); ++i)
+        {
+            masks[static_cast<unsigned char>(pattern[i])] |= std::uint64_t{1} << i;
+        }
+    }
+}
+
+
+const std::string& BitParallelDistance::Pattern::text() const
+{
+    return text_;
+}
+
+
+std::string::size_type BitParallelDistance::Pattern::length() const
+{
+    return text_.size();
+}
+
+
+std::uint64_t BitParallelDistance::Pattern::mask(char c) const
+{
+    return masks[static_cast<unsigned char>(c)];
+}
+
+
+
+unsigned int BitParallelDistance::levenshtein(const Pattern& pattern, std::string_view s)
+{
+    return scalarDistance<false>(pattern, s);
+}
+
+
+unsigned int BitParallelDistance::distance(const Pattern& pattern, std::string_view s)
+{
+    return scalarDistance<true>(pattern, s);
+}
+
+
+void BitParallelDistance::levenshteinMany(
+    const Pattern& pattern, const std::string_view* strings, unsigned int count,
+    unsigned int* distances)
+{
+    many<false>(pattern, strings, count, distances);
+}
+
+
+void BitParallelDistance::distanceMany(
+    const Pattern& pattern, const std::string_view* strings, unsigned int count,
+    unsigned int* distances)
+{
+    many<true>(pattern, strings, count, distances);
+}
+
+
+bool BitParallelDistance::usesAvx2()
+{
+#ifdef BITPARALLEL_AVX2
+    static const bool supported = __builtin_cpu_supports("avx2");
+    return supported;
+#else
+    return false;
+#endif
+}
@@ -0,0 +1,87 @@
+// BitParallelDistance.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Bit-parallel forms of the two distances that EditDistance measures, for
+// when one string (the "pattern," usually a misspelled word) is compared
+// against many others.  Rather than filling in the table of distances an
+// entry at a time, these keep one column of it as a pair of bit vectors,
+// one bit per character of the pattern, recording where the distance goes
+// up or down by one from the entry above.  Each character of the other
+// string then advances the whole column with a dozen or so bitwise and
+// arithmetic operations, following Myers' algorithm for Levenshtein
+// distance as Hyyrö formulated it, and Hyyrö's extension of it to swaps.
+// A comparison costs a few nanoseconds, whatever the distance turns out
+// to be, which makes it fast enough to check every word of a suitable
+// length in the dictionary.
+//
+// Since the columns are bit vectors, the pattern's masks (which bits of
+// the column each character matches) are computed once, as a Pattern, and
+// reused for every comparison.  A Pattern of up to 64 characters fits in
+// one 64-bit integer; one of up to 32 (or 16) characters also fits in each
+// 32-bit (or 16-bit) lane of a 256-bit AVX2 register, so the functions
+// that compare against many strings at once do 8 (or 16) at a time on
+// processors that support it, each lane advancing through a different
+// string.  Longer patterns are compared with EditDistance instead.
+
+#ifndef BITPARALLELDISTANCE_HPP
+#define BITPARALLELDISTANCE_HPP
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+
+
+namespace BitParallelDistance
+{
+    constexpr unsigned int maxPatternLength = 64;
+
+
+    // A Pattern holds the string that others are to be compared with,
+    // along with its masks: bit i of mask(c) is set if character i of the
+    // pattern is c.
+    class Pattern
+    {
+    public:
+        explicit Pattern(std::string_view pattern);
+
+        const std::string& text() const;
+        std::string::size_type length() const;
+
+        std::uint64_t mask(char c) const;
+
+    private:
+        std::string text_;
+        std::uint64_t masks[256];
+    };
+
+
+    // levenshtein() and distance() return the Levenshtein and optimal
+    // string alignment distances (as EditDistance measures them) between
+    // the pattern and the given string, with no limit.
+    unsigned int levenshtein(const Pattern& pattern, std::string_view s);
+    unsigned int distance(const Pattern& pattern, std::string_view s);
+
+
+    // levenshteinMany() and distanceMany() store into distances[i] the
+    // distance between the pattern and strings[i], for each of the count
+    // strings.
+    void levenshteinMany(
+        const Pattern& pattern, const std::string_view* strings, unsigned int count,
+        unsigned int* distances);
+
+    void distanceMany(
+        const Pattern& pattern, const std::string_view* strings, unsigned int count,
+        unsigned int* distances);
+
+
+    // usesAvx2() returns true if the functions above that compare against
+    // many strings use AVX2 on this processor.
+    bool usesAvx2();
+}
+
+
+
+#endif // BITPARALLELDISTANCE_HPP
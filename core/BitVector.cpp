@@ -0,0 +1,244 @@
+// BitVector.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include "BitVector.hpp"
+
+
+
+namespace
+{
+    // Unless the compiler has been told the processor has a POPCNT
+    // instruction, __builtin_popcountll() becomes a call into a helper
+    // library, which is much slower than counting bits in parallel here.
+    unsigned int popcount(std::uint64_t word)
+    {
+#ifdef __POPCNT__
+        return __builtin_popcountll(word);
+#else
+        word = word - ((word >> 1) & 0x5555555555555555ULL);
+        word = (word & 0x3333333333333333ULL) + ((word >> 2) & 0x3333333333333333ULL);
+        word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+        return (word * 0x0101010101010101ULL) >> 56;
+#endif
+    }
+
+
+    // Returns the position of the 1 bit numbered k (counting from 0 at the
+    // least significant end) within a single word.
+    unsigned int selectInWord(std::uint64_t word, unsigned int k)
+    {
+        // Skip whole bytes first, so that at most seven bits are cleared
+        // one at a time.
+        unsigned int shift = 0;
+
+        for (unsigned int count = popcount(word & 0xff); k >= count;
+             count = popcount((word >> shift) & 0xff))
+        {
+            k -= count;
+            shift += 8;
+        }
+
+        word >>= shift;
+
+        for (unsigned int i = 0; i < k; ++i)
+        {
+            word &= word - 1;
+        }
+
+        return shift + __builtin_ctzll(word);
+    }
+}
+
+
+
+BitVector::BitVector()
+    : bitCount{0}, blockRanks{0}, oneSamples{0}, zeroSamples{0}
+{
+}
+
+
+BitVector::BitVector(const std::vector<bool>& bits)
+    : words((bits.size() + 63) / 64, 0), bitCount{bits.size()}
+{
+    for (std::size_t i = 0; i < bits.size(); ++i)
+    {
+        if (bits[i])
+        {
+            words[i / 64] |= std::uint64_t{1} << (i % 64);
+        }
+    }
+
+    std::size_t blocks = (words.size() + wordsPerBlock - 1) / wordsPerBlock;
+    blockRanks.reserve(blocks + 1);
+
+    std::uint32_t ones = 0;
+
+    for (std::size_t w = 0; w < words.size(); ++w)
+    {
+        if (w % wordsPerBlock == 0)
+        {
+            blockRanks.push_back(ones);
+        }
+
+        ones += popcount(words[w]);
+    }
+
+    blockRanks.push_back(ones);
+
+    std::size_t onesSeen = 0;
+    std::size_t zerosSeen = 0;
+
+    for (std::size_t i = 0; i < bitCount; ++i)
+    {
+        std::size_t& counter = bits[i] ? onesSeen : zerosSeen;
+        std::vector<std::uint32_t>& samples = bits[i] ? oneSamples : zeroSamples;
+
+        if (counter % bitsPerBlock == 0)
+        {
+            samples.push_back(i / bitsPerBlock);
+        }
+
+        ++counter;
+    }
+
+    oneSamples.push_back(blocks);
+    zeroSamples.push_back(blocks);
+}
+
+
+std::size_t BitVector::size() const
+{
+    return bitCount;
+}
+
+
+bool BitVector::get(std::size_t i) const
+{
+    return (words[i / 64] >> (i % 64)) & 1;
+}
+
+
+std::size_t BitVector::rank1(std::size_t i) const
+{
+    std::size_t word = i / 64;
+    std::size_t rank = blockRanks[word / wordsPerBlock];
+
+    for (std::size_t w = word - word % wordsPerBlock; w < word; ++w)
+    {
+        rank += popcount(words[w]);
+    }
+
+    if (i % 64 != 0)
+    {
+        rank += popcount(words[word] & ((std::uint64_t{1} << (i % 64)) - 1));
+    }
+
+    return rank;
+}
+
+
+std::size_t BitVector::rank0(std::size_t i) const
+{
+    return i - rank1(i);
+}
+
+
+std::size_t BitVector::select1(std::size_t k) const
+{
+    return select(
+        k, oneSamples,
+        [this](std::size_t block) { return std::size_t{blockRanks[block]}; },
+        [this](std::size_t w) { return words[w]; });
+}
+
+
+std::size_t BitVector::select0(std::size_t k) const
+{
+    // Bits past the end of the last word count as zeros here, but since
+    // there must be more than k zeros among the real bits, they're never
+    // the ones selected.
+    return select(
+        k, zeroSamples,
+        [this](std::size_t block) { return block * bitsPerBlock - blockRanks[block]; },
+        [this](std::size_t w) { return ~words[w]; });
+}
+
+
+std::size_t BitVector::countOnesFrom(std::size_t i) const
+{
+    std::size_t w = i / 64;
+    std::uint64_t word = ~words[w] >> (i % 64);
+
+    if (word != 0)
+    {
+        return __builtin_ctzll(word);
+    }
+
+    std::size_t run = 64 - i % 64;
+
+    for (++w; w < words.size(); ++w)
+    {
+        if (~words[w] != 0)
+        {
+            return run + __builtin_ctzll(~words[w]);
+        }
+
+        run += 64;
+    }
+
+    return run;
+}
+
+
+std::size_t BitVector::memoryUsage() const
+{
+    return words.capacity() * sizeof(std::uint64_t)
+        + (blockRanks.capacity() + oneSamples.capacity() + zeroSamples.capacity())
+          * sizeof(std::uint32_t);
+}
+
+
+template <typename BlockCount, typename WordOf>
+std::size_t BitVector::select(
+    std::size_t k, const std::vector<std::uint32_t>& samples,
+    BlockCount blockCount, WordOf wordOf) const
+{
+    // Find the last block preceded by no more than k matching bits; it's
+    // no earlier than the block holding the nearest sampled bit before the
+    // one being selected, and no later than the one holding the next.
+    std::size_t sample = k / bitsPerBlock;
+    std::size_t lo = samples[sample];
+    std::size_t hi = samples[sample + 1] + 1;
+
+    while (hi - lo > 1)
+    {
+        std::size_t mid = lo + (hi - lo) / 2;
+
+        if (blockCount(mid) <= k)
+        {
+            lo = mid;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+
+    std::size_t remaining = k - blockCount(lo);
+
+    for (std::size_t w = lo * wordsPerBlock; ; ++w)
+    {
+        std::uint64_t word = wordOf(w);
+        unsigned int count = popcount(word);
+
+        if (remaining < count)
+        {
+            return w * 64 + selectInWord(word, remaining);
+        }
+
+        remaining -= count;
+    }
+}
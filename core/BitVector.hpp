@@ -0,0 +1,94 @@
+// BitVector.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A BitVector is an immutable sequence of bits that supports "rank" and
+// "select" queries, the building blocks of succinct data structures such
+// as the LoudsTrieSet:
+//
+// * rank1(i) is the number of 1 bits in positions [0, i)
+// * select1(k) is the position of the 1 bit numbered k, counting from 0
+//
+// (and likewise for rank0 and select0).
+//
+// Rank runs in constant time, using a directory with the number of 1 bits
+// preceding every 512-bit block (eight 64-bit words), which adds 6.25%
+// on top of the bits themselves.  Select binary searches that directory
+// for the right block, then scans at most eight words within it; the
+// search is narrowed by sampling which block holds every 512th 1 bit (and
+// every 512th 0 bit), which adds at most another 12.5%.
+
+#ifndef BITVECTOR_HPP
+#define BITVECTOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+
+
+class BitVector
+{
+public:
+    // Initializes a BitVector with no bits.
+    BitVector();
+
+    // Initializes a BitVector containing the given bits.
+    explicit BitVector(const std::vector<bool>& bits);
+
+
+    // size() returns the number of bits.
+    std::size_t size() const;
+
+    // get() returns the bit at the given position.
+    bool get(std::size_t i) const;
+
+
+    std::size_t rank1(std::size_t i) const;
+    std::size_t rank0(std::size_t i) const;
+
+    // The result of select1(k) or select0(k) is undefined unless there are
+    // more than k bits with the corresponding value.
+    std::size_t select1(std::size_t k) const;
+    std::size_t select0(std::size_t k) const;
+
+
+    // countOnesFrom() returns the length of the run of 1 bits starting at
+    // the given position.
+    std::size_t countOnesFrom(std::size_t i) const;
+
+
+    // memoryUsage() returns the number of bytes used by the bits and the
+    // rank directory.
+    std::size_t memoryUsage() const;
+
+
+private:
+    static constexpr std::size_t wordsPerBlock = 8;
+    static constexpr std::size_t bitsPerBlock = 64 * wordsPerBlock;
+
+    std::vector<std::uint64_t> words;
+    std::size_t bitCount;
+
+    // blockRanks[b] is the number of 1 bits preceding block b; there is one
+    // extra entry at the end holding the total.
+    std::vector<std::uint32_t> blockRanks;
+
+    // oneSamples[j] is the block holding the 1 bit numbered j * 512, and
+    // zeroSamples[j] the block holding the 0 bit numbered j * 512; each has
+    // one extra entry at the end holding the number of blocks.
+    std::vector<std::uint32_t> oneSamples;
+    std::vector<std::uint32_t> zeroSamples;
+
+
+private:
+    template <typename BlockCount, typename WordOf>
+    std::size_t select(
+        std::size_t k, const std::vector<std::uint32_t>& samples,
+        BlockCount blockCount, WordOf wordOf) const;
+};
+
+
+
+#endif // BITVECTOR_HPP
@@ -0,0 +1,119 @@
+// BloomFilter.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <cmath>
+#include "BloomFilter.hpp"
+
+
+
+namespace
+{
+    // Each of an element's k bits is chosen by multiplying the low 32 bits
+    // of its hash by a different odd constant and keeping the top 9 bits of
+    // the product.
+    const std::uint32_t salts[BloomFilter::MAX_HASH_COUNT] = {
+        0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du,
+        0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u,
+        0x9e3779b1u, 0x85ebca77u, 0xc2b2ae3du, 0x27d4eb2fu,
+        0x165667b1u, 0xd3a2646du, 0xfd7046c5u, 0xb55a4f09u};
+
+
+    // How many more bits per element a blocked filter needs than an
+    // ordinary one to reach about the same false positive rate.
+    constexpr double blockingOverhead = 1.1;
+}
+
+
+
+BloomFilter::BloomFilter(const std::vector<std::uint64_t>& hashes, double falsePositiveRate)
+{
+    // With k bits per element, an ordinary Bloom filter reaches the rate p
+    // with -k / ln(1 - p^(1/k)) bits per element, which is smallest when k
+    // is about log2(1/p).
+    double idealK = std::round(-std::log2(falsePositiveRate));
+    k = static_cast<unsigned int>(std::min(std::max(idealK, 1.0), double(MAX_HASH_COUNT)));
+
+    double bitsPerElement =
+        -double(k) / std::log(1.0 - std::pow(falsePositiveRate, 1.0 / k)) * blockingOverhead;
+
+    std::size_t blockCount = static_cast<std::size_t>(
+        std::ceil(bitsPerElement * hashes.size() / 512.0));
+
+    blocks.assign(std::max(blockCount, std::size_t{1}), Block{});
+
+    for (std::uint64_t hash : hashes)
+    {
+        std::uint64_t mask[8];
+        makeMask(hash, mask);
+
+        Block& block = blocks[blockIndex(hash)];
+
+        for (unsigned int i = 0; i < 8; ++i)
+        {
+            block.words[i] |= mask[i];
+        }
+    }
+}
+
+
+bool BloomFilter::mightContain(std::uint64_t hash) const
+{
+    const Block& block = blocks[blockIndex(hash)];
+
+    std::uint64_t mask[8];
+    makeMask(hash, mask);
+
+    // Accumulating the missing bits, rather than stopping at the first
+    // word with one, keeps this loop free of branches.
+    std::uint64_t missing = 0;
+
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+        missing |= mask[i] & ~block.words[i];
+    }
+
+    return missing == 0;
+}
+
+
+std::size_t BloomFilter::memoryUsage() const
+{
+    return blocks.size() * sizeof(Block);
+}
+
+
+std::size_t BloomFilter::blockCount() const
+{
+    return blocks.size();
+}
+
+
+unsigned int BloomFilter::hashCount() const
+{
+    return k;
+}
+
+
+std::size_t BloomFilter::blockIndex(std::uint64_t hash) const
+{
+    // The high 32 bits of the hash, scaled into the range of block indexes
+    // with a multiplication instead of a (much slower) division.
+    return ((hash >> 32) * blocks.size()) >> 32;
+}
+
+
+void BloomFilter::makeMask(std::uint64_t hash, std::uint64_t mask[8]) const
+{
+    std::fill(mask, mask + 8, 0);
+
+    std::uint32_t low = static_cast<std::uint32_t>(hash);
+
+    for (unsigned int i = 0; i < k; ++i)
+    {
+        std::uint32_t bit = (low * salts[i]) >> 23;
+        mask[bit >> 6] |= std::uint64_t{1} << (bit & 63);
+    }
+}
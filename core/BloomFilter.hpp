@@ -0,0 +1,75 @@
+// BloomFilter.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A BloomFilter is a MembershipFilter that is a "blocked" Bloom filter.
+// An ordinary Bloom filter sets k bits, scattered anywhere in one large
+// array, for each element, and checks those same k bits for each lookup,
+// which costs up to k cache misses.  A blocked Bloom filter divides the
+// array into blocks the size of one cache line (512 bits); each element's
+// hash chooses a block, and then k bits within it.  A lookup touches just
+// one cache line, and the check is done as eight 64-bit comparisons with
+// no branches between them, which the compiler can turn into a couple of
+// vector instructions.
+//
+// Confining each element to one block makes some blocks fuller than others,
+// which raises the false positive rate a little above that of an ordinary
+// Bloom filter of the same size; the filter is given somewhat more bits per
+// element than the usual formula calls for to make up for it.
+
+#ifndef BLOOMFILTER_HPP
+#define BLOOMFILTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "MembershipFilter.hpp"
+
+
+
+class BloomFilter : public MembershipFilter
+{
+public:
+    // The most bits that will be set for each element, no matter how small
+    // the false positive rate.
+    static constexpr unsigned int MAX_HASH_COUNT = 16;
+
+
+public:
+    // Builds a BloomFilter containing the elements with the given hashes,
+    // sized so that its false positive rate is close to the given one
+    // (which must be greater than 0 and less than 1).
+    BloomFilter(const std::vector<std::uint64_t>& hashes, double falsePositiveRate);
+
+
+    virtual bool mightContain(std::uint64_t hash) const;
+
+    virtual std::size_t memoryUsage() const;
+
+
+    // blockCount() returns the number of 512-bit blocks in the filter, and
+    // hashCount() the number of bits set in a block for each element.
+    std::size_t blockCount() const;
+    unsigned int hashCount() const;
+
+
+private:
+    struct alignas(64) Block
+    {
+        std::uint64_t words[8];
+    };
+
+
+    std::vector<Block> blocks;
+    unsigned int k;
+
+
+private:
+    std::size_t blockIndex(std::uint64_t hash) const;
+    void makeMask(std::uint64_t hash, std::uint64_t mask[8]) const;
+};
+
+
+
+#endif // BLOOMFILTER_HPP
@@ -0,0 +1,274 @@
+// CandidateGenerator.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A CandidateGenerator makes the candidates for a misspelled word, the way
+// a WordChecker's loops do, except that the alphabet and the families of
+// edit are fixed at compile time.  The alphabet is a pack of characters,
+// so the loops over it in the replacement and insertion families are
+// unrolled, each copy storing a constant; and for words no longer than
+// maxSpecializedLength, there's a separate copy of each family for every
+// length, in which the loops over positions run a constant number of
+// times and the candidates are built in a buffer on the stack.  Longer
+// words take the same code with the length only known at run time.
+//
+// The families are policy types, listed in the order their candidates
+// are to be made:
+//
+//     CandidateGenerator<UppercaseLetters, Swaps, Deletions>::generate(word, sink);
+//
+// Each candidate is handed to the sink, which is called with a pointer to
+// its characters and its length; the characters are only good until the
+// sink returns.  Splits hand over two candidates, the first word followed
+// by the second, for each split.  Within each family, candidates come in
+// the same order a WordChecker has always made them in: positions from
+// left to right and, for replacements and insertions, every position for
+// one character before any for the next.
+
+#ifndef CANDIDATEGENERATOR_HPP
+#define CANDIDATEGENERATOR_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+
+
+// An Alphabet is the pack of characters that replacements and insertions
+// try, in the order given.
+template <char... Characters>
+struct Alphabet
+{
+    static_assert(sizeof...(Characters) > 0, "An Alphabet needs at least one character");
+
+    static constexpr std::size_t size = sizeof...(Characters);
+    static constexpr char characters[size] = {Characters...};
+
+
+    // forEach() calls f once for each character, in order, passing it as
+    // a std::integral_constant, so that it's a constant within each call.
+    template <typename F>
+    static void forEach(F&& f)
+    {
+        (f(std::integral_constant<char, Characters>{}), ...);
+    }
+};
+
+
+// The letters a WordChecker tries, since a WordSetLoader converts every
+// word to uppercase.
+using UppercaseLetters = Alphabet<
+    'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M',
+    'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z'>;
+
+// An example of another alphabet, for a dictionary kept in lowercase with
+// contractions.  Nothing in this program loads such a dictionary; the
+// WordChecker uses UppercaseLetters, since a WordSetLoader uppercases
+// every word.
+using LowercaseLettersAndApostrophe = Alphabet<
+    'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l', 'm',
+    'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w', 'x', 'y', 'z', '\''>;
+
+
+
+// The length of the word being edited is either fixed at compile time,
+// when it's FixedLength<N>, or only known at run time, when it's AnyLength.
+template <std::size_t N>
+struct FixedLength
+{
+    static constexpr std::size_t of(std::size_t)
+    {
+        return N;
+    }
+};
+
+
+struct AnyLength
+{
+    static std::size_t of(std::size_t length)
+    {
+        return length;
+    }
+};
+
+
+
+// The families of edit.  Each has a generate() that hands every candidate
+// in the family to the sink, given the word, its length, and a buffer with
+// room for at least one more character than the word has.
+
+struct Splits
+{
+    template <typename Letters, typename Length, typename Sink>
+    static void generate(const char* word, std::size_t length, char*, Sink& sink)
+    {
+        const std::size_t n = Length::of(length);
+
+        for (std::size_t i = 1; i < n; ++i)
+        {
+            sink(word, i);
+            sink(word + i, n - i);
+        }
+    }
+};
+
+
+struct Swaps
+{
+    template <typename Letters, typename Length, typename Sink>
+    static void generate(const char* word, std::size_t length, char* buffer, Sink& sink)
+    {
+        const std::size_t n = Length::of(length);
+        std::memcpy(buffer, word, n);
+
+        for (std::size_t i = 0; i + 1 < n; ++i)
+        {
+            buffer[i] = word[i + 1];
+            buffer[i + 1] = word[i];
+            sink(static_cast<const char*>(buffer), n);
+            buffer[i] = word[i];
+            buffer[i + 1] = word[i + 1];
+        }
+    }
+};
+
+
+struct Replacements
+{
+    template <typename Letters, typename Length, typename Sink>
+    static void generate(const char* word, std::size_t length, char* buffer, Sink& sink)
+    {
+        const std::size_t n = Length::of(length);
+        std::memcpy(buffer, word, n);
+
+        Letters::forEach(
+            [&](auto c)
+            {
+                for (std::size_t x = 0; x < n; ++x)
+                {
+                    buffer[x] = c;
+                    sink(static_cast<const char*>(buffer), n);
+                    buffer[x] = word[x];
+                }
+            });
+    }
+};
+
+
+struct Deletions
+{
+    template <typename Letters, typename Length, typename Sink>
+    static void generate(const char* word, std::size_t length, char* buffer, Sink& sink)
+    {
+        const std::size_t n = Length::of(length);
+
+        if (n == 0)
+        {
+            return;
+        }
+
+        // Deleting the first character leaves the rest; from then on,
+        // moving the deletion one place to the right only puts back the
+        // character that was deleted before it.
+        std::memcpy(buffer, word + 1, n - 1);
+        sink(static_cast<const char*>(buffer), n - 1);
+
+        for (std::size_t x = 1; x < n; ++x)
+        {
+            buffer[x - 1] = word[x - 1];
+            sink(static_cast<const char*>(buffer), n - 1);
+        }
+    }
+};
+
+
+struct Insertions
+{
+    template <typename Letters, typename Length, typename Sink>
+    static void generate(const char* word, std::size_t length, char* buffer, Sink& sink)
+    {
+        const std::size_t n = Length::of(length);
+        std::memcpy(buffer + 1, word, n);
+
+        Letters::forEach(
+            [&](auto c)
+            {
+                // Likewise, moving the inserted character one place to the
+                // right only swaps it with the word's character there.
+                buffer[0] = c;
+                sink(static_cast<const char*>(buffer), n + 1);
+
+                for (std::size_t x = 0; x < n; ++x)
+                {
+                    buffer[x] = word[x];
+                    buffer[x + 1] = c;
+                    sink(static_cast<const char*>(buffer), n + 1);
+                }
+
+                // Put the buffer back the way the next character expects.
+                std::memcpy(buffer + 1, word, n);
+            });
+    }
+};
+
+
+
+template <typename Letters, typename... Families>
+class CandidateGenerator
+{
+public:
+    static constexpr std::size_t maxSpecializedLength = 12;
+
+
+    // generate() hands every candidate for the word to the sink, family by
+    // family in the order they were listed.
+    template <typename Sink>
+    static void generate(const std::string& word, Sink& sink)
+    {
+        generate(word.data(), word.length(), sink);
+    }
+
+
+    template <typename Sink>
+    static void generate(const char* word, std::size_t length, Sink& sink)
+    {
+        if (length <= maxSpecializedLength)
+        {
+            dispatch(word, length, sink, std::make_index_sequence<maxSpecializedLength + 1>{});
+        }
+        else
+        {
+            thread_local std::string buffer;
+            buffer.resize(length + 1);
+
+            (Families::template generate<Letters, AnyLength>(word, length, &buffer[0], sink), ...);
+        }
+    }
+
+
+private:
+    template <std::size_t N, typename Sink>
+    static void generateFixed(const char* word, std::size_t length, Sink& sink)
+    {
+        char buffer[N + 1];
+
+        (Families::template generate<Letters, FixedLength<N>>(word, length, buffer, sink), ...);
+    }
+
+
+    template <typename Sink, std::size_t... Ns>
+    static void dispatch(const char* word, std::size_t length, Sink& sink, std::index_sequence<Ns...>)
+    {
+        using Generate = void (*)(const char*, std::size_t, Sink&);
+        static constexpr Generate byLength[] = {&generateFixed<Ns, Sink>...};
+
+        byLength[length](word, length, sink);
+    }
+};
+
+
+
+#endif // CANDIDATEGENERATOR_HPP
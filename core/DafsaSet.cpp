@@ -0,0 +1,459 @@
+// DafsaSet.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include "DafsaSet.hpp"
+
+
+
+namespace
+{
+    const char fileMagic[8] = {'D', 'A', 'F', 'S', 'A', '0', '1', '\n'};
+
+
+    struct FileHeader
+    {
+        char magic[8];
+        std::uint32_t count;
+        std::uint32_t stateCount;
+        std::uint32_t transitionCount;
+        std::uint32_t root;
+    };
+
+
+    template <typename T>
+    void writeArray(std::ofstream& out, const std::vector<T>& v)
+    {
+        out.write(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+    }
+
+
+    template <typename T>
+    bool readArray(std::ifstream& in, std::vector<T>& v, std::size_t size)
+    {
+        v.resize(size);
+        in.read(reinterpret_cast<char*>(v.data()), size * sizeof(T));
+        return static_cast<bool>(in);
+    }
+
+
+    // Returns true if every state's transitions lie within the given
+    // number of transitions, each state's following the previous one's,
+    // and every transition leads to one of the given number of states, so
+    // that walking the automaton can never read outside its arrays.
+    bool hasValidTransitions(
+        const std::vector<std::uint32_t>& states, const std::vector<std::uint32_t>& targets,
+        std::uint32_t stateCount, std::uint32_t transitionCount)
+    {
+        std::uint32_t previous = 0;
+
+        for (std::uint32_t state : states)
+        {
+            std::uint32_t first = state >> 1;
+
+            if (first < previous || first > transitionCount)
+            {
+                return false;
+            }
+
+            previous = first;
+        }
+
+        return std::all_of(
+            targets.begin(), targets.end(),
+            [stateCount](std::uint32_t target) { return target < stateCount; });
+    }
+}
+
+
+
+DafsaSet::DafsaException::DafsaException(const std::string& reason)
+    : reason_{reason}
+{
+}
+
+
+std::string DafsaSet::DafsaException::reason() const
+{
+    return reason_;
+}
+
+
+
+DafsaSet::DafsaSet()
+    : states{0}, root{0}, count{0}, finished{false}, path{PathState{{}, false}}
+{
+}
+
+
+bool DafsaSet::isImplemented() const
+{
+    return true;
+}
+
+
+void DafsaSet::add(const std::string& element)
+{
+    if (finished)
+    {
+        throw DafsaException{"Cannot add to a DafsaSet that has been finished"};
+    }
+
+    if (count > 0)
+    {
+        if (element < previous)
+        {
+            throw DafsaException{"Elements must be added to a DafsaSet in sorted order: "
+                                 + element + " follows " + previous};
+        }
+        else if (element == previous)
+        {
+            return;
+        }
+    }
+
+    std::string::size_type common = 0;
+
+    while (common < element.size() && common < previous.size()
+           && element[common] == previous[common])
+    {
+        ++common;
+    }
+
+    // Everything on the path beyond the common prefix belongs only to
+    // earlier elements, so it can no longer change.
+    freezePathBelow(common);
+
+    for (std::string::size_type i = common; i < element.size(); ++i)
+    {
+        path.back().transitions.emplace_back(element[i], 0);
+        path.push_back(PathState{{}, false});
+    }
+
+    path.back().isFinal = true;
+    previous = element;
+    ++count;
+}
+
+
+bool DafsaSet::contains(const std::string& element) const
+{
+    const char* p = element.data();
+    const char* end = p + element.size();
+
+    if (finished)
+    {
+        return containsFrom(root, p, end);
+    }
+
+    for (std::vector<PathState>::size_type depth = 0; ; ++depth, ++p)
+    {
+        const PathState& state = path[depth];
+
+        if (p == end)
+        {
+            return state.isFinal;
+        }
+
+        auto it = std::find_if(
+            state.transitions.begin(), state.transitions.end(),
+            [=](const std::pair<char, std::uint32_t>& t)
+            {
+                return t.first == *p;
+            });
+
+        if (it == state.transitions.end())
+        {
+            return false;
+        }
+        else if (depth + 1 == path.size() || it + 1 != state.transitions.end())
+        {
+            // The transition leads to a frozen state, so the rest of the
+            // walk happens in the flat arrays.
+            return containsFrom(it->second, p + 1, end);
+        }
+    }
+}
+
+
+unsigned int DafsaSet::size() const
+{
+    return count;
+}
+
+
+void DafsaSet::findWordPrefixes(
+    const std::string& s, std::vector<std::string::size_type>& lengths) const
+{
+    if (!finished)
+    {
+        for (std::string::size_type i = 1; i <= s.length(); ++i)
+        {
+            if (contains(s.substr(0, i)))
+            {
+                lengths.push_back(i);
+            }
+        }
+
+        return;
+    }
+
+    std::uint32_t state = root;
+
+    for (std::string::size_type i = 0; i < s.length(); ++i)
+    {
+        auto first = labels.begin() + (states[state] >> 1);
+        auto last = labels.begin() + (states[state + 1] >> 1);
+        auto it = std::lower_bound(
+            first, last, s[i],
+            [](char a, char b)
+            {
+                return static_cast<unsigned char>(a) < static_cast<unsigned char>(b);
+            });
+
+        if (it == last || *it != s[i])
+        {
+            return;
+        }
+
+        state = targets[it - labels.begin()];
+
+        if ((states[state] & 1) != 0)
+        {
+            lengths.push_back(i + 1);
+        }
+    }
+}
+
+
+void DafsaSet::finish()
+{
+    if (finished)
+    {
+        return;
+    }
+
+    freezePathBelow(0);
+    root = appendState(path.front());
+    finished = true;
+
+    path.clear();
+    path.shrink_to_fit();
+    previous.clear();
+    previous.shrink_to_fit();
+    registry.clear();
+    registry.rehash(0);
+
+    states.shrink_to_fit();
+    labels.shrink_to_fit();
+    targets.shrink_to_fit();
+}
+
+
+bool DafsaSet::isFinished() const
+{
+    return finished;
+}
+
+
+unsigned int DafsaSet::stateCount() const
+{
+    return states.size() - 1;
+}
+
+
+unsigned int DafsaSet::transitionCount() const
+{
+    return labels.size();
+}
+
+
+std::size_t DafsaSet::memoryUsage() const
+{
+    return states.capacity() * sizeof(std::uint32_t)
+        + labels.capacity() * sizeof(char)
+        + targets.capacity() * sizeof(std::uint32_t);
+}
+
+
+std::uint32_t DafsaSet::rootState() const
+{
+    return root;
+}
+
+
+bool DafsaSet::isFinalState(std::uint32_t state) const
+{
+    return (states[state] & 1) != 0;
+}
+
+
+std::uint32_t DafsaSet::firstTransition(std::uint32_t state) const
+{
+    return states[state] >> 1;
+}
+
+
+char DafsaSet::transitionLabel(std::uint32_t transition) const
+{
+    return labels[transition];
+}
+
+
+std::uint32_t DafsaSet::transitionTarget(std::uint32_t transition) const
+{
+    return targets[transition];
+}
+
+
+void DafsaSet::save(const std::string& path) const
+{
+    if (!finished)
+    {
+        throw DafsaException{"Only a finished DafsaSet can be saved"};
+    }
+
+    std::ofstream out{path, std::ios::binary};
+
+    FileHeader header;
+    std::memcpy(header.magic, fileMagic, sizeof(fileMagic));
+    header.count = count;
+    header.stateCount = stateCount();
+    header.transitionCount = transitionCount();
+    header.root = root;
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeArray(out, states);
+    writeArray(out, labels);
+    writeArray(out, targets);
+
+    if (!out)
+    {
+        throw DafsaException{"Cannot write file: " + path};
+    }
+}
+
+
+DafsaSet DafsaSet::load(const std::string& path)
+{
+    std::ifstream in{path, std::ios::binary | std::ios::ate};
+    std::streamoff fileSize = in ? static_cast<std::streamoff>(in.tellg()) : 0;
+    in.seekg(0);
+
+    FileHeader header;
+
+    if (!in.read(reinterpret_cast<char*>(&header), sizeof(header))
+        || std::memcmp(header.magic, fileMagic, sizeof(fileMagic)) != 0)
+    {
+        throw DafsaException{"Not a saved DafsaSet: " + path};
+    }
+
+    // The sizes in the header are checked against the file's before any
+    // arrays are allocated, so that a corrupt header can't ask for more
+    // memory than the file could fill.
+    const std::uint64_t stateEntries = std::uint64_t{header.stateCount} + 1;
+    const std::uint64_t expectedSize = sizeof(header)
+        + stateEntries * sizeof(std::uint32_t)
+        + std::uint64_t{header.transitionCount} * (sizeof(char) + sizeof(std::uint32_t));
+
+    DafsaSet s;
+    s.path.clear();
+    s.count = header.count;
+    s.root = header.root;
+    s.finished = true;
+
+    if (static_cast<std::uint64_t>(fileSize) != expectedSize
+        || !readArray(in, s.states, stateEntries)
+        || !readArray(in, s.labels, header.transitionCount)
+        || !readArray(in, s.targets, header.transitionCount)
+        || s.root >= header.stateCount
+        || !hasValidTransitions(s.states, s.targets, header.stateCount, header.transitionCount))
+    {
+        throw DafsaException{"Saved DafsaSet is truncated or corrupt: " + path};
+    }
+
+    return s;
+}
+
+
+void DafsaSet::freezePathBelow(std::string::size_type depth)
+{
+    while (path.size() > depth + 1)
+    {
+        std::uint32_t frozen = freeze(path.back());
+        path.pop_back();
+        path.back().transitions.back().second = frozen;
+    }
+}
+
+
+std::uint32_t DafsaSet::freeze(const PathState& state)
+{
+    std::string key(1, state.isFinal ? '1' : '0');
+    key.reserve(1 + state.transitions.size() * (1 + sizeof(std::uint32_t)));
+
+    for (const auto& t : state.transitions)
+    {
+        key.push_back(t.first);
+        key.append(reinterpret_cast<const char*>(&t.second), sizeof(t.second));
+    }
+
+    auto it = registry.find(key);
+
+    if (it != registry.end())
+    {
+        return it->second;
+    }
+
+    std::uint32_t frozen = appendState(state);
+    registry.emplace(std::move(key), frozen);
+    return frozen;
+}
+
+
+std::uint32_t DafsaSet::appendState(const PathState& state)
+{
+    std::uint32_t index = states.size() - 1;
+
+    states.back() |= state.isFinal ? 1 : 0;
+
+    for (const auto& t : state.transitions)
+    {
+        labels.push_back(t.first);
+        targets.push_back(t.second);
+    }
+
+    states.push_back(labels.size() << 1);
+    return index;
+}
+
+
+bool DafsaSet::containsFrom(std::uint32_t state, const char* begin, const char* end) const
+{
+    for (const char* p = begin; p != end; ++p)
+    {
+        // Transitions are appended in the order the elements were added,
+        // so each state's labels are sorted.
+        auto first = labels.begin() + (states[state] >> 1);
+        auto last = labels.begin() + (states[state + 1] >> 1);
+        auto it = std::lower_bound(
+            first, last, *p,
+            [](char a, char b)
+            {
+                return static_cast<unsigned char>(a) < static_cast<unsigned char>(b);
+            });
+
+        if (it == last || *it != *p)
+        {
+            return false;
+        }
+
+        state = targets[it - labels.begin()];
+    }
+
+    return (states[state] & 1) != 0;
+}
@@ -0,0 +1,177 @@
+// DafsaSet.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A DafsaSet is an implementation of a Set of strings that is a DAFSA
+// (a "deterministic acyclic finite state automaton," sometimes called a
+// DAWG), which is the smallest automaton that accepts exactly the words in
+// the set.  Words that share prefixes share the states along those
+// prefixes, as they would in a trie; unlike a trie, words that share
+// suffixes share those states, too, so a dictionary full of "-ING" and
+// "-ED" endings takes up a small fraction of the space it would otherwise.
+//
+// The automaton is built incrementally using Daciuk's algorithm, which
+// requires that words are added in sorted order; this is how they appear
+// in the word set files, so loading one with a WordSetLoader works as
+// usual.  As each word is added, every state that can no longer change is
+// merged with an equivalent one (if there is one) and frozen into a set
+// of flat arrays, so the automaton is minimal at all times, save for the
+// states along the most recently added word.
+//
+// Once all the words have been added, finish() freezes the remaining
+// states and discards the bookkeeping needed to build the automaton; the
+// set is immutable from then on, and can be written to a file with save()
+// and read back much more quickly than it could be built again with load().
+
+#ifndef DAFSASET_HPP
+#define DAFSASET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "PrefixIndex.hpp"
+#include "Set.hpp"
+
+
+
+class DafsaSet : public Set<std::string>, public PrefixIndex
+{
+public:
+    // A DafsaException is thrown when a word is added out of order or after
+    // the set has been finished, or when a file can't be saved or loaded.
+    class DafsaException
+    {
+    public:
+        DafsaException(const std::string& reason);
+
+        std::string reason() const;
+
+    private:
+        std::string reason_;
+    };
+
+
+public:
+    // Initializes a DafsaSet to be empty and ready to have words added.
+    DafsaSet();
+
+
+    virtual bool isImplemented() const;
+
+
+    // add() adds an element to the set.  Elements must be added in sorted
+    // order; adding the element most recently added again has no effect,
+    // while adding anything smaller than it throws a DafsaException.  This
+    // function runs in time proportional to the length of the element.
+    virtual void add(const std::string& element);
+
+
+    // contains() returns true if the given element is already in the set,
+    // false otherwise.  It follows one transition per character, so it runs
+    // in time proportional to the length of the element.
+    virtual bool contains(const std::string& element) const;
+
+
+    // size() returns the number of elements in the set.
+    virtual unsigned int size() const;
+
+
+    // findWordPrefixes() appends to lengths the length of every nonempty
+    // prefix of the given string that's an element, shortest first.  Once
+    // the set is finished, it follows one transition per character of the
+    // string; until then, it looks up each prefix in turn.
+    virtual void findWordPrefixes(
+        const std::string& s, std::vector<std::string::size_type>& lengths) const;
+
+
+    // finish() freezes the automaton, after which no more elements can be
+    // added.  Calling finish() on a set that has already been finished has
+    // no effect.
+    void finish();
+
+    // isFinished() returns true if finish() has been called.
+    bool isFinished() const;
+
+
+    // stateCount() and transitionCount() return the number of states and
+    // transitions that have been frozen so far.  Once the set is finished,
+    // these describe the whole automaton.
+    unsigned int stateCount() const;
+    unsigned int transitionCount() const;
+
+    // memoryUsage() returns the number of bytes taken up by the frozen
+    // states and transitions, not counting the bookkeeping (if any) that's
+    // still needed to add more elements.
+    std::size_t memoryUsage() const;
+
+
+    // Once the set is finished, its automaton can be walked directly, as
+    // when running it in lockstep with another one.  The states are
+    // numbered from 0 up to stateCount(), and the transitions from 0 up to
+    // transitionCount(); the transitions out of a state are those numbered
+    // from firstTransition(state) up to but not including
+    // firstTransition(state + 1), in order of their labels.
+    std::uint32_t rootState() const;
+    bool isFinalState(std::uint32_t state) const;
+    std::uint32_t firstTransition(std::uint32_t state) const;
+    char transitionLabel(std::uint32_t transition) const;
+    std::uint32_t transitionTarget(std::uint32_t transition) const;
+
+
+    // save() writes a finished set to the file with the given path, which
+    // load() can later read back into an equivalent set.  The file stores
+    // the flat arrays as they're laid out in memory, so it can only be read
+    // on a machine with the same byte order.  load() throws a
+    // DafsaException if the file isn't a saved set, or if it's truncated or
+    // has any transition leading outside the automaton.
+    void save(const std::string& path) const;
+
+    static DafsaSet load(const std::string& path);
+
+
+private:
+    // A state that has not yet been frozen; these form the path spelled
+    // by the most recently added element.  The last transition of every
+    // state on the path, except the deepest, leads to the next state on
+    // the path, so its target is meaningless until that state is frozen.
+    struct PathState
+    {
+        std::vector<std::pair<char, std::uint32_t>> transitions;
+        bool isFinal;
+    };
+
+
+    // Frozen state i has the transitions numbered from (states[i] >> 1)
+    // up to but not including (states[i + 1] >> 1); the low bit of
+    // states[i] is set if it's a final state.  There is always one extra
+    // entry at the end of states, so that this works for the last state.
+    std::vector<std::uint32_t> states;
+    std::vector<char> labels;
+    std::vector<std::uint32_t> targets;
+
+    std::uint32_t root;
+    unsigned int count;
+    bool finished;
+
+    std::string previous;
+    std::vector<PathState> path;
+
+    // Maps a description of each frozen state's finality and transitions
+    // to its index, so that equivalent states are only frozen once.
+    std::unordered_map<std::string, std::uint32_t> registry;
+
+
+private:
+    void freezePathBelow(std::string::size_type depth);
+    std::uint32_t freeze(const PathState& state);
+    std::uint32_t appendState(const PathState& state);
+    bool containsFrom(std::uint32_t state, const char* begin, const char* end) const;
+};
+
+
+
+#endif // DAFSASET_HPP
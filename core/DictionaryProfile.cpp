@@ -0,0 +1,62 @@
+// DictionaryProfile.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include "DictionaryProfile.hpp"
+
+
+
+DictionaryProfile::DictionaryProfile()
+    : wordCount_{0}
+{
+}
+
+
+void DictionaryProfile::addWord(const std::string& word)
+{
+    unsigned int previous = wordStart;
+
+    for (char c : word)
+    {
+        unsigned int current = symbol(c);
+        bigrams.set(previous * symbolCount + current);
+
+        if (!characters[current])
+        {
+            characters.set(current);
+
+            // Keeping the alphabet sorted as it grows is cheap, since
+            // there are only so many characters to insert.
+            alphabet_.insert(
+                std::lower_bound(
+                    alphabet_.begin(), alphabet_.end(), c,
+                    [](char a, char b) { return symbol(a) < symbol(b); }),
+                c);
+        }
+
+        previous = current;
+    }
+
+    bigrams.set(previous * symbolCount + wordEnd);
+    ++wordCount_;
+}
+
+
+const std::string& DictionaryProfile::alphabet() const
+{
+    return alphabet_;
+}
+
+
+std::size_t DictionaryProfile::wordCount() const
+{
+    return wordCount_;
+}
+
+
+std::size_t DictionaryProfile::bigramCount() const
+{
+    return bigrams.count();
+}
@@ -0,0 +1,95 @@
+// DictionaryProfile.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A DictionaryProfile records which characters, and which pairs of
+// adjacent characters (bigrams), appear in the words of a dictionary, so
+// that a WordChecker can avoid generating candidates that can't possibly
+// be words.  Its alphabet is every character that appears in some word,
+// which for wordset.txt is exactly the letters A-Z; candidates made with
+// other characters are never tried.  And a candidate containing a bigram
+// that appears in no word can't be a word either, so it can be skipped
+// without being looked up.
+//
+// The start and the end of a word count as characters for this purpose,
+// so that, for instance, a candidate beginning with a character no word
+// begins with is skipped, too.
+//
+// The bigrams are kept in a table of bits, one per pair of characters
+// (including the start and end of a word), which takes a little over 8KB.
+
+#ifndef DICTIONARYPROFILE_HPP
+#define DICTIONARYPROFILE_HPP
+
+#include <bitset>
+#include <cstddef>
+#include <string>
+
+
+
+class DictionaryProfile
+{
+public:
+    // The characters are numbered by their values as unsigned chars, with
+    // these two numbers standing for the start and the end of a word.
+    static constexpr unsigned int wordStart = 256;
+    static constexpr unsigned int wordEnd = 257;
+    static constexpr unsigned int symbolCount = 258;
+
+
+public:
+    // Initializes a DictionaryProfile of an empty dictionary, whose
+    // alphabet is empty and in which no bigrams appear.
+    DictionaryProfile();
+
+
+    // addWord() records the characters and bigrams in the given word.
+    void addWord(const std::string& word);
+
+
+    // alphabet() returns every character that appears in some word, in
+    // increasing order of their values.
+    const std::string& alphabet() const;
+
+
+    // hasBigram() returns true if the given characters appear next to one
+    // another, in that order, in some word, where either may be wordStart
+    // or wordEnd.
+    bool hasBigram(unsigned int first, unsigned int second) const;
+
+
+    // symbol() returns the number that stands for the given character.
+    static unsigned int symbol(char c);
+
+
+    std::size_t wordCount() const;
+
+    // bigramCount() returns how many distinct bigrams appear, including
+    // those with the start or end of a word.
+    std::size_t bigramCount() const;
+
+
+private:
+    std::string alphabet_;
+    std::bitset<256> characters;
+    std::bitset<symbolCount * symbolCount> bigrams;
+    std::size_t wordCount_;
+};
+
+
+
+inline bool DictionaryProfile::hasBigram(unsigned int first, unsigned int second) const
+{
+    return bigrams[first * symbolCount + second];
+}
+
+
+inline unsigned int DictionaryProfile::symbol(char c)
+{
+    return static_cast<unsigned char>(c);
+}
+
+
+
+#endif // DICTIONARYPROFILE_HPP
@@ -0,0 +1,559 @@
+// DoubleArrayTrieSet.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "DoubleArrayTrieSet.hpp"
+
+
+
+namespace
+{
+    const char fileMagic[8] = {'D', 'A', 'T', 'R', 'I', 'E', '0', '1'};
+
+
+    struct FileHeader
+    {
+        char magic[8];
+        std::uint32_t count;
+        std::uint32_t cells;
+    };
+
+
+    const std::int32_t freeCell = -1;
+
+
+    // The code for a character; 0 is reserved for the end of a word.
+    std::uint32_t codeOf(char c)
+    {
+        return static_cast<unsigned char>(c) + 1;
+    }
+
+
+    // The largest code a character can have.
+    const std::uint32_t maxCode = 256;
+
+
+    // Returns true if the arrays describe a trie holding the given number
+    // of words: the root's cell is taken, and every other taken cell names
+    // a taken parent whose base, plus some code, leads back to it.  The
+    // cells reached with code 0 mark the ends of words.
+    bool hasValidCells(
+        const std::int32_t* base, const std::int32_t* check,
+        std::uint32_t cells, std::uint32_t count)
+    {
+        if (cells == 0 || check[0] != 0)
+        {
+            return false;
+        }
+
+        std::uint32_t ends = 0;
+
+        for (std::uint32_t t = 1; t < cells; ++t)
+        {
+            if (check[t] == freeCell)
+            {
+                continue;
+            }
+
+            if (check[t] < 0 || static_cast<std::uint32_t>(check[t]) >= cells
+                || check[check[t]] == freeCell)
+            {
+                return false;
+            }
+
+            std::int64_t code = std::int64_t{t} - base[check[t]];
+
+            if (code < 0 || code > maxCode)
+            {
+                return false;
+            }
+
+            if (code == 0)
+            {
+                ++ends;
+            }
+        }
+
+        return ends == count;
+    }
+
+
+    // Lays out the base and check arrays for a sorted list of distinct
+    // keys, one node at a time, from the root downward.  Each node's
+    // children are placed at the first base that has a free cell for every
+    // one of their codes.
+    class Builder
+    {
+    public:
+        Builder(const std::vector<const std::string*>& keys,
+                std::vector<std::int32_t>& base, std::vector<std::int32_t>& check)
+            : keys{keys}, base{base}, check{check}, nextFree{1}, lastUsed{0}
+        {
+        }
+
+
+        void build()
+        {
+            base.assign(std::max<std::size_t>(1024, keys.size() * 4), 0);
+            check.assign(base.size(), freeCell);
+
+            // The root is never anybody's child, but its cell is taken.  Its
+            // base is only left as 1 when there are no keys; since every
+            // transition then leads past the end of the arrays, nothing
+            // (not even the empty string) is found.
+            check[0] = 0;
+            base[0] = 1;
+
+            if (!keys.empty())
+            {
+                placeChildren(0, 0, keys.size(), 0);
+            }
+
+            base.resize(lastUsed + 1);
+            check.resize(lastUsed + 1);
+        }
+
+
+    private:
+        void placeChildren(
+            std::uint32_t node, std::size_t lo, std::size_t hi, std::string::size_type depth)
+        {
+            // Group the keys by the code that follows the prefix they share;
+            // since they're sorted, a key that ends here (code 0) is first,
+            // and the codes are ascending.
+            std::vector<std::uint32_t> codes;
+            std::vector<std::size_t> starts;
+
+            for (std::size_t i = lo; i < hi; ++i)
+            {
+                const std::string& key = *keys[i];
+                std::uint32_t code = key.size() == depth ? 0 : codeOf(key[depth]);
+
+                if (codes.empty() || codes.back() != code)
+                {
+                    codes.push_back(code);
+                    starts.push_back(i);
+                }
+            }
+
+            starts.push_back(hi);
+
+            std::uint32_t b = findBase(codes);
+            base[node] = b;
+
+            for (std::uint32_t code : codes)
+            {
+                check[b + code] = node;
+                lastUsed = std::max<std::size_t>(lastUsed, b + code);
+            }
+
+            for (std::size_t i = 0; i < codes.size(); ++i)
+            {
+                if (codes[i] != 0)
+                {
+                    placeChildren(b + codes[i], starts[i], starts[i + 1], depth + 1);
+                }
+            }
+        }
+
+
+        std::uint32_t findBase(const std::vector<std::uint32_t>& codes)
+        {
+            while (check[nextFree] != freeCell)
+            {
+                ++nextFree;
+                ensureSize(nextFree + 1);
+            }
+
+            std::size_t pos = std::max<std::size_t>(nextFree, codes.front() + 1);
+            std::size_t occupied = 0;
+
+            for (;; ++pos)
+            {
+                ensureSize(pos + codes.back() - codes.front() + 1);
+
+                if (check[pos] != freeCell)
+                {
+                    ++occupied;
+                    continue;
+                }
+
+                std::uint32_t b = pos - codes.front();
+
+                if (std::all_of(
+                        codes.begin() + 1, codes.end(),
+                        [&](std::uint32_t code) { return check[b + code] == freeCell; }))
+                {
+                    // If nearly everything between the first free cell and
+                    // here is taken, there's no point in scanning it again.
+                    if (occupied * 20 >= (pos - nextFree + 1) * 19)
+                    {
+                        nextFree = pos;
+                    }
+
+                    return b;
+                }
+            }
+        }
+
+
+        void ensureSize(std::size_t size)
+        {
+            if (size > check.size())
+            {
+                std::size_t newSize = std::max(size, check.size() * 2);
+                base.resize(newSize, 0);
+                check.resize(newSize, freeCell);
+            }
+        }
+
+
+    private:
+        const std::vector<const std::string*>& keys;
+        std::vector<std::int32_t>& base;
+        std::vector<std::int32_t>& check;
+        std::size_t nextFree;
+        std::size_t lastUsed;
+    };
+}
+
+
+
+DoubleArrayTrieSet::DoubleArrayTrieException::DoubleArrayTrieException(const std::string& reason)
+    : reason_{reason}
+{
+}
+
+
+std::string DoubleArrayTrieSet::DoubleArrayTrieException::reason() const
+{
+    return reason_;
+}
+
+
+
+DoubleArrayTrieSet::DoubleArrayTrieSet()
+    : base{nullptr}, check{nullptr}, cells{0},
+      mapping{nullptr}, mappingSize{0}, count{0}, finished{false}
+{
+}
+
+
+DoubleArrayTrieSet::~DoubleArrayTrieSet()
+{
+    unmap();
+}
+
+
+DoubleArrayTrieSet::DoubleArrayTrieSet(const DoubleArrayTrieSet& s)
+    : DoubleArrayTrieSet{}
+{
+    copyArraysFrom(s);
+}
+
+
+DoubleArrayTrieSet::DoubleArrayTrieSet(DoubleArrayTrieSet&& s)
+    : DoubleArrayTrieSet{}
+{
+    swapWith(s);
+}
+
+
+DoubleArrayTrieSet& DoubleArrayTrieSet::operator=(const DoubleArrayTrieSet& s)
+{
+    if (this != &s)
+    {
+        unmap();
+        copyArraysFrom(s);
+    }
+
+    return *this;
+}
+
+
+DoubleArrayTrieSet& DoubleArrayTrieSet::operator=(DoubleArrayTrieSet&& s)
+{
+    swapWith(s);
+    return *this;
+}
+
+
+bool DoubleArrayTrieSet::isImplemented() const
+{
+    return true;
+}
+
+
+void DoubleArrayTrieSet::add(const std::string& element)
+{
+    if (finished)
+    {
+        throw DoubleArrayTrieException{"Cannot add to a DoubleArrayTrieSet that has been finished"};
+    }
+
+    pending.insert(element);
+    count = pending.size();
+}
+
+
+bool DoubleArrayTrieSet::contains(const std::string& element) const
+{
+    if (!finished)
+    {
+        return pending.count(element) != 0;
+    }
+
+    std::uint32_t node = 0;
+
+    for (char c : element)
+    {
+        std::uint32_t next = base[node] + codeOf(c);
+
+        if (next >= cells || check[next] != static_cast<std::int32_t>(node))
+        {
+            return false;
+        }
+
+        node = next;
+    }
+
+    std::uint32_t end = base[node];
+    return end < cells && check[end] == static_cast<std::int32_t>(node);
+}
+
+
+unsigned int DoubleArrayTrieSet::size() const
+{
+    return count;
+}
+
+
+void DoubleArrayTrieSet::findWordPrefixes(
+    const std::string& s, std::vector<std::string::size_type>& lengths) const
+{
+    if (!finished)
+    {
+        for (std::string::size_type i = 1; i <= s.length(); ++i)
+        {
+            if (pending.count(s.substr(0, i)) != 0)
+            {
+                lengths.push_back(i);
+            }
+        }
+
+        return;
+    }
+
+    std::uint32_t node = 0;
+
+    for (std::string::size_type i = 0; i < s.length(); ++i)
+    {
+        std::uint32_t next = base[node] + codeOf(s[i]);
+
+        if (next >= cells || check[next] != static_cast<std::int32_t>(node))
+        {
+            return;
+        }
+
+        node = next;
+
+        std::uint32_t end = base[node];
+
+        if (end < cells && check[end] == static_cast<std::int32_t>(node))
+        {
+            lengths.push_back(i + 1);
+        }
+    }
+}
+
+
+void DoubleArrayTrieSet::finish()
+{
+    if (finished)
+    {
+        return;
+    }
+
+    std::vector<const std::string*> keys;
+    keys.reserve(pending.size());
+
+    for (const std::string& key : pending)
+    {
+        keys.push_back(&key);
+    }
+
+    Builder{keys, ownedBase, ownedCheck}.build();
+
+    base = ownedBase.data();
+    check = ownedCheck.data();
+    cells = ownedBase.size();
+    finished = true;
+
+    pending.clear();
+}
+
+
+bool DoubleArrayTrieSet::isFinished() const
+{
+    return finished;
+}
+
+
+unsigned int DoubleArrayTrieSet::cellCount() const
+{
+    return cells;
+}
+
+
+std::size_t DoubleArrayTrieSet::memoryUsage() const
+{
+    return std::size_t{cells} * 2 * sizeof(std::int32_t);
+}
+
+
+void DoubleArrayTrieSet::save(const std::string& path) const
+{
+    if (!finished)
+    {
+        throw DoubleArrayTrieException{"Only a finished DoubleArrayTrieSet can be saved"};
+    }
+
+    std::ofstream out{path, std::ios::binary};
+
+    FileHeader header;
+    std::memcpy(header.magic, fileMagic, sizeof(fileMagic));
+    header.count = count;
+    header.cells = cells;
+
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char*>(base), cells * sizeof(std::int32_t));
+    out.write(reinterpret_cast<const char*>(check), cells * sizeof(std::int32_t));
+
+    if (!out)
+    {
+        throw DoubleArrayTrieException{"Cannot write file: " + path};
+    }
+}
+
+
+DoubleArrayTrieSet DoubleArrayTrieSet::map(const std::string& path)
+{
+    int fd = ::open(path.c_str(), O_RDONLY);
+
+    if (fd < 0)
+    {
+        throw DoubleArrayTrieException{"Cannot open file: " + path};
+    }
+
+    struct stat info;
+
+    if (::fstat(fd, &info) != 0 || static_cast<std::size_t>(info.st_size) < sizeof(FileHeader))
+    {
+        ::close(fd);
+        throw DoubleArrayTrieException{"Not a saved DoubleArrayTrieSet: " + path};
+    }
+
+    std::size_t size = info.st_size;
+    void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+
+    if (mapping == MAP_FAILED)
+    {
+        throw DoubleArrayTrieException{"Cannot map file: " + path};
+    }
+
+    DoubleArrayTrieSet s;
+    s.mapping = mapping;
+    s.mappingSize = size;
+
+    const FileHeader* header = static_cast<const FileHeader*>(mapping);
+
+    if (std::memcmp(header->magic, fileMagic, sizeof(fileMagic)) != 0)
+    {
+        throw DoubleArrayTrieException{"Not a saved DoubleArrayTrieSet: " + path};
+    }
+
+    // The size is worked out in 64 bits, so that a corrupt cell count
+    // can't wrap around to one that the file appears to hold.
+    const std::uint64_t expectedSize = sizeof(FileHeader)
+        + std::uint64_t{header->cells} * 2 * sizeof(std::int32_t);
+
+    if (std::uint64_t{size} != expectedSize)
+    {
+        throw DoubleArrayTrieException{"Saved DoubleArrayTrieSet is truncated or corrupt: " + path};
+    }
+
+    s.base = reinterpret_cast<const std::int32_t*>(header + 1);
+    s.check = s.base + header->cells;
+    s.cells = header->cells;
+    s.count = header->count;
+    s.finished = true;
+
+    if (!hasValidCells(s.base, s.check, s.cells, s.count))
+    {
+        throw DoubleArrayTrieException{"Saved DoubleArrayTrieSet is truncated or corrupt: " + path};
+    }
+
+    return s;
+}
+
+
+bool DoubleArrayTrieSet::isSavedFile(const std::string& path)
+{
+    std::ifstream in{path, std::ios::binary};
+
+    char magic[sizeof(fileMagic)];
+
+    return in.read(magic, sizeof(magic))
+        && std::memcmp(magic, fileMagic, sizeof(fileMagic)) == 0;
+}
+
+
+void DoubleArrayTrieSet::copyArraysFrom(const DoubleArrayTrieSet& s)
+{
+    ownedBase.assign(s.base, s.base + s.cells);
+    ownedCheck.assign(s.check, s.check + s.cells);
+
+    base = ownedBase.data();
+    check = ownedCheck.data();
+    cells = s.cells;
+    count = s.count;
+    finished = s.finished;
+    pending = s.pending;
+}
+
+
+void DoubleArrayTrieSet::swapWith(DoubleArrayTrieSet& s)
+{
+    // Swapping vectors keeps their buffers where they are, so base and
+    // check remain valid whether they point into a vector or a mapping.
+    std::swap(base, s.base);
+    std::swap(check, s.check);
+    std::swap(cells, s.cells);
+    ownedBase.swap(s.ownedBase);
+    ownedCheck.swap(s.ownedCheck);
+    std::swap(mapping, s.mapping);
+    std::swap(mappingSize, s.mappingSize);
+    std::swap(count, s.count);
+    std::swap(finished, s.finished);
+    pending.swap(s.pending);
+}
+
+
+void DoubleArrayTrieSet::unmap()
+{
+    if (mapping != nullptr)
+    {
+        ::munmap(mapping, mappingSize);
+        mapping = nullptr;
+        mappingSize = 0;
+    }
+}
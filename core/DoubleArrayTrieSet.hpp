@@ -0,0 +1,163 @@
+// DoubleArrayTrieSet.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A DoubleArrayTrieSet is an implementation of a Set of strings that is a
+// trie packed into two parallel arrays of integers, "base" and "check."
+// The transition from the node at index s on the character c leads to the
+// node at index t = base[s] + code(c), which exists only if check[t] == s;
+// so a lookup reads two array cells per character and follows no pointers.
+// Code 0 is reserved for a transition that marks the end of a word.
+//
+// The arrays are laid out once every word is known, so words added to a
+// DoubleArrayTrieSet are kept aside (in a std::set) until finish() is
+// called, at which point the arrays are built and the words discarded.
+//
+// The arrays take the same form in memory as they do in a file, so a
+// finished set can be written with save() and later opened with map(),
+// which maps the file into memory read-only; there's nothing to parse or
+// build.  The arrays are checked once as they're mapped, so that a corrupt
+// file is rejected rather than leading lookups astray.  A mapped set is
+// finished by definition.
+
+#ifndef DOUBLEARRAYTRIESET_HPP
+#define DOUBLEARRAYTRIESET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <string>
+#include <vector>
+#include "PrefixIndex.hpp"
+#include "Set.hpp"
+
+
+
+class DoubleArrayTrieSet : public Set<std::string>, public PrefixIndex
+{
+public:
+    // A DoubleArrayTrieException is thrown when an element is added after
+    // the set has been finished, or when a file can't be saved or mapped.
+    class DoubleArrayTrieException
+    {
+    public:
+        DoubleArrayTrieException(const std::string& reason);
+
+        std::string reason() const;
+
+    private:
+        std::string reason_;
+    };
+
+
+public:
+    // Initializes a DoubleArrayTrieSet to be empty and ready to have
+    // elements added.
+    DoubleArrayTrieSet();
+
+    // Cleans up the DoubleArrayTrieSet, unmapping its file if it has one.
+    virtual ~DoubleArrayTrieSet();
+
+    // Initializes a new DoubleArrayTrieSet to be a copy of an existing one.
+    // A copy of a mapped set has its own copy of the arrays in memory.
+    DoubleArrayTrieSet(const DoubleArrayTrieSet& s);
+
+    // Initializes a new DoubleArrayTrieSet whose contents are moved from an
+    // expiring one.
+    DoubleArrayTrieSet(DoubleArrayTrieSet&& s);
+
+    // Assigns an existing DoubleArrayTrieSet into another.
+    DoubleArrayTrieSet& operator=(const DoubleArrayTrieSet& s);
+
+    // Assigns an expiring DoubleArrayTrieSet into another.
+    DoubleArrayTrieSet& operator=(DoubleArrayTrieSet&& s);
+
+
+    virtual bool isImplemented() const;
+
+
+    // add() adds an element to the set.  If the element is already in the
+    // set, this function has no effect.  Adding an element to a finished
+    // set throws a DoubleArrayTrieException.
+    virtual void add(const std::string& element);
+
+
+    // contains() returns true if the given element is already in the set,
+    // false otherwise.  Once the set is finished, this reads two array cells
+    // per character of the element, plus two more at the end.
+    virtual bool contains(const std::string& element) const;
+
+
+    // size() returns the number of elements in the set.
+    virtual unsigned int size() const;
+
+
+    // findWordPrefixes() appends to lengths the length of every nonempty
+    // prefix of the given string that's an element, shortest first.  Once
+    // the set is finished, it follows one transition per character of the
+    // string; until then, it looks up each prefix in turn.
+    virtual void findWordPrefixes(
+        const std::string& s, std::vector<std::string::size_type>& lengths) const;
+
+
+    // finish() lays out the arrays for every element added so far, after
+    // which no more elements can be added.  Calling finish() on a set that
+    // has already been finished has no effect.
+    void finish();
+
+    // isFinished() returns true if the set has been finished.
+    bool isFinished() const;
+
+
+    // cellCount() returns the length of the base and check arrays, and
+    // memoryUsage() the number of bytes they take up.
+    unsigned int cellCount() const;
+    std::size_t memoryUsage() const;
+
+
+    // save() writes a finished set to the file with the given path, in the
+    // form that map() expects.  The arrays are written as they're laid out
+    // in memory, so the file can only be used on a machine with the same
+    // byte order.
+    void save(const std::string& path) const;
+
+    // map() opens a file written by save(), mapping it into memory rather
+    // than reading it.  A file whose size doesn't match its header, or
+    // whose arrays don't describe a trie with as many words as the header
+    // says, throws a DoubleArrayTrieException.
+    static DoubleArrayTrieSet map(const std::string& path);
+
+    // isSavedFile() returns true if the file with the given path appears to
+    // have been written by save().
+    static bool isSavedFile(const std::string& path);
+
+
+private:
+    // base and check point either into the owned vectors or into the
+    // mapped file.
+    const std::int32_t* base;
+    const std::int32_t* check;
+    std::uint32_t cells;
+
+    std::vector<std::int32_t> ownedBase;
+    std::vector<std::int32_t> ownedCheck;
+
+    void* mapping;
+    std::size_t mappingSize;
+
+    unsigned int count;
+    bool finished;
+
+    std::set<std::string> pending;
+
+
+private:
+    void copyArraysFrom(const DoubleArrayTrieSet& s);
+    void swapWith(DoubleArrayTrieSet& s);
+    void unmap();
+};
+
+
+
+#endif // DOUBLEARRAYTRIESET_HPP
@@ -0,0 +1,156 @@
+// EditDistance.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <vector>
+#include "EditDistance.hpp"
+
+
+
+namespace
+{
+    // Computes either distance, with or without swaps, up to the limit k.
+    //
+    // Entry (i, j) of the table is the distance between the first i
+    // characters of a and the first j of b.  Any entry more than k away
+    // from the diagonal (i = j) is more than k, since the lengths alone
+    // differ by that much, so only the band of entries within k of it is
+    // computed; the entries just outside the band are treated as k + 1,
+    // as is anything else over the limit.
+    template <bool withSwaps>
+    unsigned int boundedDistance(std::string_view a, std::string_view b, unsigned int k)
+    {
+        // Characters the strings have in common at either end can't make
+        // the distance any smaller by being edited.
+        while (!a.empty() && !b.empty() && a.front() == b.front())
+        {
+            a.remove_prefix(1);
+            b.remove_prefix(1);
+        }
+
+        while (!a.empty() && !b.empty() && a.back() == b.back())
+        {
+            a.remove_suffix(1);
+            b.remove_suffix(1);
+        }
+
+        // The rows run along the shorter string.
+        if (a.size() < b.size())
+        {
+            std::swap(a, b);
+        }
+
+        const unsigned int over = k + 1;
+
+        if (a.size() - b.size() > k)
+        {
+            return over;
+        }
+        else if (b.empty())
+        {
+            return a.size();
+        }
+
+        const std::size_t n = a.size();
+        const std::size_t m = b.size();
+
+        // Three rows of the table are needed: the one being filled in, the
+        // one above it, and (for swaps) the one above that.  Each has room
+        // for one entry past the end, so the edge of the band can always be
+        // marked.  Words almost always fit in a small array on the stack;
+        // longer strings use storage that's reused from one call to the
+        // next on the same thread.
+        constexpr std::size_t localWidth = 64;
+        unsigned int local[3 * localWidth];
+        thread_local std::vector<unsigned int> longRows;
+
+        std::size_t width = std::max(localWidth, m + 2);
+        unsigned int* storage = local;
+
+        if (width > localWidth)
+        {
+            if (longRows.size() < 3 * width)
+            {
+                longRows.resize(3 * width);
+            }
+
+            storage = longRows.data();
+        }
+
+        unsigned int* twoAbove = storage;
+        unsigned int* above = storage + width;
+        unsigned int* current = storage + 2 * width;
+
+        // The first row's band, and the edge just past it.
+        std::size_t firstHi = std::min<std::size_t>(m, k);
+
+        for (std::size_t j = 0; j <= firstHi; ++j)
+        {
+            above[j] = j;
+        }
+
+        above[firstHi + 1] = over;
+
+        unsigned int smallestAbove = 0;
+
+        for (std::size_t i = 1; i <= n; ++i)
+        {
+            std::size_t lo = i > k ? i - k : 1;
+            std::size_t hi = std::min(m, i + k);
+
+            current[lo - 1] = lo == 1 ? std::min<std::size_t>(i, over) : over;
+            unsigned int smallest = current[lo - 1];
+
+            for (std::size_t j = lo; j <= hi; ++j)
+            {
+                unsigned int cost = a[i - 1] == b[j - 1] ? 0 : 1;
+
+                unsigned int d = std::min(above[j - 1] + cost, std::min(above[j], current[j - 1]) + 1);
+
+                if (withSwaps && i >= 2 && j >= 2 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1])
+                {
+                    d = std::min(d, twoAbove[j - 2] + 1);
+                }
+
+                d = std::min(d, over);
+                current[j] = d;
+                smallest = std::min(smallest, d);
+            }
+
+            current[hi + 1] = over;
+
+            // Every entry is at least the smallest one in the row above it
+            // or, by way of a swap, one more than the smallest two rows up,
+            // so once a row (or, with swaps, two consecutive rows) is
+            // entirely over the limit, so is the rest of the table.
+            if (smallest > k && (!withSwaps || smallestAbove > k))
+            {
+                return over;
+            }
+
+            smallestAbove = smallest;
+
+            unsigned int* oldest = twoAbove;
+            twoAbove = above;
+            above = current;
+            current = oldest;
+        }
+
+        return above[m];
+    }
+}
+
+
+
+unsigned int EditDistance::distance(std::string_view a, std::string_view b, unsigned int maxDistance)
+{
+    return boundedDistance<true>(a, b, maxDistance);
+}
+
+
+unsigned int EditDistance::levenshtein(std::string_view a, std::string_view b, unsigned int maxDistance)
+{
+    return boundedDistance<false>(a, b, maxDistance);
+}
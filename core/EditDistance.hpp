@@ -0,0 +1,48 @@
+// EditDistance.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Functions for measuring how far apart two strings are, used to check
+// candidate suggestions.  Two distances are available:
+//
+//   * distance() is the "optimal string alignment" form of Damerau-
+//     Levenshtein distance: the fewest insertions, deletions, and
+//     replacements of one character, and swaps of two adjacent characters,
+//     that turn one string into the other, where no character is edited
+//     more than once.  These are the same four edits that WordChecker
+//     tries.
+//
+//   * levenshtein() is the same without swaps, which then cost two edits.
+//     Unlike distance(), it obeys the triangle inequality (no string is
+//     further from a third than the sum of its distances to and from a
+//     second), which structures like a BKTree rely on.
+//
+// Both are given a limit, and are only exact up to it, which makes them
+// much faster when the limit is small, as it usually is: the strings'
+// common prefix and suffix are skipped, only the entries of the table
+// within limit of its diagonal are computed, and the calculation stops as
+// soon as every entry in a row has gone over.
+
+#ifndef EDITDISTANCE_HPP
+#define EDITDISTANCE_HPP
+
+#include <string_view>
+
+
+
+namespace EditDistance
+{
+    // distance() returns the distance between a and b, if it's no more than
+    // maxDistance, or maxDistance + 1 if it's more than that.
+    unsigned int distance(std::string_view a, std::string_view b, unsigned int maxDistance);
+
+
+    // levenshtein() returns the Levenshtein distance between a and b, if
+    // it's no more than maxDistance, or maxDistance + 1 if it's more.
+    unsigned int levenshtein(std::string_view a, std::string_view b, unsigned int maxDistance);
+}
+
+
+
+#endif // EDITDISTANCE_HPP
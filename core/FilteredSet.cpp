@@ -0,0 +1,136 @@
+// FilteredSet.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include "FilteredSet.hpp"
+#include "Hashing.hpp"
+
+
+
+FilteredSet::FilteredSet(Set<std::string>& words, FilterFactory makeFilter)
+    : words{words}, makeFilter{makeFilter}, finished{false},
+      lookups{0}, rejections{0}, falsePositives{0}
+{
+}
+
+
+bool FilteredSet::isImplemented() const
+{
+    return words.isImplemented();
+}
+
+
+void FilteredSet::add(const std::string& element)
+{
+    unsigned int before = words.size();
+    words.add(element);
+
+    if (words.size() == before)
+    {
+        return;
+    }
+
+    if (finished)
+    {
+        filter_.reset();
+    }
+    else
+    {
+        hashes.push_back(hashElement(element));
+    }
+}
+
+
+bool FilteredSet::contains(const std::string& element) const
+{
+    if (filter_ == nullptr)
+    {
+        return words.contains(element);
+    }
+
+    lookups.fetch_add(1, std::memory_order_relaxed);
+
+    if (!filter_->mightContain(hashElement(element)))
+    {
+        rejections.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    bool found = words.contains(element);
+
+    if (!found)
+    {
+        falsePositives.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    return found;
+}
+
+
+unsigned int FilteredSet::size() const
+{
+    return words.size();
+}
+
+
+void FilteredSet::finish()
+{
+    if (finished)
+    {
+        return;
+    }
+
+    if (hashes.size() == words.size())
+    {
+        filter_ = makeFilter(hashes);
+    }
+
+    finished = true;
+    hashes.clear();
+    hashes.shrink_to_fit();
+}
+
+
+bool FilteredSet::isFiltering() const
+{
+    return filter_ != nullptr;
+}
+
+
+Set<std::string>& FilteredSet::wrappedSet()
+{
+    return words;
+}
+
+
+const MembershipFilter* FilteredSet::filter() const
+{
+    return filter_.get();
+}
+
+
+unsigned long long FilteredSet::lookupCount() const
+{
+    return lookups;
+}
+
+
+unsigned long long FilteredSet::rejectionCount() const
+{
+    return rejections;
+}
+
+
+unsigned long long FilteredSet::falsePositiveCount() const
+{
+    return falsePositives;
+}
+
+
+std::uint64_t FilteredSet::hashElement(const std::string& element)
+{
+    // Filters carve several independent values out of the hash, so it's
+    // finalized to make every bit depend on every character.
+    return Hashing::mixed64(element);
+}
@@ -0,0 +1,115 @@
+// FilteredSet.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A FilteredSet puts a MembershipFilter in front of another Set of
+// strings, so that most lookups of elements that aren't in it are answered
+// by the (small, fast) filter without ever reaching the Set.  When checking
+// spelling, nearly all of the candidates the WordChecker generates while
+// looking for suggestions are misses, so this spares most of the lookups
+// the Set would otherwise do.
+//
+// Elements added to a FilteredSet are added to the Set behind it, and
+// their hashes are kept aside until finish() is called, which builds the
+// filter from them.  Until then (or if the Set was filled some other way,
+// so the filter would be missing some of its elements), every lookup goes
+// straight to the Set.
+//
+// The FilteredSet keeps a reference to the Set behind it, which must
+// outlive it, and counts its lookups, so that it's possible to see how many
+// the filter answered on its own.
+
+#ifndef FILTEREDSET_HPP
+#define FILTEREDSET_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+#include "MembershipFilter.hpp"
+#include "Set.hpp"
+
+
+
+class FilteredSet : public Set<std::string>
+{
+public:
+    // A FilterFactory builds a filter from the hashes of the elements.
+    using FilterFactory =
+        std::function<std::unique_ptr<MembershipFilter>(const std::vector<std::uint64_t>&)>;
+
+
+public:
+    // Initializes a FilteredSet in front of the given Set, which will use
+    // the given FilterFactory to build its filter.
+    FilteredSet(Set<std::string>& words, FilterFactory makeFilter);
+
+
+    virtual bool isImplemented() const;
+
+
+    // add() adds an element to the Set behind this one.  Adding an element
+    // that's not already there after the filter has been built discards
+    // the filter, since it would wrongly reject the new element.
+    virtual void add(const std::string& element);
+
+
+    // contains() returns true if the given element is in the Set behind
+    // this one, false otherwise, asking the filter first if there is one.
+    virtual bool contains(const std::string& element) const;
+
+
+    // size() returns the number of elements in the Set behind this one.
+    virtual unsigned int size() const;
+
+
+    // finish() builds the filter from the elements added so far, provided
+    // that they're all of the elements in the Set behind this one.  Calling
+    // finish() more than once has no effect.
+    void finish();
+
+    // isFiltering() returns true if there is a filter in front of the Set.
+    bool isFiltering() const;
+
+
+    // wrappedSet() returns the Set behind this one.
+    Set<std::string>& wrappedSet();
+
+    // filter() returns the filter, or nullptr if there isn't one.
+    const MembershipFilter* filter() const;
+
+
+    // lookupCount() returns the number of calls to contains() made since
+    // the filter was built, rejectionCount() how many of them the filter
+    // answered on its own, and falsePositiveCount() how many it passed on
+    // to the Set only for the Set to say the element wasn't there.
+    unsigned long long lookupCount() const;
+    unsigned long long rejectionCount() const;
+    unsigned long long falsePositiveCount() const;
+
+
+    // hashElement() returns the 64-bit hash of an element given to the
+    // filter.
+    static std::uint64_t hashElement(const std::string& element);
+
+
+private:
+    Set<std::string>& words;
+    FilterFactory makeFilter;
+
+    std::unique_ptr<MembershipFilter> filter_;
+    bool finished;
+    std::vector<std::uint64_t> hashes;
+
+    // Atomic, since lookups may be made from several threads at once.
+    mutable std::atomic<unsigned long long> lookups;
+    mutable std::atomic<unsigned long long> rejections;
+    mutable std::atomic<unsigned long long> falsePositives;
+};
+
+
+
+#endif // FILTEREDSET_HPP
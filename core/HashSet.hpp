@@ -24,6 +24,7 @@
 #define HASHSET_HPP
 
 #include <functional>
+#include "BatchLookup.hpp"
 #include "Set.hpp"
 
 
@@ -82,6 +83,13 @@ public:
     virtual bool contains(const T& element) const;
 
 
+    // containsBatch() looks up all of the given elements, a group at a
+    // time: every element in the group is hashed and its bucket prefetched,
+    // then every bucket's first node is, and only then are the chains
+    // walked, so that the cache misses in each stage overlap one another.
+    virtual void containsBatch(const T* elements, unsigned int count, bool* found) const;
+
+
     // size() returns the number of elements in the set.
     virtual unsigned int size() const;
 
@@ -112,7 +120,7 @@ HashSet<T>::HashSet(HashFunction hashFunction)
 {
 //need to set up the hash table
     capacity = DEFAULT_CAPACITY;
-    hash_set = new Nodes*[capacity];
+    hash_set = new Nodes*[capacity]();
     hash_size = 0;
 }
 
@@ -198,7 +206,7 @@ void HashSet<T>::add(const T& element)
         Nodes** prev_hash = hash_set;
         capacity = (capacity * 2);
         //makes a new hashset with a bigger capacity
-        hash_set = new Nodes*[capacity];
+        hash_set = new Nodes*[capacity]();
         //need to put the old hash set into new hashset
         for(unsigned int i = 0; i < capacity/2; i++)
         {
@@ -276,6 +284,49 @@ bool HashSet<T>::contains(const T& element) const
 }
 
 
+template <typename T>
+void HashSet<T>::containsBatch(const T* elements, unsigned int count, bool* found) const
+{
+    unsigned int indexes[BatchLookup::groupSize];
+    Nodes* heads[BatchLookup::groupSize];
+
+    for (unsigned int start = 0; start < count; start += BatchLookup::groupSize)
+    {
+        unsigned int groupCount = std::min(BatchLookup::groupSize, count - start);
+
+        for (unsigned int i = 0; i < groupCount; ++i)
+        {
+            indexes[i] = hashFunction(elements[start + i]) % capacity;
+            BatchLookup::prefetch(&hash_set[indexes[i]]);
+        }
+
+        for (unsigned int i = 0; i < groupCount; ++i)
+        {
+            heads[i] = hash_set[indexes[i]];
+
+            if (heads[i] != nullptr)
+            {
+                BatchLookup::prefetch(heads[i]);
+            }
+        }
+
+        for (unsigned int i = 0; i < groupCount; ++i)
+        {
+            found[start + i] = false;
+
+            for (Nodes* node = heads[i]; node != nullptr; node = node->next)
+            {
+                if (node->words == elements[start + i])
+                {
+                    found[start + i] = true;
+                    break;
+                }
+            }
+        }
+    }
+}
+
+
 template <typename T>
 unsigned int HashSet<T>::size() const
 {
@@ -0,0 +1,90 @@
+// Hashing.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// String hashes for hash tables and filters.  FNV-1a is quick to compute
+// for the short strings that words are, but its low bits depend mostly on
+// the last few characters, so a hash whose low bits choose a bucket or a
+// slot (or that's carved into several smaller values) should be passed
+// through the finalizer from MurmurHash3, which mixes every input bit into
+// every output bit.
+
+#ifndef HASHING_HPP
+#define HASHING_HPP
+
+#include <cstdint>
+#include <string_view>
+
+
+
+namespace Hashing
+{
+    // fnv1a32() and fnv1a64() return the 32- and 64-bit FNV-1a hashes of
+    // the given characters.
+    inline std::uint32_t fnv1a32(std::string_view s)
+    {
+        std::uint32_t h = 2166136261u;
+
+        for (char c : s)
+        {
+            h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+        }
+
+        return h;
+    }
+
+
+    inline std::uint64_t fnv1a64(std::string_view s)
+    {
+        std::uint64_t h = 14695981039346656037ull;
+
+        for (char c : s)
+        {
+            h = (h ^ static_cast<unsigned char>(c)) * 1099511628211ull;
+        }
+
+        return h;
+    }
+
+
+    // mix32() and mix64() are MurmurHash3's 32- and 64-bit finalizers.
+    inline std::uint32_t mix32(std::uint32_t h)
+    {
+        h ^= h >> 16;
+        h *= 0x85ebca6bu;
+        h ^= h >> 13;
+        h *= 0xc2b2ae35u;
+        h ^= h >> 16;
+        return h;
+    }
+
+
+    inline std::uint64_t mix64(std::uint64_t h)
+    {
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return h;
+    }
+
+
+    // mixed32() and mixed64() are FNV-1a followed by the finalizer, for
+    // hashes whose low bits are used on their own.
+    inline std::uint32_t mixed32(std::string_view s)
+    {
+        return mix32(fnv1a32(s));
+    }
+
+
+    inline std::uint64_t mixed64(std::string_view s)
+    {
+        return mix64(fnv1a64(s));
+    }
+}
+
+
+
+#endif // HASHING_HPP
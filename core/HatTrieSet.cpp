@@ -0,0 +1,430 @@
+// HatTrieSet.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include "Hashing.hpp"
+#include "HatTrieSet.hpp"
+
+
+
+namespace
+{
+    // A bucket is chosen by the low bits of the hash, which plain FNV-1a
+    // mixes poorly, so the hash is finalized first.
+    std::uint32_t hashChars(const char* begin, const char* end)
+    {
+        return Hashing::mixed32(std::string_view{begin, static_cast<std::size_t>(end - begin)});
+    }
+
+
+    // Within a bucket, each string's length is written first, seven bits
+    // per byte, with the high bit set on every byte but the last.
+    void appendLength(std::vector<char>& bucket, std::size_t length)
+    {
+        while (length >= 0x80)
+        {
+            bucket.push_back(static_cast<char>((length & 0x7f) | 0x80));
+            length >>= 7;
+        }
+
+        bucket.push_back(static_cast<char>(length));
+    }
+
+
+    const char* readLength(const char* p, std::size_t& length)
+    {
+        length = 0;
+
+        for (unsigned int shift = 0; ; shift += 7)
+        {
+            unsigned char byte = *p++;
+            length |= std::size_t{byte & 0x7fu} << shift;
+
+            if ((byte & 0x80) == 0)
+            {
+                return p;
+            }
+        }
+    }
+
+
+    // Calls f with the beginning and end of every string in a bucket,
+    // stopping early (and returning true) if f returns true.
+    template <typename F>
+    bool forEachInBucket(const std::vector<char>& bucket, F f)
+    {
+        const char* p = bucket.data();
+        const char* end = p + bucket.size();
+
+        while (p != end)
+        {
+            std::size_t length;
+            p = readLength(p, length);
+
+            if (f(p, p + length))
+            {
+                return true;
+            }
+
+            p += length;
+        }
+
+        return false;
+    }
+}
+
+
+
+HatTrieSet::HatTrieSet()
+    : root{makeNode()}, count{0}
+{
+}
+
+
+HatTrieSet::~HatTrieSet()
+{
+    destroyNode(root);
+}
+
+
+HatTrieSet::HatTrieSet(const HatTrieSet& s)
+    : root{copyNode(s.root)}, count{s.count}
+{
+}
+
+
+HatTrieSet::HatTrieSet(HatTrieSet&& s)
+    : root{makeNode()}, count{0}
+{
+    std::swap(root, s.root);
+    std::swap(count, s.count);
+}
+
+
+HatTrieSet& HatTrieSet::operator=(const HatTrieSet& s)
+{
+    if (this != &s)
+    {
+        Node* newRoot = copyNode(s.root);
+        destroyNode(root);
+        root = newRoot;
+        count = s.count;
+    }
+
+    return *this;
+}
+
+
+HatTrieSet& HatTrieSet::operator=(HatTrieSet&& s)
+{
+    std::swap(root, s.root);
+    std::swap(count, s.count);
+    return *this;
+}
+
+
+bool HatTrieSet::isImplemented() const
+{
+    return true;
+}
+
+
+void HatTrieSet::add(const std::string& element)
+{
+    Node* node = root;
+    const char* p = element.data();
+    const char* end = p + element.size();
+
+    for (; p != end; ++p)
+    {
+        unsigned char c = *p;
+
+        if (node->nodes[c] != nullptr)
+        {
+            node = node->nodes[c];
+            continue;
+        }
+
+        if (node->containers[c] == nullptr)
+        {
+            node->containers[c] = new Container{
+                std::vector<std::vector<char>>(BUCKETS_PER_CONTAINER), 0};
+        }
+
+        if (containerAdd(node->containers[c], p + 1, end))
+        {
+            ++count;
+
+            if (node->containers[c]->count > BURST_THRESHOLD)
+            {
+                burst(node, c);
+            }
+        }
+
+        return;
+    }
+
+    if (!node->isWord)
+    {
+        node->isWord = true;
+        ++count;
+    }
+}
+
+
+bool HatTrieSet::contains(const std::string& element) const
+{
+    const Node* node = root;
+    const char* p = element.data();
+    const char* end = p + element.size();
+
+    for (; p != end; ++p)
+    {
+        unsigned char c = *p;
+
+        if (node->nodes[c] != nullptr)
+        {
+            node = node->nodes[c];
+        }
+        else if (node->containers[c] != nullptr)
+        {
+            return containerContains(node->containers[c], p + 1, end);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return node->isWord;
+}
+
+
+unsigned int HatTrieSet::size() const
+{
+    return count;
+}
+
+
+std::vector<std::string> HatTrieSet::wordsWithPrefix(const std::string& prefix) const
+{
+    std::vector<std::string> words;
+
+    const Node* node = root;
+
+    for (std::string::size_type i = 0; i < prefix.size(); ++i)
+    {
+        unsigned char c = prefix[i];
+
+        if (node->nodes[c] != nullptr)
+        {
+            node = node->nodes[c];
+        }
+        else
+        {
+            // The prefix ends inside a container (or leads nowhere), so the
+            // words are whichever of the container's that begin with the
+            // rest of it.
+            if (node->containers[c] != nullptr)
+            {
+                std::string head = prefix.substr(0, i + 1);
+                std::string rest = prefix.substr(i + 1);
+
+                for (const std::string& suffix : containerWords(node->containers[c]))
+                {
+                    if (suffix.compare(0, rest.size(), rest) == 0)
+                    {
+                        words.push_back(head + suffix);
+                    }
+                }
+            }
+
+            return words;
+        }
+    }
+
+    std::string path = prefix;
+    collectWords(node, path, words);
+    return words;
+}
+
+
+HatTrieSet::Node* HatTrieSet::makeNode()
+{
+    Node* node = new Node;
+    node->isWord = false;
+    std::fill(std::begin(node->nodes), std::end(node->nodes), nullptr);
+    std::fill(std::begin(node->containers), std::end(node->containers), nullptr);
+    return node;
+}
+
+
+HatTrieSet::Node* HatTrieSet::copyNode(const Node* node)
+{
+    Node* copy = makeNode();
+    copy->isWord = node->isWord;
+
+    for (unsigned int c = 0; c < 256; ++c)
+    {
+        if (node->nodes[c] != nullptr)
+        {
+            copy->nodes[c] = copyNode(node->nodes[c]);
+        }
+        else if (node->containers[c] != nullptr)
+        {
+            copy->containers[c] = new Container{*node->containers[c]};
+        }
+    }
+
+    return copy;
+}
+
+
+void HatTrieSet::destroyNode(Node* node)
+{
+    for (unsigned int c = 0; c < 256; ++c)
+    {
+        if (node->nodes[c] != nullptr)
+        {
+            destroyNode(node->nodes[c]);
+        }
+
+        delete node->containers[c];
+    }
+
+    delete node;
+}
+
+
+bool HatTrieSet::containerContains(const Container* container, const char* begin, const char* end)
+{
+    std::size_t length = end - begin;
+    const std::vector<char>& bucket =
+        container->buckets[hashChars(begin, end) % BUCKETS_PER_CONTAINER];
+
+    return forEachInBucket(
+        bucket,
+        [=](const char* b, const char* e)
+        {
+            return std::size_t(e - b) == length && std::memcmp(b, begin, length) == 0;
+        });
+}
+
+
+bool HatTrieSet::containerAdd(Container* container, const char* begin, const char* end)
+{
+    if (containerContains(container, begin, end))
+    {
+        return false;
+    }
+
+    std::vector<char>& bucket =
+        container->buckets[hashChars(begin, end) % BUCKETS_PER_CONTAINER];
+
+    appendLength(bucket, end - begin);
+    bucket.insert(bucket.end(), begin, end);
+    ++container->count;
+    return true;
+}
+
+
+std::vector<std::string> HatTrieSet::containerWords(const Container* container)
+{
+    std::vector<std::string> words;
+    words.reserve(container->count);
+
+    for (const std::vector<char>& bucket : container->buckets)
+    {
+        forEachInBucket(
+            bucket,
+            [&](const char* b, const char* e)
+            {
+                words.emplace_back(b, e);
+                return false;
+            });
+    }
+
+    std::sort(words.begin(), words.end());
+    return words;
+}
+
+
+void HatTrieSet::burst(Node* node, unsigned char c)
+{
+    Container* full = node->containers[c];
+    Node* replacement = makeNode();
+
+    for (const std::vector<char>& bucket : full->buckets)
+    {
+        forEachInBucket(
+            bucket,
+            [=](const char* b, const char* e)
+            {
+                if (b == e)
+                {
+                    replacement->isWord = true;
+                    return false;
+                }
+
+                unsigned char first = *b;
+
+                if (replacement->containers[first] == nullptr)
+                {
+                    replacement->containers[first] = new Container{
+                        std::vector<std::vector<char>>(BUCKETS_PER_CONTAINER), 0};
+                }
+
+                containerAdd(replacement->containers[first], b + 1, e);
+                return false;
+            });
+    }
+
+    delete full;
+    node->containers[c] = nullptr;
+    node->nodes[c] = replacement;
+
+    // If nearly all of the words shared their next character, one of the
+    // new containers might already be too full.
+    for (unsigned int next = 0; next < 256; ++next)
+    {
+        if (replacement->containers[next] != nullptr
+            && replacement->containers[next]->count > BURST_THRESHOLD)
+        {
+            burst(replacement, next);
+        }
+    }
+}
+
+
+void HatTrieSet::collectWords(
+    const Node* node, std::string& prefix, std::vector<std::string>& words)
+{
+    if (node->isWord)
+    {
+        words.push_back(prefix);
+    }
+
+    for (unsigned int c = 0; c < 256; ++c)
+    {
+        prefix.push_back(static_cast<char>(c));
+
+        if (node->nodes[c] != nullptr)
+        {
+            collectWords(node->nodes[c], prefix, words);
+        }
+        else if (node->containers[c] != nullptr)
+        {
+            for (const std::string& suffix : containerWords(node->containers[c]))
+            {
+                words.push_back(prefix + suffix);
+            }
+        }
+
+        prefix.pop_back();
+    }
+}
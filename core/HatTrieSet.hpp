@@ -0,0 +1,131 @@
+// HatTrieSet.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A HatTrieSet is an implementation of a Set of strings that is a HAT-trie
+// (or "burst trie"): the top levels are ordinary trie nodes, with one slot
+// per possible character, and below them are "containers," small hash
+// tables holding the remainders of all of the words that share the prefix
+// leading to them.  Each bucket of a container is a single contiguous
+// array of characters, with the remainders stored end-to-end (each one
+// preceded by its length), so that searching a bucket means scanning one
+// block of memory instead of following a chain of pointers.
+//
+// Every container starts out empty; once one holds more than a threshold
+// number of words, it "bursts": it's replaced by a trie node, and its
+// words are distributed into new containers below that node according to
+// their first characters.  The trie therefore grows only where there are
+// many words sharing a prefix, and lookups stay close to the speed of a
+// hash table.
+//
+// Because the trie nodes keep their children in character order, it's
+// possible to list the words beginning with a given prefix in sorted
+// order, which a hash table alone can't do; only the (small) containers
+// along the way need to be sorted.
+
+#ifndef HATTRIESET_HPP
+#define HATTRIESET_HPP
+
+#include <string>
+#include <vector>
+#include "Set.hpp"
+
+
+
+class HatTrieSet : public Set<std::string>
+{
+public:
+    // The number of buckets in each container, and the number of words a
+    // container can hold before it bursts.
+    static constexpr unsigned int BUCKETS_PER_CONTAINER = 256;
+    static constexpr unsigned int BURST_THRESHOLD = 4096;
+
+
+public:
+    // Initializes a HatTrieSet to be empty.
+    HatTrieSet();
+
+    // Cleans up the HatTrieSet so that it leaks no memory.
+    virtual ~HatTrieSet();
+
+    // Initializes a new HatTrieSet to be a copy of an existing one.
+    HatTrieSet(const HatTrieSet& s);
+
+    // Initializes a new HatTrieSet whose contents are moved from an
+    // expiring one.
+    HatTrieSet(HatTrieSet&& s);
+
+    // Assigns an existing HatTrieSet into another.
+    HatTrieSet& operator=(const HatTrieSet& s);
+
+    // Assigns an expiring HatTrieSet into another.
+    HatTrieSet& operator=(HatTrieSet&& s);
+
+
+    virtual bool isImplemented() const;
+
+
+    // add() adds an element to the set.  If the element is already in the
+    // set, this function has no effect.  This usually runs in time
+    // proportional to the length of the element, though it occasionally
+    // bursts a container, which takes time proportional to the number of
+    // words in it.
+    virtual void add(const std::string& element);
+
+
+    // contains() returns true if the given element is already in the set,
+    // false otherwise.  This runs in time proportional to the length of the
+    // element, plus a scan of one bucket in one container.
+    virtual bool contains(const std::string& element) const;
+
+
+    // size() returns the number of elements in the set.
+    virtual unsigned int size() const;
+
+
+    // wordsWithPrefix() returns, in sorted order, every element of the set
+    // that begins with the given prefix.
+    std::vector<std::string> wordsWithPrefix(const std::string& prefix) const;
+
+
+private:
+    struct Container
+    {
+        std::vector<std::vector<char>> buckets;
+        unsigned int count;
+    };
+
+
+    // Each character leads either to another node, to a container, or (if
+    // both are nullptr) to nothing at all.
+    struct Node
+    {
+        bool isWord;
+        Node* nodes[256];
+        Container* containers[256];
+    };
+
+
+    Node* root;
+    unsigned int count;
+
+
+private:
+    static Node* makeNode();
+    static Node* copyNode(const Node* node);
+    static void destroyNode(Node* node);
+
+    static bool containerContains(const Container* container, const char* begin, const char* end);
+    static bool containerAdd(Container* container, const char* begin, const char* end);
+    static std::vector<std::string> containerWords(const Container* container);
+
+    static void burst(Node* node, unsigned char c);
+
+    static void collectWords(
+        const Node* node, std::string& prefix, std::vector<std::string>& words);
+};
+
+
+
+#endif // HATTRIESET_HPP
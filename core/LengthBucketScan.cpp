@@ -0,0 +1,214 @@
+// LengthBucketScan.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <utility>
+#include "BitParallelDistance.hpp"
+#include "LengthBucketScan.hpp"
+
+
+
+LengthBucketScan::LengthBucketScanException::LengthBucketScanException(const std::string& reason)
+    : reason_{reason}
+{
+}
+
+
+std::string LengthBucketScan::LengthBucketScanException::reason() const
+{
+    return reason_;
+}
+
+
+
+LengthBucketScan::LengthBucketScan(unsigned int maxDistance)
+    : maxDistance_{maxDistance}, finished{false}
+{
+    if (maxDistance == 0)
+    {
+        throw LengthBucketScanException{"The distance for a LengthBucketScan must be at least 1"};
+    }
+}
+
+
+void LengthBucketScan::addWord(const std::string& word)
+{
+    if (finished)
+    {
+        throw LengthBucketScanException{"Cannot add a word to a LengthBucketScan that has been finished"};
+    }
+
+    if (word.size() >= buckets.size())
+    {
+        buckets.resize(word.size() + 1);
+    }
+
+    buckets[word.size()].push_back(word);
+}
+
+
+void LengthBucketScan::finish()
+{
+    if (finished)
+    {
+        return;
+    }
+
+    std::size_t totalLength = 0;
+
+    for (std::size_t length = 0; length < buckets.size(); ++length)
+    {
+        std::vector<std::string>& bucket = buckets[length];
+
+        std::sort(bucket.begin(), bucket.end());
+        bucket.erase(std::unique(bucket.begin(), bucket.end()), bucket.end());
+
+        totalLength += bucket.size() * length;
+    }
+
+    // The arena has to be filled before any views of it are taken, since
+    // they'd be left dangling if it grew.
+    arena.reserve(totalLength);
+
+    for (const std::vector<std::string>& bucket : buckets)
+    {
+        for (const std::string& word : bucket)
+        {
+            arena.insert(arena.end(), word.begin(), word.end());
+        }
+    }
+
+    views.resize(buckets.size());
+
+    const char* next = arena.data();
+
+    for (std::size_t length = 0; length < buckets.size(); ++length)
+    {
+        views[length].reserve(buckets[length].size());
+
+        for (std::size_t i = 0; i < buckets[length].size(); ++i)
+        {
+            views[length].emplace_back(next, length);
+            next += length;
+        }
+    }
+
+    buckets.clear();
+    buckets.shrink_to_fit();
+
+    finished = true;
+}
+
+
+std::vector<std::string> LengthBucketScan::findSuggestions(const std::string& word) const
+{
+    return findWithin(word, maxDistance_);
+}
+
+
+std::size_t LengthBucketScan::memoryUsage() const
+{
+    std::size_t usage = arena.capacity() * sizeof(char)
+        + buckets.capacity() * sizeof(std::vector<std::string>)
+        + views.capacity() * sizeof(std::vector<std::string_view>);
+
+    for (const std::vector<std::string>& bucket : buckets)
+    {
+        usage += bucket.capacity() * sizeof(std::string);
+
+        for (const std::string& word : bucket)
+        {
+            usage += word.capacity();
+        }
+    }
+
+    for (const std::vector<std::string_view>& bucket : views)
+    {
+        usage += bucket.capacity() * sizeof(std::string_view);
+    }
+
+    return usage;
+}
+
+
+std::vector<std::string> LengthBucketScan::findWithin(
+    const std::string& word, unsigned int maxDistance, std::size_t& scanned) const
+{
+    std::vector<std::string> suggestions;
+    scanned = 0;
+
+    if (!finished || views.empty())
+    {
+        return suggestions;
+    }
+
+    const BitParallelDistance::Pattern pattern{word};
+
+    std::size_t shortest = word.size() > maxDistance ? word.size() - maxDistance : 0;
+    std::size_t longest = std::min(word.size() + maxDistance, views.size() - 1);
+
+    thread_local std::vector<unsigned int> distances;
+    std::vector<std::pair<unsigned int, std::string_view>> found;
+
+    for (std::size_t length = shortest; length <= longest; ++length)
+    {
+        const std::vector<std::string_view>& bucket = views[length];
+
+        distances.resize(bucket.size());
+        BitParallelDistance::distanceMany(pattern, bucket.data(), bucket.size(), distances.data());
+        scanned += bucket.size();
+
+        for (std::size_t i = 0; i < bucket.size(); ++i)
+        {
+            if (distances[i] <= maxDistance)
+            {
+                found.emplace_back(distances[i], bucket[i]);
+            }
+        }
+    }
+
+    std::sort(found.begin(), found.end());
+
+    suggestions.reserve(found.size());
+
+    for (const std::pair<unsigned int, std::string_view>& f : found)
+    {
+        suggestions.emplace_back(f.second);
+    }
+
+    return suggestions;
+}
+
+
+std::vector<std::string> LengthBucketScan::findWithin(const std::string& word, unsigned int maxDistance) const
+{
+    std::size_t scanned;
+    return findWithin(word, maxDistance, scanned);
+}
+
+
+unsigned int LengthBucketScan::maxDistance() const
+{
+    return maxDistance_;
+}
+
+
+std::size_t LengthBucketScan::wordCount() const
+{
+    std::size_t count = 0;
+
+    for (const std::vector<std::string_view>& bucket : views)
+    {
+        count += bucket.size();
+    }
+
+    return count;
+}
+
+
+bool LengthBucketScan::isFinished() const
+{
+    return finished;
+}
@@ -0,0 +1,122 @@
+// LengthBucketScan.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A LengthBucketScan is a SuggestionStrategy that finds every dictionary
+// word within some edit distance of a misspelled word the most direct way
+// there is: by measuring the distance to every word that could possibly be
+// close enough.  A word within distance k of a misspelled word of length n
+// has a length between n - k and n + k, so the words are kept in buckets
+// by length, and only those 2k + 1 buckets are scanned.  For a typical
+// misspelling, that's a fifth to a third of the dictionary.
+//
+// What makes it competitive is that the distances are measured with the
+// bit-parallel kernels in BitParallelDistance, which compare the misspelled
+// word against a whole bucket 8 or 16 words at a time, at a few nanoseconds
+// per word.  Unlike the other strategies, there's nothing to build beyond
+// the buckets themselves, so it takes no more memory than the words do.
+//
+// The distance is the same swap-aware one that SymSpellIndex uses, so the
+// two find the same words.
+
+#ifndef LENGTHBUCKETSCAN_HPP
+#define LENGTHBUCKETSCAN_HPP
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "SuggestionStrategy.hpp"
+
+
+
+class LengthBucketScan : public SuggestionStrategy
+{
+public:
+    // A LengthBucketScanException is thrown when a scan is asked to search
+    // within a distance of 0, or when a word is added after it has been
+    // finished.
+    class LengthBucketScanException
+    {
+    public:
+        LengthBucketScanException(const std::string& reason);
+
+        std::string reason() const;
+
+    private:
+        std::string reason_;
+    };
+
+
+public:
+    // Initializes an empty LengthBucketScan that will find the words within
+    // the given edit distance (at least 1).
+    explicit LengthBucketScan(unsigned int maxDistance = 2);
+
+    // A LengthBucketScan can't be copied, since a copy's views would point
+    // into the original's arena.  Moving one moves the arena's storage
+    // along with the views of it, so they stay valid.
+    LengthBucketScan(const LengthBucketScan&) = delete;
+    LengthBucketScan& operator=(const LengthBucketScan&) = delete;
+    LengthBucketScan(LengthBucketScan&&) = default;
+    LengthBucketScan& operator=(LengthBucketScan&&) = default;
+
+
+    // addWord() adds a dictionary word to the bucket for its length.  It
+    // throws a LengthBucketScanException if the scan has been finished.
+    virtual void addWord(const std::string& word);
+
+
+    // finish() sorts each bucket and removes duplicates from it, after
+    // which the buckets can be scanned, but no more words can be added.
+    // Calling finish() on a scan that has already been finished has no
+    // effect.
+    virtual void finish();
+
+
+    // findSuggestions() returns findWithin(word, maxDistance()).
+    virtual std::vector<std::string> findSuggestions(const std::string& word) const;
+
+
+    // memoryUsage() returns the number of bytes taken up by the words and
+    // the buckets.
+    virtual std::size_t memoryUsage() const;
+
+
+    // findWithin() returns every word within the given edit distance of
+    // the given word (including the word itself, if it's a dictionary
+    // word), closest first, with ties in sorted order.  The number of words
+    // whose distance was measured is stored into scanned.  A scan that
+    // hasn't been finished finds nothing.
+    std::vector<std::string> findWithin(
+        const std::string& word, unsigned int maxDistance, std::size_t& scanned) const;
+
+    std::vector<std::string> findWithin(const std::string& word, unsigned int maxDistance) const;
+
+
+    unsigned int maxDistance() const;
+
+    // wordCount() returns the number of distinct words in the buckets,
+    // which is 0 until the scan has been finished.
+    std::size_t wordCount() const;
+
+    bool isFinished() const;
+
+
+private:
+    // Until the scan is finished, buckets[n] holds the words of length n
+    // themselves.  Finishing copies every bucket's words back-to-back into
+    // arena, and views[n] then holds views of the words of length n in it,
+    // which is what the kernels compare against.
+    std::vector<std::vector<std::string>> buckets;
+    std::vector<char> arena;
+    std::vector<std::vector<std::string_view>> views;
+
+    unsigned int maxDistance_;
+    bool finished;
+};
+
+
+
+#endif // LENGTHBUCKETSCAN_HPP
@@ -0,0 +1,92 @@
+// LevenshteinAutomaton.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include "LevenshteinAutomaton.hpp"
+
+
+
+LevenshteinAutomaton::LevenshteinAutomaton(const std::string& word, unsigned int maxDistance)
+    : maxDistance{std::min(maxDistance, maxSupportedDistance)},
+      charMasks{}, validMask{0}, acceptMask{0}
+{
+    if (word.size() > maxWordLength)
+    {
+        return;
+    }
+
+    for (std::string::size_type i = 0; i < word.size(); ++i)
+    {
+        charMasks[static_cast<unsigned char>(word[i])] |= std::uint64_t{1} << (i + 1);
+    }
+
+    validMask = word.size() == maxWordLength ? ~std::uint64_t{0} : (std::uint64_t{1} << (word.size() + 1)) - 1;
+    acceptMask = std::uint64_t{1} << word.size();
+}
+
+
+LevenshteinAutomaton::State LevenshteinAutomaton::start() const
+{
+    State state{};
+
+    // Before anything is read, the first e characters of the word can
+    // already have been deleted, using e edits.
+    for (unsigned int e = 0; e <= maxDistance; ++e)
+    {
+        state.matched[e] = ((std::uint64_t{1} << (e + 1)) - 1) & validMask;
+    }
+
+    return state;
+}
+
+
+LevenshteinAutomaton::State LevenshteinAutomaton::step(const State& state, char c) const
+{
+    const std::uint64_t b = charMasks[static_cast<unsigned char>(c)];
+
+    State next{};
+    next.matched[0] = (state.matched[0] << 1) & b;
+
+    for (unsigned int e = 1; e <= maxDistance; ++e)
+    {
+        const std::uint64_t fewer = state.matched[e - 1];
+
+        std::uint64_t matched =
+            ((state.matched[e] << 1) & b)               // c matches the next character
+            | fewer                                      // c is inserted
+            | (fewer << 1)                               // c replaces the next character
+            | ((state.swapping[e] << 2) & (b << 1))      // c completes a swap
+            | (next.matched[e - 1] << 1);                // the next character is deleted
+
+        next.matched[e] = matched & validMask;
+
+        // c is the second of the next two characters, so it may be the
+        // first half of a swap.
+        next.swapping[e] = fewer & (b >> 2);
+    }
+
+    return next;
+}
+
+
+bool LevenshteinAutomaton::isDead(const State& state) const
+{
+    // Anything active with fewer edits is active with more, too.
+    return (state.matched[maxDistance] | state.swapping[maxDistance]) == 0;
+}
+
+
+unsigned int LevenshteinAutomaton::distance(const State& state) const
+{
+    for (unsigned int e = 0; e <= maxDistance; ++e)
+    {
+        if ((state.matched[e] & acceptMask) != 0)
+        {
+            return e;
+        }
+    }
+
+    return maxDistance + 1;
+}
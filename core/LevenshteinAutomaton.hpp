@@ -0,0 +1,91 @@
+// LevenshteinAutomaton.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A LevenshteinAutomaton recognizes the strings within some small edit
+// distance of a given word, where the distance is the swap-aware one that
+// EditDistance::distance() measures.  It's meant to be run in lockstep
+// with another automaton, such as a DAFSA, that recognizes the words in a
+// dictionary: feeding each the same characters, and abandoning a path as
+// soon as this one says nothing along it can be accepted, finds every
+// dictionary word near the given one in a single walk.
+//
+// Conceptually, the automaton's states are pairs (i, e): the first i
+// characters of the word have been accounted for, using e edits.  Reading
+// a character can match the next character of the word (e stays the
+// same), replace it, or be an inserted character, while a character of the
+// word can be deleted without reading anything; each of those edits costs
+// one.  A swap is read as two characters, the first of which leaves the
+// automaton partway through it.  Many of these states can be active at
+// once, so rather than converting it to a deterministic automaton, its
+// set of active states is tracked directly, as one bit per position of
+// the word for each possible number of edits, so that taking a step costs
+// a few bitwise operations for each number of edits, however long the
+// word and whatever the character read.
+//
+// Since the positions are bits of a 64-bit integer, the word can be at
+// most maxWordLength characters long; the automaton for a longer one
+// accepts nothing.
+
+#ifndef LEVENSHTEINAUTOMATON_HPP
+#define LEVENSHTEINAUTOMATON_HPP
+
+#include <cstdint>
+#include <string>
+
+
+
+class LevenshteinAutomaton
+{
+public:
+    static constexpr unsigned int maxSupportedDistance = 3;
+    static constexpr unsigned int maxWordLength = 63;
+
+
+    // A State is a set of active states of the underlying automaton.
+    // matched[e] has bit i set if (i, e) is active, and swapping[e] has bit
+    // i set if the first character of a swap that brings e edits to i + 2
+    // has just been read.  Only the first maxDistance + 1 of each are used.
+    struct State
+    {
+        std::uint64_t matched[maxSupportedDistance + 1];
+        std::uint64_t swapping[maxSupportedDistance + 1];
+    };
+
+
+public:
+    // Builds the automaton for the strings within maxDistance (no more
+    // than maxSupportedDistance) of the given word.
+    LevenshteinAutomaton(const std::string& word, unsigned int maxDistance);
+
+
+    // start() returns the state before any characters have been read.
+    State start() const;
+
+    // step() returns the state reached from the given one by reading c.
+    State step(const State& state, char c) const;
+
+
+    // isDead() returns true if no string read from the given state onward
+    // can lead to acceptance.
+    bool isDead(const State& state) const;
+
+    // distance() returns the distance between the word and the characters
+    // read to reach the given state, if it's no more than maxDistance, or
+    // maxDistance + 1 if it's more.
+    unsigned int distance(const State& state) const;
+
+
+private:
+    unsigned int maxDistance;
+
+    // charMasks[c] has bit i + 1 set if the word's character i is c.
+    std::uint64_t charMasks[256];
+    std::uint64_t validMask;
+    std::uint64_t acceptMask;
+};
+
+
+
+#endif // LEVENSHTEINAUTOMATON_HPP
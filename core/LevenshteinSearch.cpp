@@ -0,0 +1,169 @@
+// LevenshteinSearch.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include "LevenshteinAutomaton.hpp"
+#include "LevenshteinSearch.hpp"
+
+
+
+LevenshteinSearch::LevenshteinSearchException::LevenshteinSearchException(const std::string& reason)
+    : reason_{reason}
+{
+}
+
+
+std::string LevenshteinSearch::LevenshteinSearchException::reason() const
+{
+    return reason_;
+}
+
+
+
+LevenshteinSearch::LevenshteinSearch(unsigned int maxDistance)
+    : maxDistance_{maxDistance}
+{
+    if (maxDistance == 0 || maxDistance > LevenshteinAutomaton::maxSupportedDistance)
+    {
+        throw LevenshteinSearchException{
+            "The distance for a LevenshteinSearch must be between 1 and "
+            + std::to_string(LevenshteinAutomaton::maxSupportedDistance)};
+    }
+}
+
+
+void LevenshteinSearch::addWord(const std::string& word)
+{
+    words.add(word);
+}
+
+
+void LevenshteinSearch::finish()
+{
+    words.finish();
+}
+
+
+std::vector<std::string> LevenshteinSearch::findSuggestions(const std::string& word) const
+{
+    return findWithin(word, maxDistance_);
+}
+
+
+std::size_t LevenshteinSearch::memoryUsage() const
+{
+    return words.memoryUsage();
+}
+
+
+std::vector<std::string> LevenshteinSearch::findWithin(
+    const std::string& word, unsigned int maxDistance, std::size_t& visited) const
+{
+    visited = 0;
+
+    if (!words.isFinished())
+    {
+        return {};
+    }
+
+    if (maxDistance > LevenshteinAutomaton::maxSupportedDistance)
+    {
+        throw LevenshteinSearchException{
+            "A LevenshteinSearch can only find words within "
+            + std::to_string(LevenshteinAutomaton::maxSupportedDistance)};
+    }
+
+    LevenshteinAutomaton automaton{word, maxDistance};
+
+    // Each step of the walk is a DAFSA state paired with the Levenshtein
+    // automaton's state after reading the same characters.  The characters
+    // themselves are kept in one buffer, which each step truncates to its
+    // depth before appending the label of the transition that reached it.
+    struct Step
+    {
+        std::uint32_t state;
+        std::uint32_t depth;
+        char label;
+        LevenshteinAutomaton::State at;
+    };
+
+    thread_local std::vector<Step> pending;
+    thread_local std::string path;
+
+    pending.assign(1, Step{words.rootState(), 0, '\0', automaton.start()});
+    path.clear();
+
+    std::vector<std::pair<unsigned int, std::string>> found;
+
+    while (!pending.empty())
+    {
+        Step step = pending.back();
+        pending.pop_back();
+
+        ++visited;
+
+        if (step.depth > 0)
+        {
+            path.resize(step.depth - 1);
+            path.push_back(step.label);
+        }
+
+        if (words.isFinalState(step.state))
+        {
+            unsigned int distance = automaton.distance(step.at);
+
+            if (distance <= maxDistance)
+            {
+                found.emplace_back(distance, path);
+            }
+        }
+
+        std::uint32_t last = words.firstTransition(step.state + 1);
+
+        for (std::uint32_t t = words.firstTransition(step.state); t < last; ++t)
+        {
+            char label = words.transitionLabel(t);
+            LevenshteinAutomaton::State next = automaton.step(step.at, label);
+
+            if (!automaton.isDead(next))
+            {
+                pending.push_back(Step{words.transitionTarget(t), step.depth + 1, label, next});
+            }
+        }
+    }
+
+    std::sort(found.begin(), found.end());
+
+    std::vector<std::string> suggestions;
+    suggestions.reserve(found.size());
+
+    for (std::pair<unsigned int, std::string>& f : found)
+    {
+        suggestions.push_back(std::move(f.second));
+    }
+
+    return suggestions;
+}
+
+
+std::vector<std::string> LevenshteinSearch::findWithin(const std::string& word, unsigned int maxDistance) const
+{
+    std::size_t visited;
+    return findWithin(word, maxDistance, visited);
+}
+
+
+unsigned int LevenshteinSearch::maxDistance() const
+{
+    return maxDistance_;
+}
+
+
+const DafsaSet& LevenshteinSearch::dictionary() const
+{
+    return words;
+}
@@ -0,0 +1,101 @@
+// LevenshteinSearch.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A LevenshteinSearch is a SuggestionStrategy that finds every dictionary
+// word within a small edit distance of a misspelled word by intersecting
+// two automata: a LevenshteinAutomaton, recognizing the strings near the
+// misspelling, and a DAFSA, recognizing the dictionary's words.  Both are
+// walked together from their start states, following only the DAFSA's
+// transitions, depth first.  Any path along which the Levenshtein
+// automaton dies is abandoned at once, and every final DAFSA state reached
+// where the Levenshtein automaton accepts spells a suggestion.
+//
+// No candidate strings are generated or looked up, so the cost of a
+// search depends on how much of the DAFSA lies within reach of the
+// misspelling, not on the size of the alphabet times the length of the
+// word.  Since a DAFSA shares the states of common suffixes as well as
+// prefixes, it's also much smaller than the dictionary it holds.
+//
+// Words are added to the DAFSA as they are to a DafsaSet, so they must be
+// added in sorted order.
+
+#ifndef LEVENSHTEINSEARCH_HPP
+#define LEVENSHTEINSEARCH_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "DafsaSet.hpp"
+#include "SuggestionStrategy.hpp"
+
+
+
+class LevenshteinSearch : public SuggestionStrategy
+{
+public:
+    // A LevenshteinSearchException is thrown when a search is asked to
+    // find words further away than a LevenshteinAutomaton can.
+    class LevenshteinSearchException
+    {
+    public:
+        LevenshteinSearchException(const std::string& reason);
+
+        std::string reason() const;
+
+    private:
+        std::string reason_;
+    };
+
+
+public:
+    // Initializes an empty LevenshteinSearch whose findSuggestions() will
+    // find the words within the given distance (between 1 and
+    // LevenshteinAutomaton::maxSupportedDistance).
+    explicit LevenshteinSearch(unsigned int maxDistance = 2);
+
+
+    // addWord() adds a dictionary word.  As with DafsaSet::add(), words
+    // must be added in sorted order; one that's out of order causes a
+    // DafsaSet::DafsaException to be thrown.
+    virtual void addWord(const std::string& word);
+
+
+    // finish() finishes the DAFSA, after which no more words can be added.
+    virtual void finish();
+
+
+    // findSuggestions() returns findWithin(word, maxDistance()).
+    virtual std::vector<std::string> findSuggestions(const std::string& word) const;
+
+
+    // memoryUsage() returns the number of bytes taken up by the DAFSA.
+    virtual std::size_t memoryUsage() const;
+
+
+    // findWithin() returns every word within the given distance (no more
+    // than LevenshteinAutomaton::maxSupportedDistance) of the given word,
+    // closest first, with ties in sorted order.  The number of DAFSA
+    // states visited along the way is stored into visited.  A search that
+    // hasn't been finished finds nothing.
+    std::vector<std::string> findWithin(
+        const std::string& word, unsigned int maxDistance, std::size_t& visited) const;
+
+    std::vector<std::string> findWithin(const std::string& word, unsigned int maxDistance) const;
+
+
+    unsigned int maxDistance() const;
+
+    // dictionary() returns the DAFSA holding the words.
+    const DafsaSet& dictionary() const;
+
+
+private:
+    unsigned int maxDistance_;
+    DafsaSet words;
+};
+
+
+
+#endif // LEVENSHTEINSEARCH_HPP
@@ -0,0 +1,237 @@
+// LoudsTrieSet.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <limits>
+#include "LoudsTrieSet.hpp"
+
+
+
+namespace
+{
+    // A node of the trie during construction: the numbers of the (sorted)
+    // elements that pass through it, from begin up to but not including
+    // end, all of which share their first characters, as many as the depth
+    // of the level the node is on.
+    struct KeyRange
+    {
+        std::uint32_t begin;
+        std::uint32_t end;
+    };
+}
+
+
+
+LoudsTrieSet::LoudsTrieException::LoudsTrieException(const std::string& reason)
+    : reason_{reason}
+{
+}
+
+
+std::string LoudsTrieSet::LoudsTrieException::reason() const
+{
+    return reason_;
+}
+
+
+
+LoudsTrieSet::LoudsTrieSet()
+    : count{0}, finished{false}, offsets{0}
+{
+}
+
+
+bool LoudsTrieSet::isImplemented() const
+{
+    return true;
+}
+
+
+void LoudsTrieSet::add(const std::string& element)
+{
+    if (finished)
+    {
+        throw LoudsTrieException{"Cannot add to a LoudsTrieSet that has been finished"};
+    }
+
+    if (count > 0)
+    {
+        std::string_view previous = pendingElement(count - 1);
+
+        if (element < previous)
+        {
+            throw LoudsTrieException{"Elements must be added to a LoudsTrieSet in sorted order: "
+                                     + element + " follows " + std::string{previous}};
+        }
+        else if (element == previous)
+        {
+            return;
+        }
+    }
+
+    if (element.size() > std::numeric_limits<std::uint32_t>::max() - arena.size())
+    {
+        throw LoudsTrieException{"Too many characters to add to a LoudsTrieSet"};
+    }
+
+    arena.insert(arena.end(), element.begin(), element.end());
+    offsets.push_back(arena.size());
+    ++count;
+}
+
+
+bool LoudsTrieSet::contains(const std::string& element) const
+{
+    if (!finished)
+    {
+        std::uint32_t low = 0;
+        std::uint32_t high = count;
+
+        while (low < high)
+        {
+            std::uint32_t middle = low + (high - low) / 2;
+
+            if (pendingElement(middle) < element)
+            {
+                low = middle + 1;
+            }
+            else
+            {
+                high = middle;
+            }
+        }
+
+        return low < count && pendingElement(low) == element;
+    }
+
+    std::size_t node = 0;
+
+    for (char c : element)
+    {
+        std::size_t firstBit = shape.select0(node) + 1;
+        std::size_t children = shape.countOnesFrom(firstBit);
+
+        if (children == 0)
+        {
+            return false;
+        }
+
+        // Exactly node + 1 zeros precede firstBit, so everything else before
+        // it is a one; that's cheaper than asking for rank1(firstBit).
+        std::size_t firstChild = firstBit - (node + 1);
+
+        auto first = labels.begin() + (firstChild - 1);
+        auto last = first + children;
+        auto it = std::lower_bound(
+            first, last, c,
+            [](char a, char b)
+            {
+                return static_cast<unsigned char>(a) < static_cast<unsigned char>(b);
+            });
+
+        if (it == last || *it != c)
+        {
+            return false;
+        }
+
+        node = firstChild + (it - first);
+    }
+
+    return terminal.get(node);
+}
+
+
+unsigned int LoudsTrieSet::size() const
+{
+    return count;
+}
+
+
+void LoudsTrieSet::finish()
+{
+    if (finished)
+    {
+        return;
+    }
+
+    std::vector<bool> shapeBits{true, false};
+    std::vector<bool> terminalBits;
+
+    // Visiting the nodes in breadth-first order, one level at a time, each
+    // one is described by its children's bits, its own terminal bit, and
+    // (for every child) a label; the elements are sorted, so children are
+    // found in label order.
+    std::vector<KeyRange> level{KeyRange{0, count}};
+    std::vector<KeyRange> nextLevel;
+
+    for (std::string::size_type depth = 0; !level.empty(); ++depth)
+    {
+        nextLevel.clear();
+
+        for (KeyRange node : level)
+        {
+            bool isWord = node.begin != node.end && pendingElement(node.begin).size() == depth;
+            terminalBits.push_back(isWord);
+
+            if (isWord)
+            {
+                ++node.begin;
+            }
+
+            while (node.begin != node.end)
+            {
+                char label = pendingElement(node.begin)[depth];
+                std::uint32_t childEnd = node.begin + 1;
+
+                while (childEnd != node.end && pendingElement(childEnd)[depth] == label)
+                {
+                    ++childEnd;
+                }
+
+                shapeBits.push_back(true);
+                labels.push_back(label);
+                nextLevel.push_back(KeyRange{node.begin, childEnd});
+
+                node.begin = childEnd;
+            }
+
+            shapeBits.push_back(false);
+        }
+
+        level.swap(nextLevel);
+    }
+
+    shape = BitVector{shapeBits};
+    terminal = BitVector{terminalBits};
+    labels.shrink_to_fit();
+    finished = true;
+
+    std::vector<char>{}.swap(arena);
+    std::vector<std::uint32_t>{}.swap(offsets);
+}
+
+
+bool LoudsTrieSet::isFinished() const
+{
+    return finished;
+}
+
+
+std::size_t LoudsTrieSet::nodeCount() const
+{
+    return terminal.size();
+}
+
+
+std::size_t LoudsTrieSet::memoryUsage() const
+{
+    return shape.memoryUsage() + terminal.memoryUsage() + labels.capacity();
+}
+
+
+std::string_view LoudsTrieSet::pendingElement(std::uint32_t i) const
+{
+    return std::string_view{arena.data() + offsets[i], offsets[i + 1] - offsets[i]};
+}
@@ -0,0 +1,126 @@
+// LoudsTrieSet.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A LoudsTrieSet is an implementation of a Set of strings that is a trie
+// stored in "level-order unary degree sequence" (LOUDS) form, a succinct
+// encoding that describes the trie's shape without any pointers at all.
+// The nodes are numbered in breadth-first order, with the root as 0, and
+// the shape is the bit sequence "10" followed by, for each node in turn,
+// one 1 bit per child and then a 0 bit.  With rank and select on those
+// bits (see BitVector), the children of any node can be located:
+//
+// * node i's children are described by the run of 1 bits that follows
+//   the 0 bit numbered i (counting from 0)
+// * the child described by the 1 bit at position p is node rank1(p)
+//
+// Alongside the shape, the set stores one byte per node (the label of
+// the edge leading into it) and one bit per node (whether it ends a
+// word), for a little more than 11 bits per node in all.  Since the
+// children of every node are numbered consecutively in label order, a
+// node's child on a given character is found by binary search.
+//
+// As with a DafsaSet, words must be added in sorted order, as they are in
+// the word set files.  Until finish() is called, they're kept back-to-back
+// in one array of characters, with one 32-bit offset per word, rather than
+// in a structure with pointers of its own; finish() then builds the
+// succinct form one level at a time, keeping only the ranges of words
+// below the nodes of the current level and the next, and discards them.
+// So building never takes much more memory than the words themselves.
+
+#ifndef LOUDSTRIESET_HPP
+#define LOUDSTRIESET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "BitVector.hpp"
+#include "Set.hpp"
+
+
+
+class LoudsTrieSet : public Set<std::string>
+{
+public:
+    // A LoudsTrieException is thrown when an element is added out of
+    // order, or after the set has been finished.
+    class LoudsTrieException
+    {
+    public:
+        LoudsTrieException(const std::string& reason);
+
+        std::string reason() const;
+
+    private:
+        std::string reason_;
+    };
+
+
+public:
+    // Initializes a LoudsTrieSet to be empty and ready to have elements
+    // added.
+    LoudsTrieSet();
+
+
+    virtual bool isImplemented() const;
+
+
+    // add() adds an element to the set.  Elements must be added in sorted
+    // order; adding the element most recently added again has no effect,
+    // while adding anything smaller than it, or adding anything to a
+    // finished set, throws a LoudsTrieException.
+    virtual void add(const std::string& element);
+
+
+    // contains() returns true if the given element is already in the set,
+    // false otherwise.  Until the set is finished, this is a binary search
+    // of the elements added; after that, it takes one select per character,
+    // plus a binary search among the labels of each node's children.
+    virtual bool contains(const std::string& element) const;
+
+
+    // size() returns the number of elements in the set.
+    virtual unsigned int size() const;
+
+
+    // finish() builds the succinct form of every element added so far,
+    // after which no more elements can be added.  Calling finish() on a set
+    // that has already been finished has no effect.
+    void finish();
+
+    // isFinished() returns true if finish() has been called.
+    bool isFinished() const;
+
+
+    // nodeCount() returns the number of nodes in the trie, including the
+    // root, and memoryUsage() the number of bytes the succinct form takes.
+    std::size_t nodeCount() const;
+    std::size_t memoryUsage() const;
+
+
+private:
+    std::string_view pendingElement(std::uint32_t i) const;
+
+
+private:
+    BitVector shape;
+    BitVector terminal;
+
+    // labels[i - 1] is the label of the edge leading into node i.
+    std::vector<char> labels;
+
+    unsigned int count;
+    bool finished;
+
+    // Until the set is finished, element i occupies arena[offsets[i]] up
+    // to but not including arena[offsets[i + 1]].
+    std::vector<char> arena;
+    std::vector<std::uint32_t> offsets;
+};
+
+
+
+#endif // LOUDSTRIESET_HPP
@@ -0,0 +1,43 @@
+// MembershipFilter.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// The MembershipFilter class is an abstract base class for approximate
+// membership filters: structures built from the hashes of a fixed
+// collection of elements that can say for certain when some other element
+// is not in the collection, but can only say that an element might be in
+// it.  How often they wrongly say "might be" (the false positive rate)
+// depends on the kind of filter and how much memory it's given.
+//
+// Filters work entirely on 64-bit hashes, never on the elements
+// themselves, so a FilteredSet does the hashing once per lookup and any
+// kind of filter can be put in front of any Set.
+
+#ifndef MEMBERSHIPFILTER_HPP
+#define MEMBERSHIPFILTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+
+
+class MembershipFilter
+{
+public:
+    virtual ~MembershipFilter() = default;
+
+
+    // mightContain() returns false if the element with the given hash was
+    // certainly not one of those the filter was built from, true if it
+    // might have been.
+    virtual bool mightContain(std::uint64_t hash) const = 0;
+
+
+    // memoryUsage() returns the number of bytes the filter takes up.
+    virtual std::size_t memoryUsage() const = 0;
+};
+
+
+
+#endif // MEMBERSHIPFILTER_HPP
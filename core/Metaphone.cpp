@@ -0,0 +1,223 @@
+// Metaphone.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <cctype>
+#include "Metaphone.hpp"
+
+
+
+namespace
+{
+    bool isVowel(char c)
+    {
+        return c == 'A' || c == 'E' || c == 'I' || c == 'O' || c == 'U';
+    }
+
+
+    bool isFrontVowel(char c)
+    {
+        return c == 'E' || c == 'I' || c == 'Y';
+    }
+}
+
+
+
+std::string Metaphone::key(std::string_view word)
+{
+    std::string letters;
+    letters.reserve(word.size());
+
+    for (char c : word)
+    {
+        if (std::isalpha(static_cast<unsigned char>(c)))
+        {
+            letters.push_back(std::toupper(static_cast<unsigned char>(c)));
+        }
+    }
+
+    const std::string::size_type n = letters.size();
+    std::string key;
+
+    if (n == 0)
+    {
+        return key;
+    }
+
+    // at(i) is the letter at index i, or '\0' past either end.
+    auto at = [&letters, n](std::string::size_type i)
+    {
+        return i < n ? letters[i] : '\0';
+    };
+
+    // A few beginnings have a silent first letter, or sound unlike the
+    // rules below would make them.
+    std::string_view start{letters.data(), n < 2 ? n : 2};
+    std::string::size_type first = 0;
+
+    if (start == "AE" || start == "GN" || start == "KN" || start == "PN" || start == "WR")
+    {
+        first = 1;
+    }
+    else if (start[0] == 'X')
+    {
+        key.push_back('S');
+        first = 1;
+    }
+    else if (start == "WH")
+    {
+        key.push_back('W');
+        first = 2;
+    }
+
+    for (std::string::size_type i = first; i < n; ++i)
+    {
+        char c = letters[i];
+        char previous = i > 0 ? letters[i - 1] : '\0';
+        char next = at(i + 1);
+        char afterNext = at(i + 2);
+
+        // Doubled letters count once, except for C, as in ACCEPT.
+        if (c == previous && c != 'C')
+        {
+            continue;
+        }
+
+        switch (c)
+        {
+        case 'A': case 'E': case 'I': case 'O': case 'U':
+            if (i == first)
+            {
+                key.push_back(c);
+            }
+            break;
+
+        case 'B':
+            // Silent in a final MB, as in THUMB.
+            if (!(previous == 'M' && i + 1 == n))
+            {
+                key.push_back('B');
+            }
+            break;
+
+        case 'C':
+            if (next == 'I' && afterNext == 'A')
+            {
+                key.push_back('X');
+            }
+            else if (next == 'H')
+            {
+                key.push_back(previous == 'S' ? 'K' : 'X');
+            }
+            else if (isFrontVowel(next))
+            {
+                // Silent in SCI, SCE, and SCY, as in SCIENCE.
+                if (previous != 'S')
+                {
+                    key.push_back('S');
+                }
+            }
+            else
+            {
+                key.push_back('K');
+            }
+            break;
+
+        case 'D':
+            key.push_back(next == 'G' && isFrontVowel(afterNext) ? 'J' : 'T');
+            break;
+
+        case 'G':
+            // Silent in GH, unless it ends the word or comes before a
+            // vowel, as in NIGHT; in DGE, DGI, and DGY, as in EDGE, where
+            // the D already made the sound; and in a final GN or GNED, as
+            // in SIGN.
+            if (next == 'H' && i + 2 < n && !isVowel(afterNext))
+            {
+                break;
+            }
+            else if (previous == 'D' && isFrontVowel(next))
+            {
+                break;
+            }
+            else if (next == 'N' && (i + 2 == n || (i + 4 == n && letters.compare(i + 1, 3, "NED") == 0)))
+            {
+                break;
+            }
+
+            key.push_back(isFrontVowel(next) && previous != 'G' ? 'J' : 'K');
+            break;
+
+        case 'H':
+            // Only sounded before a vowel, and not after a letter it
+            // combines with, as in PHONE or SHOE.
+            if (isVowel(next) && std::string_view{"CGPST"}.find(previous) == std::string_view::npos)
+            {
+                key.push_back('H');
+            }
+            break;
+
+        case 'K':
+            if (previous != 'C')
+            {
+                key.push_back('K');
+            }
+            break;
+
+        case 'P':
+            key.push_back(next == 'H' ? 'F' : 'P');
+            break;
+
+        case 'Q':
+            key.push_back('K');
+            break;
+
+        case 'S':
+            key.push_back(next == 'H' || (next == 'I' && (afterNext == 'O' || afterNext == 'A')) ? 'X' : 'S');
+            break;
+
+        case 'T':
+            if (next == 'I' && (afterNext == 'O' || afterNext == 'A'))
+            {
+                key.push_back('X');
+            }
+            else if (next == 'H')
+            {
+                key.push_back('0');
+            }
+            else if (!(next == 'C' && afterNext == 'H'))
+            {
+                key.push_back('T');
+            }
+            break;
+
+        case 'V':
+            key.push_back('F');
+            break;
+
+        case 'W':
+        case 'Y':
+            if (isVowel(next))
+            {
+                key.push_back(c);
+            }
+            break;
+
+        case 'X':
+            key.append("KS");
+            break;
+
+        case 'Z':
+            key.push_back('S');
+            break;
+
+        default:
+            // F, J, L, M, N, and R sound like themselves.
+            key.push_back(c);
+            break;
+        }
+    }
+
+    return key;
+}
@@ -0,0 +1,37 @@
+// Metaphone.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A phonetic key for English words, after Lawrence Philips' original
+// Metaphone, so that words that sound alike, however they're spelled,
+// usually have the same key: PHONE and FONE are both FN, KNIGHT and NITE
+// are both NT, SCIENCE and SIENSE are both SNS.  Vowels only count at the
+// start of a word, silent letters (the K in KNIGHT, the GH in RIGHT) are
+// dropped, letters that sound the same become one (C and K are both K
+// when hard, and S when soft), and doubled letters count once.  0 stands
+// for TH.
+//
+// It's not the full Double Metaphone, which also computes an alternative
+// key for words of foreign origin and knows many more special cases, but
+// it needs no tables and is quick to compute.
+
+#ifndef METAPHONE_HPP
+#define METAPHONE_HPP
+
+#include <string>
+#include <string_view>
+
+
+
+namespace Metaphone
+{
+    // key() returns the phonetic key of the given word, ignoring case and
+    // any characters that aren't letters, such as apostrophes.  A word
+    // with no letters has an empty key.
+    std::string key(std::string_view word);
+}
+
+
+
+#endif // METAPHONE_HPP
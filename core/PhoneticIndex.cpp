@@ -0,0 +1,206 @@
+// PhoneticIndex.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <string_view>
+#include <utility>
+#include "EditDistance.hpp"
+#include "Hashing.hpp"
+#include "Metaphone.hpp"
+#include "PhoneticIndex.hpp"
+
+
+
+PhoneticIndex::PhoneticException::PhoneticException(const std::string& reason)
+    : reason_{reason}
+{
+}
+
+
+std::string PhoneticIndex::PhoneticException::reason() const
+{
+    return reason_;
+}
+
+
+PhoneticIndex::PhoneticIndex(std::size_t maxSuggestions)
+    : maxSuggestions_{maxSuggestions}, offsets{0}, bucketMask{0}, finished{false}
+{
+    if (maxSuggestions == 0)
+    {
+        throw PhoneticException{"A PhoneticIndex must find at least one suggestion"};
+    }
+}
+
+
+void PhoneticIndex::addWord(const std::string& word)
+{
+    if (finished)
+    {
+        throw PhoneticException{"Cannot add a word to a PhoneticIndex that has been finished"};
+    }
+
+    std::string key = Metaphone::key(word);
+
+    // A word with no letters can't sound like anything.
+    if (key.empty())
+    {
+        return;
+    }
+
+    arena.insert(arena.end(), word.begin(), word.end());
+    offsets.push_back(arena.size());
+    keyHashes.push_back(Hashing::mixed32(key));
+}
+
+
+void PhoneticIndex::finish()
+{
+    if (finished)
+    {
+        return;
+    }
+
+    // Each word is filed once, so about one bucket per word keeps the
+    // buckets that aren't shared by a key nearly empty.
+    std::size_t bucketCount = 1;
+
+    while (bucketCount < keyHashes.size())
+    {
+        bucketCount *= 2;
+    }
+
+    bucketMask = bucketCount - 1;
+
+    // A counting sort of the word numbers by bucket, as in a SymSpellIndex.
+    bucketStarts.assign(bucketCount + 1, 0);
+
+    for (std::uint32_t hash : keyHashes)
+    {
+        ++bucketStarts[(hash & bucketMask) + 1];
+    }
+
+    for (std::size_t b = 1; b <= bucketCount; ++b)
+    {
+        bucketStarts[b] += bucketStarts[b - 1];
+    }
+
+    entries.resize(keyHashes.size());
+    std::vector<std::uint32_t> next(bucketStarts.begin(), bucketStarts.end() - 1);
+
+    for (std::uint32_t number = 0; number < keyHashes.size(); ++number)
+    {
+        entries[next[keyHashes[number] & bucketMask]++] = number;
+    }
+
+    arena.shrink_to_fit();
+    offsets.shrink_to_fit();
+    keyHashes.shrink_to_fit();
+
+    finished = true;
+}
+
+
+std::vector<std::string> PhoneticIndex::findSuggestions(const std::string& word) const
+{
+    std::vector<std::string> suggestions;
+
+    if (!finished)
+    {
+        return suggestions;
+    }
+
+    std::string key = Metaphone::key(word);
+
+    if (key.empty())
+    {
+        return suggestions;
+    }
+
+    std::uint32_t hash = Hashing::mixed32(key);
+    std::uint32_t b = hash & bucketMask;
+
+    std::vector<std::pair<unsigned int, std::string_view>> found;
+
+    for (std::uint32_t i = bucketStarts[b]; i < bucketStarts[b + 1]; ++i)
+    {
+        std::uint32_t number = entries[i];
+
+        if (keyHashes[number] != hash)
+        {
+            continue;
+        }
+
+        std::string_view candidate{arena.data() + offsets[number], offsets[number + 1] - offsets[number]};
+
+        // Sound-alikes can be any number of edits apart, so the distance
+        // is only limited by the longer of the two words.
+        unsigned int limit = std::max(word.size(), candidate.size());
+        found.emplace_back(EditDistance::distance(word, candidate, limit), candidate);
+    }
+
+    // A word added more than once comes out of this more than once.
+    std::sort(found.begin(), found.end());
+    found.erase(std::unique(found.begin(), found.end()), found.end());
+
+    std::size_t count = std::min(found.size(), maxSuggestions_);
+    suggestions.reserve(count);
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        suggestions.emplace_back(found[i].second);
+    }
+
+    return suggestions;
+}
+
+
+std::size_t PhoneticIndex::memoryUsage() const
+{
+    return arena.capacity() * sizeof(char)
+        + offsets.capacity() * sizeof(std::uint32_t)
+        + keyHashes.capacity() * sizeof(std::uint32_t)
+        + bucketStarts.capacity() * sizeof(std::uint32_t)
+        + entries.capacity() * sizeof(std::uint32_t);
+}
+
+
+std::size_t PhoneticIndex::maxSuggestions() const
+{
+    return maxSuggestions_;
+}
+
+
+std::size_t PhoneticIndex::wordCount() const
+{
+    return offsets.size() - 1;
+}
+
+
+std::size_t PhoneticIndex::keyCount() const
+{
+    std::vector<std::uint32_t> distinct{keyHashes};
+    std::sort(distinct.begin(), distinct.end());
+    return std::unique(distinct.begin(), distinct.end()) - distinct.begin();
+}
+
+
+std::size_t PhoneticIndex::largestBucket() const
+{
+    std::size_t largest = 0;
+
+    for (std::size_t b = 0; finished && b + 1 < bucketStarts.size(); ++b)
+    {
+        largest = std::max<std::size_t>(largest, bucketStarts[b + 1] - bucketStarts[b]);
+    }
+
+    return largest;
+}
+
+
+bool PhoneticIndex::isFinished() const
+{
+    return finished;
+}
@@ -0,0 +1,119 @@
+// PhoneticIndex.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A PhoneticIndex is a SuggestionStrategy that finds the dictionary words
+// that sound like a misspelled word, which is how many misspellings are
+// made (NOLIJ for KNOWLEDGE, FIZIKS for PHYSICS) and which edit distance
+// handles poorly, since they're often several edits from the word that
+// was meant.  Each word's Metaphone key is computed once, when the word is
+// added, and the words are filed by the hash of their keys, so finding the
+// sound-alikes of a word takes computing its key and looking up a single
+// bucket.  They're returned closest (by edit distance) first, and only so
+// many of them, since a key can be shared by dozens of words (58, at most,
+// in wordset.txt).
+//
+// The layout is a SymSpellIndex's: the words are stored back-to-back in
+// one array of characters, and the buckets are ranges of one array of word
+// numbers, chosen by hash.  Rather than the keys, each word's full 32-bit
+// key hash is kept, which weeds out words that only share a bucket.
+
+#ifndef PHONETICINDEX_HPP
+#define PHONETICINDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "SuggestionStrategy.hpp"
+
+
+
+class PhoneticIndex : public SuggestionStrategy
+{
+public:
+    // A PhoneticException is thrown when an index is asked for no
+    // suggestions, or when a word is added after it has been finished.
+    class PhoneticException
+    {
+    public:
+        PhoneticException(const std::string& reason);
+
+        std::string reason() const;
+
+    private:
+        std::string reason_;
+    };
+
+
+public:
+    // Initializes an empty PhoneticIndex that will find no more than the
+    // given number of sound-alikes for each word.
+    explicit PhoneticIndex(std::size_t maxSuggestions = 10);
+
+
+    // addWord() adds a dictionary word, computing its key.  It throws a
+    // PhoneticException if the index has already been finished.
+    virtual void addWord(const std::string& word);
+
+
+    // finish() files every word added into buckets, after which the index
+    // can be searched, but no more words can be added.  Calling finish()
+    // on an index that has already been finished has no effect.
+    virtual void finish();
+
+
+    // findSuggestions() returns the words with the same key as the given
+    // word (including the word itself, if it's a dictionary word), closest
+    // first, with ties in sorted order, up to the index's limit.  A word
+    // with no letters sounds like nothing, and an index that hasn't been
+    // finished finds nothing.
+    virtual std::vector<std::string> findSuggestions(const std::string& word) const;
+
+
+    // memoryUsage() returns the number of bytes taken up by the words,
+    // their key hashes, the buckets, and the word numbers in them.
+    virtual std::size_t memoryUsage() const;
+
+
+    std::size_t maxSuggestions() const;
+
+    // wordCount() returns how many words have been added, not counting
+    // any with no letters.
+    std::size_t wordCount() const;
+
+    // keyCount() returns how many distinct keys the words have, as far as
+    // their hashes can tell.
+    std::size_t keyCount() const;
+
+    // largestBucket() returns the number of words in the largest bucket,
+    // which bounds the work of any one search, or 0 if the index hasn't
+    // been finished.
+    std::size_t largestBucket() const;
+
+    bool isFinished() const;
+
+
+private:
+    std::size_t maxSuggestions_;
+
+    // Word number i occupies arena[offsets[i]] up to but not including
+    // arena[offsets[i + 1]], and its key's hash is keyHashes[i].
+    std::vector<char> arena;
+    std::vector<std::uint32_t> offsets;
+    std::vector<std::uint32_t> keyHashes;
+
+    // Once it's finished, the numbers of the words filed in bucket b are
+    // entries[bucketStarts[b]] up to but not including
+    // entries[bucketStarts[b + 1]].
+    std::vector<std::uint32_t> bucketStarts;
+    std::vector<std::uint32_t> entries;
+    std::uint32_t bucketMask;
+
+    bool finished;
+};
+
+
+
+#endif // PHONETICINDEX_HPP
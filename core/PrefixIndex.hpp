@@ -0,0 +1,36 @@
+// PrefixIndex.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// The PrefixIndex class is an abstract base class for Sets of strings that
+// can find every prefix of a string that's a word in a single walk, the
+// way a trie can.  A WordChecker whose Set is also a PrefixIndex uses this
+// when splitting a misspelled word in two: rather than looking up both
+// halves at every position, it walks the word once to find where the
+// first half is a word, and only looks up the second half there.
+
+#ifndef PREFIXINDEX_HPP
+#define PREFIXINDEX_HPP
+
+#include <string>
+#include <vector>
+
+
+
+class PrefixIndex
+{
+public:
+    virtual ~PrefixIndex() = default;
+
+
+    // findWordPrefixes() appends to lengths the length of every nonempty
+    // prefix of the given string (the string itself included) that's a
+    // word, shortest first.
+    virtual void findWordPrefixes(
+        const std::string& s, std::vector<std::string::size_type>& lengths) const = 0;
+};
+
+
+
+#endif // PREFIXINDEX_HPP
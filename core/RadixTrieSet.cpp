@@ -0,0 +1,255 @@
+// RadixTrieSet.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include "RadixTrieSet.hpp"
+
+
+
+namespace
+{
+    // Orders a child node by the first character of its label, which is
+    // how the children of every node are sorted.
+    template <typename NodePtr>
+    bool precedes(NodePtr node, char c)
+    {
+        return static_cast<unsigned char>(node->label[0]) < static_cast<unsigned char>(c);
+    }
+}
+
+
+
+RadixTrieSet::Cursor::Cursor(const Node* node)
+    : node{node}, offset{0}
+{
+}
+
+
+bool RadixTrieSet::Cursor::advance(char c)
+{
+    if (offset < node->label.size())
+    {
+        if (node->label[offset] != c)
+        {
+            return false;
+        }
+
+        ++offset;
+        return true;
+    }
+
+    const Node* child = findChild(node, c);
+
+    if (child == nullptr)
+    {
+        return false;
+    }
+
+    node = child;
+    offset = 1;
+    return true;
+}
+
+
+bool RadixTrieSet::Cursor::advance(const char* begin, const char* end)
+{
+    for (const char* p = begin; p != end; ++p)
+    {
+        if (!advance(*p))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+
+bool RadixTrieSet::Cursor::isWord() const
+{
+    return offset == node->label.size() && node->isWord;
+}
+
+
+
+RadixTrieSet::RadixTrieSet()
+    : root{new Node{"", false, {}}}, count{0}
+{
+}
+
+
+RadixTrieSet::~RadixTrieSet()
+{
+    destroyNode(root);
+}
+
+
+RadixTrieSet::RadixTrieSet(const RadixTrieSet& s)
+    : root{copyNode(s.root)}, count{s.count}
+{
+}
+
+
+RadixTrieSet::RadixTrieSet(RadixTrieSet&& s)
+    : root{new Node{"", false, {}}}, count{0}
+{
+    std::swap(root, s.root);
+    std::swap(count, s.count);
+}
+
+
+RadixTrieSet& RadixTrieSet::operator=(const RadixTrieSet& s)
+{
+    if (this != &s)
+    {
+        Node* newRoot = copyNode(s.root);
+        destroyNode(root);
+        root = newRoot;
+        count = s.count;
+    }
+
+    return *this;
+}
+
+
+RadixTrieSet& RadixTrieSet::operator=(RadixTrieSet&& s)
+{
+    std::swap(root, s.root);
+    std::swap(count, s.count);
+    return *this;
+}
+
+
+bool RadixTrieSet::isImplemented() const
+{
+    return true;
+}
+
+
+void RadixTrieSet::add(const std::string& element)
+{
+    Node* node = root;
+    std::string::size_type i = 0;
+
+    while (i < element.size())
+    {
+        auto it = std::lower_bound(
+            node->children.begin(), node->children.end(), element[i], precedes<Node*>);
+
+        if (it == node->children.end() || (*it)->label[0] != element[i])
+        {
+            // Nothing continues this prefix yet, so the rest of the element
+            // becomes a single new leaf.
+            node->children.insert(it, new Node{element.substr(i), true, {}});
+            ++count;
+            return;
+        }
+
+        Node* child = *it;
+
+        std::string::size_type common = 1;
+
+        while (common < child->label.size() && i + common < element.size()
+               && child->label[common] == element[i + common])
+        {
+            ++common;
+        }
+
+        if (common < child->label.size())
+        {
+            // The element diverges (or ends) partway through the child's
+            // label, so the label is split and a new node is placed at the
+            // point of divergence.
+            Node* middle = new Node{child->label.substr(0, common), false, {child}};
+            child->label.erase(0, common);
+            *it = middle;
+            child = middle;
+        }
+
+        node = child;
+        i += common;
+    }
+
+    if (!node->isWord)
+    {
+        node->isWord = true;
+        ++count;
+    }
+}
+
+
+bool RadixTrieSet::contains(const std::string& element) const
+{
+    Cursor c = cursor();
+    return c.advance(element.data(), element.data() + element.size()) && c.isWord();
+}
+
+
+unsigned int RadixTrieSet::size() const
+{
+    return count;
+}
+
+
+void RadixTrieSet::findWordPrefixes(
+    const std::string& s, std::vector<std::string::size_type>& lengths) const
+{
+    Cursor c = cursor();
+
+    for (std::string::size_type i = 0; i < s.length() && c.advance(s[i]); ++i)
+    {
+        if (c.isWord())
+        {
+            lengths.push_back(i + 1);
+        }
+    }
+}
+
+
+RadixTrieSet::Cursor RadixTrieSet::cursor() const
+{
+    return Cursor{root};
+}
+
+
+const RadixTrieSet::Node* RadixTrieSet::findChild(const Node* node, char c)
+{
+    auto it = std::lower_bound(
+        node->children.begin(), node->children.end(), c, precedes<const Node*>);
+
+    if (it != node->children.end() && (*it)->label[0] == c)
+    {
+        return *it;
+    }
+    else
+    {
+        return nullptr;
+    }
+}
+
+
+RadixTrieSet::Node* RadixTrieSet::copyNode(const Node* node)
+{
+    Node* copy = new Node{node->label, node->isWord, {}};
+    copy->children.reserve(node->children.size());
+
+    for (const Node* child : node->children)
+    {
+        copy->children.push_back(copyNode(child));
+    }
+
+    return copy;
+}
+
+
+void RadixTrieSet::destroyNode(Node* node)
+{
+    for (Node* child : node->children)
+    {
+        destroyNode(child);
+    }
+
+    delete node;
+}
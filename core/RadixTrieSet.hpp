@@ -0,0 +1,143 @@
+// RadixTrieSet.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A RadixTrieSet is an implementation of a Set of strings that is a
+// compressed (Patricia) trie.  Each node is labeled with the run of
+// characters leading into it from its parent, so chains of nodes with
+// only one child are collapsed into a single node; a node is marked as
+// a word if the characters along the path from the root spell a word in
+// the set.
+//
+// Besides the usual Set operations, a RadixTrieSet hands out Cursors,
+// which represent a position partway through the trie.  A Cursor can be
+// advanced one character at a time and copied freely, which lets the
+// WordChecker share the walk over a common prefix among many candidate
+// suggestions, and skip every candidate whose prefix leads nowhere.
+
+#ifndef RADIXTRIESET_HPP
+#define RADIXTRIESET_HPP
+
+#include <string>
+#include <vector>
+#include "PrefixIndex.hpp"
+#include "Set.hpp"
+
+
+
+class RadixTrieSet : public Set<std::string>, public PrefixIndex
+{
+private:
+    struct Node;
+
+
+public:
+    // A Cursor is a position in a RadixTrieSet, reached by following some
+    // prefix from the root.  Cursors are only valid as long as the set they
+    // came from is not modified.
+    class Cursor
+    {
+    public:
+        // advance() moves the cursor past the given character, returning
+        // true if some word in the set continues the prefix this way.  If
+        // it returns false, the cursor is left where it was.
+        bool advance(char c);
+
+        // advance() moves the cursor past every character in the given
+        // range, returning false (with the cursor left partway) as soon as
+        // no word in the set continues the prefix.
+        bool advance(const char* begin, const char* end);
+
+        // isWord() returns true if the prefix followed so far is itself a
+        // word in the set.
+        bool isWord() const;
+
+    private:
+        friend class RadixTrieSet;
+
+        explicit Cursor(const Node* node);
+
+        const Node* node;
+        unsigned int offset;
+    };
+
+
+public:
+    // Initializes a RadixTrieSet to be empty.
+    RadixTrieSet();
+
+    // Cleans up the RadixTrieSet so that it leaks no memory.
+    virtual ~RadixTrieSet();
+
+    // Initializes a new RadixTrieSet to be a copy of an existing one.
+    RadixTrieSet(const RadixTrieSet& s);
+
+    // Initializes a new RadixTrieSet whose contents are moved from an
+    // expiring one.
+    RadixTrieSet(RadixTrieSet&& s);
+
+    // Assigns an existing RadixTrieSet into another.
+    RadixTrieSet& operator=(const RadixTrieSet& s);
+
+    // Assigns an expiring RadixTrieSet into another.
+    RadixTrieSet& operator=(RadixTrieSet&& s);
+
+
+    virtual bool isImplemented() const;
+
+
+    // add() adds an element to the set.  If the element is already in the
+    // set, this function has no effect.  This function runs in time
+    // proportional to the length of the element, plus the number of
+    // children of each node visited along the way.
+    virtual void add(const std::string& element);
+
+
+    // contains() returns true if the given element is already in the set,
+    // false otherwise.  Like add(), it runs in time proportional to the
+    // length of the element, regardless of how many elements are stored.
+    virtual bool contains(const std::string& element) const;
+
+
+    // size() returns the number of elements in the set.
+    virtual unsigned int size() const;
+
+
+    // findWordPrefixes() appends to lengths the length of every nonempty
+    // prefix of the given string that's an element, shortest first, by
+    // following a Cursor along it.
+    virtual void findWordPrefixes(
+        const std::string& s, std::vector<std::string::size_type>& lengths) const;
+
+
+    // cursor() returns a Cursor positioned at the root of the trie (i.e.,
+    // having followed the empty prefix).
+    Cursor cursor() const;
+
+
+private:
+    struct Node
+    {
+        std::string label;
+        bool isWord;
+
+        // Children are kept sorted by the first character of their labels;
+        // no two children share a first character.
+        std::vector<Node*> children;
+    };
+
+
+    Node* root;
+    unsigned int count;
+
+
+private:
+    static const Node* findChild(const Node* node, char c);
+    static Node* copyNode(const Node* node);
+    static void destroyNode(Node* node);
+};
+
+
+
+#endif // RADIXTRIESET_HPP
@@ -0,0 +1,207 @@
+// SortedArraySet.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <cstring>
+#include "SortedArraySet.hpp"
+
+
+
+SortedArraySet::SortedArrayException::SortedArrayException(const std::string& reason)
+    : reason_{reason}
+{
+}
+
+
+std::string SortedArraySet::SortedArrayException::reason() const
+{
+    return reason_;
+}
+
+
+
+SortedArraySet::SortedArraySet()
+    : offsets{0}, finished{false}
+{
+}
+
+
+bool SortedArraySet::isImplemented() const
+{
+    return true;
+}
+
+
+void SortedArraySet::add(const std::string& element)
+{
+    if (finished)
+    {
+        throw SortedArrayException{"Cannot add to a SortedArraySet that has been finished"};
+    }
+
+    if (!prefixes.empty())
+    {
+        int order = compareAt(prefixes.size() - 1, element);
+
+        if (order > 0)
+        {
+            std::string previous{arena.data() + offsets[offsets.size() - 2], arena.data() + arena.size()};
+
+            throw SortedArrayException{"Elements must be added to a SortedArraySet in sorted order: "
+                                       + element + " follows " + previous};
+        }
+        else if (order == 0)
+        {
+            return;
+        }
+    }
+
+    arena.insert(arena.end(), element.begin(), element.end());
+    offsets.push_back(arena.size());
+    prefixes.push_back(packPrefix(element));
+}
+
+
+bool SortedArraySet::contains(const std::string& element) const
+{
+    std::uint64_t prefix = packPrefix(element);
+    std::size_t first = lowerBound(prefix);
+
+    if (first == prefixes.size() || prefixes[first] != prefix)
+    {
+        return false;
+    }
+
+    // Nearly always, only one element has these first 8 characters, but a
+    // long run of them (say, every word beginning with "INTERNAT") is
+    // searched in the arena.
+    std::size_t last = element.size() < 8 ? first + 1 : upperBound(prefix);
+
+    while (first + 1 < last)
+    {
+        std::size_t middle = first + (last - first) / 2;
+
+        if (compareAt(middle, element) <= 0)
+        {
+            first = middle;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+
+    return compareAt(first, element) == 0;
+}
+
+
+unsigned int SortedArraySet::size() const
+{
+    return prefixes.size();
+}
+
+
+void SortedArraySet::finish()
+{
+    if (!finished)
+    {
+        arena.shrink_to_fit();
+        offsets.shrink_to_fit();
+        prefixes.shrink_to_fit();
+        finished = true;
+    }
+}
+
+
+bool SortedArraySet::isFinished() const
+{
+    return finished;
+}
+
+
+std::size_t SortedArraySet::memoryUsage() const
+{
+    return arena.capacity() * sizeof(char)
+        + offsets.capacity() * sizeof(std::uint32_t)
+        + prefixes.capacity() * sizeof(std::uint64_t);
+}
+
+
+int SortedArraySet::compareAt(std::size_t i, const std::string& s) const
+{
+    std::size_t length = offsets[i + 1] - offsets[i];
+    int c = std::memcmp(arena.data() + offsets[i], s.data(), std::min(length, s.size()));
+
+    if (c != 0)
+    {
+        return c;
+    }
+
+    return length < s.size() ? -1 : (length > s.size() ? 1 : 0);
+}
+
+
+std::uint64_t SortedArraySet::packPrefix(const std::string& s)
+{
+    // The first character goes in the most significant byte, and missing
+    // characters are zero, so shorter strings sort before longer ones that
+    // begin the same way.
+    std::uint64_t prefix = 0;
+
+    for (std::string::size_type i = 0; i < 8; ++i)
+    {
+        unsigned char c = i < s.size() ? s[i] : 0;
+        prefix = (prefix << 8) | c;
+    }
+
+    return prefix;
+}
+
+
+// Both searches keep the answer within [base, base + n]; each step halves n
+// and moves base forward or not according to a single comparison, which
+// compiles to a conditional move.  The loop runs the same number of times
+// for every prefix.
+
+std::size_t SortedArraySet::lowerBound(std::uint64_t prefix) const
+{
+    if (prefixes.empty())
+    {
+        return 0;
+    }
+
+    const std::uint64_t* base = prefixes.data();
+    std::size_t n = prefixes.size();
+
+    while (n > 1)
+    {
+        std::size_t half = n / 2;
+        base = base[half] < prefix ? base + half : base;
+        n -= half;
+    }
+
+    return (base - prefixes.data()) + (*base < prefix);
+}
+
+
+std::size_t SortedArraySet::upperBound(std::uint64_t prefix) const
+{
+    if (prefixes.empty())
+    {
+        return 0;
+    }
+
+    const std::uint64_t* base = prefixes.data();
+    std::size_t n = prefixes.size();
+
+    while (n > 1)
+    {
+        std::size_t half = n / 2;
+        base = base[half] <= prefix ? base + half : base;
+        n -= half;
+    }
+
+    return (base - prefixes.data()) + (*base <= prefix);
+}
@@ -0,0 +1,119 @@
+// SortedArraySet.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A SortedArraySet is an implementation of a Set of strings that is about
+// as simple and compact as a read-only dictionary can be: the elements are
+// stored in sorted order, back-to-back in one array of characters (the
+// "arena"), with a parallel array of offsets marking where each begins.
+// There are no per-element allocations and no pointers to follow.
+//
+// Searching the arena directly would mean a string comparison, and a jump
+// to somewhere unpredictable in the arena, at every step.  So alongside it
+// the set keeps a dense array holding the first 8 characters of each
+// element, packed into a 64-bit integer so that comparing two integers
+// orders them the same way as comparing the characters would.  A lookup
+// binary searches that array first; the search is written so that each
+// step chooses its next position with a conditional move instead of a
+// branch, leaving nothing for the processor to mispredict.  Only elements
+// whose first 8 characters all match need to be compared in the arena,
+// and only when the element being looked up is at least 8 characters long.
+//
+// As with a DafsaSet, elements must be added in sorted order, which is how
+// they appear in the word set files; each one is appended to the arrays as
+// it arrives, so loading a word set is a single pass over it.
+
+#ifndef SORTEDARRAYSET_HPP
+#define SORTEDARRAYSET_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Set.hpp"
+
+
+
+class SortedArraySet : public Set<std::string>
+{
+public:
+    // A SortedArrayException is thrown when an element is added out of
+    // order or after the set has been finished.
+    class SortedArrayException
+    {
+    public:
+        SortedArrayException(const std::string& reason);
+
+        std::string reason() const;
+
+    private:
+        std::string reason_;
+    };
+
+
+public:
+    // Initializes a SortedArraySet to be empty and ready to have elements
+    // added.
+    SortedArraySet();
+
+
+    virtual bool isImplemented() const;
+
+
+    // add() adds an element to the set.  Elements must be added in sorted
+    // order; adding the element most recently added again has no effect,
+    // while adding anything smaller than it throws a SortedArrayException.
+    virtual void add(const std::string& element);
+
+
+    // contains() returns true if the given element is already in the set,
+    // false otherwise.  This is a binary search over the packed prefixes,
+    // followed (for long elements only) by one over the few elements that
+    // share the first 8 characters.
+    virtual bool contains(const std::string& element) const;
+
+
+    // size() returns the number of elements in the set.
+    virtual unsigned int size() const;
+
+
+    // finish() releases any memory the arrays reserved for elements that
+    // were never added, after which no more elements can be added.  Calling
+    // finish() on a set that has already been finished has no effect.
+    void finish();
+
+    // isFinished() returns true if finish() has been called.
+    bool isFinished() const;
+
+
+    // memoryUsage() returns the number of bytes taken up by the arena, the
+    // offsets, and the packed prefixes.
+    std::size_t memoryUsage() const;
+
+
+private:
+    // The element numbered i occupies arena[offsets[i]] up to but not
+    // including arena[offsets[i + 1]]; there is always one extra offset at
+    // the end, so that this works for the last element.
+    std::vector<char> arena;
+    std::vector<std::uint32_t> offsets;
+    std::vector<std::uint64_t> prefixes;
+
+    bool finished;
+
+
+private:
+    static std::uint64_t packPrefix(const std::string& s);
+
+    // compareAt() compares element i with s, returning a negative number,
+    // zero, or a positive number as it's less than, equal to, or greater.
+    int compareAt(std::size_t i, const std::string& s) const;
+
+    std::size_t lowerBound(std::uint64_t prefix) const;
+    std::size_t upperBound(std::uint64_t prefix) const;
+};
+
+
+
+#endif // SORTEDARRAYSET_HPP
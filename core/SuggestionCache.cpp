@@ -0,0 +1,256 @@
+// SuggestionCache.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include "Hashing.hpp"
+#include "SuggestionCache.hpp"
+
+
+
+namespace
+{
+    constexpr unsigned int maxShardCount = 16;
+    constexpr unsigned int minShardCapacity = 64;
+    constexpr std::uint32_t noSlot = ~std::uint32_t{0};
+}
+
+
+
+SuggestionCache::SuggestionCacheException::SuggestionCacheException(const std::string& reason)
+    : reason_{reason}
+{
+}
+
+
+std::string SuggestionCache::SuggestionCacheException::reason() const
+{
+    return reason_;
+}
+
+
+
+SuggestionCache::SuggestionCache(unsigned int capacity)
+    : capacity_{capacity}, shardCount{1},
+      hitCount{0}, missCount{0}, evictionCount{0}
+{
+    if (capacity == 0)
+    {
+        throw SuggestionCacheException{"A SuggestionCache must be able to hold at least one word"};
+    }
+
+    // Small caches aren't worth splitting up, but a large one gets enough
+    // shards that threads seldom contend for a lock.
+    while (2 * shardCount <= maxShardCount && 2 * shardCount * minShardCapacity <= capacity)
+    {
+        shardCount *= 2;
+    }
+
+    shards.reset(new Shard[shardCount]);
+
+    for (unsigned int i = 0; i < shardCount; ++i)
+    {
+        Shard& shard = shards[i];
+        shard.capacity = capacity / shardCount + (i < capacity % shardCount ? 1 : 0);
+        shard.hand = 0;
+
+        // Keeping the table no more than half full keeps the runs of
+        // occupied slots short.
+        std::uint32_t slotCount = 2;
+
+        while (slotCount < 2 * shard.capacity)
+        {
+            slotCount *= 2;
+        }
+
+        shard.slots.assign(slotCount, 0);
+        shard.entries.reserve(shard.capacity);
+    }
+}
+
+
+bool SuggestionCache::find(const std::string& word, std::vector<std::string>& suggestions)
+{
+    std::uint64_t hash = Hashing::mixed64(word);
+    Shard& shard = shardFor(hash);
+
+    {
+        std::lock_guard<std::mutex> lock{shard.mutex};
+        std::uint32_t slot = findSlot(shard, word, hash);
+
+        if (slot != noSlot)
+        {
+            Entry& entry = shard.entries[shard.slots[slot] - 1];
+            entry.referenced = true;
+            suggestions = entry.suggestions;
+
+            hitCount.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+
+    missCount.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+
+
+void SuggestionCache::insert(const std::string& word, const std::vector<std::string>& suggestions)
+{
+    std::uint64_t hash = Hashing::mixed64(word);
+    Shard& shard = shardFor(hash);
+
+    std::lock_guard<std::mutex> lock{shard.mutex};
+
+    // Another thread may have missed on the same word and cached it first.
+    std::uint32_t existing = findSlot(shard, word, hash);
+
+    if (existing != noSlot)
+    {
+        Entry& entry = shard.entries[shard.slots[existing] - 1];
+        entry.suggestions = suggestions;
+        entry.referenced = true;
+        return;
+    }
+
+    if (shard.entries.size() < shard.capacity)
+    {
+        shard.entries.push_back(Entry{word, suggestions, hash, false});
+        insertSlot(shard, hash, shard.entries.size() - 1);
+        return;
+    }
+
+    // Sweep the hand around until it reaches an entry that hasn't been
+    // used since it last passed; that one's evicted, and the new entry
+    // takes its place in the circle.
+    while (shard.entries[shard.hand].referenced)
+    {
+        shard.entries[shard.hand].referenced = false;
+        shard.hand = (shard.hand + 1) % shard.capacity;
+    }
+
+    std::uint32_t position = shard.hand;
+    Entry& victim = shard.entries[position];
+
+    eraseSlot(shard, findSlot(shard, victim.word, victim.hash));
+
+    victim.word = word;
+    victim.suggestions = suggestions;
+    victim.hash = hash;
+    victim.referenced = false;
+
+    insertSlot(shard, hash, position);
+    shard.hand = (shard.hand + 1) % shard.capacity;
+
+    evictionCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+
+unsigned int SuggestionCache::capacity() const
+{
+    return capacity_;
+}
+
+
+unsigned int SuggestionCache::size() const
+{
+    unsigned int total = 0;
+
+    for (unsigned int i = 0; i < shardCount; ++i)
+    {
+        std::lock_guard<std::mutex> lock{shards[i].mutex};
+        total += shards[i].entries.size();
+    }
+
+    return total;
+}
+
+
+unsigned long long SuggestionCache::hits() const
+{
+    return hitCount.load(std::memory_order_relaxed);
+}
+
+
+unsigned long long SuggestionCache::misses() const
+{
+    return missCount.load(std::memory_order_relaxed);
+}
+
+
+unsigned long long SuggestionCache::evictions() const
+{
+    return evictionCount.load(std::memory_order_relaxed);
+}
+
+
+double SuggestionCache::hitRate() const
+{
+    unsigned long long h = hits();
+    unsigned long long lookups = h + misses();
+
+    return lookups == 0 ? 0.0 : double(h) / lookups;
+}
+
+
+SuggestionCache::Shard& SuggestionCache::shardFor(std::uint64_t hash)
+{
+    // The high bits choose the shard, leaving the low bits to choose the
+    // slot within it.
+    return shards[(hash >> 56) & (shardCount - 1)];
+}
+
+
+std::uint32_t SuggestionCache::findSlot(const Shard& shard, const std::string& word, std::uint64_t hash)
+{
+    std::uint32_t mask = shard.slots.size() - 1;
+
+    for (std::uint32_t i = hash & mask; shard.slots[i] != 0; i = (i + 1) & mask)
+    {
+        const Entry& entry = shard.entries[shard.slots[i] - 1];
+
+        if (entry.hash == hash && entry.word == word)
+        {
+            return i;
+        }
+    }
+
+    return noSlot;
+}
+
+
+void SuggestionCache::insertSlot(Shard& shard, std::uint64_t hash, std::uint32_t position)
+{
+    std::uint32_t mask = shard.slots.size() - 1;
+    std::uint32_t i = hash & mask;
+
+    while (shard.slots[i] != 0)
+    {
+        i = (i + 1) & mask;
+    }
+
+    shard.slots[i] = position + 1;
+}
+
+
+void SuggestionCache::eraseSlot(Shard& shard, std::uint32_t slot)
+{
+    // Rather than leaving a marker behind, the entries in the run after
+    // the erased slot are shifted back into the gap wherever that keeps
+    // them reachable from the slot their hash chooses, so that lookups
+    // never have to step over erased slots.
+    std::uint32_t mask = shard.slots.size() - 1;
+    std::uint32_t gap = slot;
+
+    for (std::uint32_t i = (slot + 1) & mask; shard.slots[i] != 0; i = (i + 1) & mask)
+    {
+        std::uint32_t home = shard.entries[shard.slots[i] - 1].hash & mask;
+
+        if (((i - home) & mask) >= ((i - gap) & mask))
+        {
+            shard.slots[gap] = shard.slots[i];
+            gap = i;
+        }
+    }
+
+    shard.slots[gap] = 0;
+}
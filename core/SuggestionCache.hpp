@@ -0,0 +1,131 @@
+// SuggestionCache.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A SuggestionCache remembers the suggestions found for recently seen
+// misspellings, so that a WordChecker using one can skip finding them
+// again when the same misspelling turns up later in a document, as the
+// common ones do many times over.  Looking up a misspelling costs one hash
+// of the word and a probe of a small open-addressing table.
+//
+// The cache holds at most a fixed number of misspellings.  Once it's
+// full, making room for a new one evicts an old one, chosen by the CLOCK
+// algorithm: the entries are arranged in a circle, each with a bit that's
+// set whenever it's used, and a "hand" sweeps around the circle clearing
+// the bits it passes until it reaches an entry whose bit is already clear,
+// which is evicted.  An entry used since the hand last passed it survives
+// another trip around, so misspellings that keep recurring stay cached,
+// much as they would if the least recently used entry were evicted, but
+// without reordering anything on every hit.
+//
+// The cache can be used from several threads at once.  A large one is
+// split into shards by hash, each a separate CLOCK with its own lock, so
+// that threads looking up different misspellings rarely wait for one
+// another.
+
+#ifndef SUGGESTIONCACHE_HPP
+#define SUGGESTIONCACHE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+
+class SuggestionCache
+{
+public:
+    // A SuggestionCacheException is thrown when a cache is asked to hold
+    // nothing at all.
+    class SuggestionCacheException
+    {
+    public:
+        SuggestionCacheException(const std::string& reason);
+
+        std::string reason() const;
+
+    private:
+        std::string reason_;
+    };
+
+
+public:
+    // Initializes an empty cache that will hold the suggestions for up to
+    // the given number of misspellings.
+    explicit SuggestionCache(unsigned int capacity);
+
+
+    // find() copies the suggestions cached for the given word into
+    // suggestions and returns true, if there are any; otherwise, it
+    // returns false, leaving suggestions alone.
+    bool find(const std::string& word, std::vector<std::string>& suggestions);
+
+    // insert() caches the suggestions for the given word, evicting
+    // another word's if the cache is full.
+    void insert(const std::string& word, const std::vector<std::string>& suggestions);
+
+
+    unsigned int capacity() const;
+
+    // size() returns the number of words whose suggestions are cached.
+    unsigned int size() const;
+
+
+    // hits() and misses() return the number of calls to find() that found
+    // suggestions and didn't, respectively; evictions() returns the number
+    // of words evicted to make room for others; and hitRate() returns the
+    // fraction of the calls to find() that were hits (0 if there have been
+    // none).
+    unsigned long long hits() const;
+    unsigned long long misses() const;
+    unsigned long long evictions() const;
+    double hitRate() const;
+
+
+private:
+    struct Entry
+    {
+        std::string word;
+        std::vector<std::string> suggestions;
+        std::uint64_t hash;
+        bool referenced;
+    };
+
+
+    // Each shard is a CLOCK of up to capacity entries, indexed by an
+    // open-addressing table whose slots are 0 if empty or one more than
+    // the position of an entry.
+    struct Shard
+    {
+        std::mutex mutex;
+        std::vector<Entry> entries;
+        std::vector<std::uint32_t> slots;
+        unsigned int capacity;
+        unsigned int hand;
+    };
+
+
+    Shard& shardFor(std::uint64_t hash);
+
+    static std::uint32_t findSlot(const Shard& shard, const std::string& word, std::uint64_t hash);
+    static void insertSlot(Shard& shard, std::uint64_t hash, std::uint32_t position);
+    static void eraseSlot(Shard& shard, std::uint32_t slot);
+
+
+private:
+    unsigned int capacity_;
+    unsigned int shardCount;
+    std::unique_ptr<Shard[]> shards;
+
+    std::atomic<unsigned long long> hitCount;
+    std::atomic<unsigned long long> missCount;
+    std::atomic<unsigned long long> evictionCount;
+};
+
+
+
+#endif // SUGGESTIONCACHE_HPP
@@ -0,0 +1,52 @@
+// SuggestionStrategy.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// The SuggestionStrategy class is an abstract base class for structures
+// that find the dictionary words near a misspelled word by some means
+// other than generating every candidate and looking it up in a Set.  Each
+// is built from its own copy of the dictionary, one word at a time, and
+// then finished; after that, it can be handed to a WordChecker, which asks
+// it for suggestions instead of generating candidates itself.
+
+#ifndef SUGGESTIONSTRATEGY_HPP
+#define SUGGESTIONSTRATEGY_HPP
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+
+
+class SuggestionStrategy
+{
+public:
+    virtual ~SuggestionStrategy() = default;
+
+
+    // addWord() adds a dictionary word.  Adding a word more than once has
+    // no effect beyond adding it once.
+    virtual void addWord(const std::string& word) = 0;
+
+
+    // finish() is called once every word has been added, before the first
+    // call to findSuggestions().  Strategies that are ready to search as
+    // soon as words are added needn't do anything.
+    virtual void finish()
+    {
+    }
+
+
+    // findSuggestions() returns the dictionary words near the given word,
+    // closest first, with ties in sorted order.
+    virtual std::vector<std::string> findSuggestions(const std::string& word) const = 0;
+
+
+    // memoryUsage() returns the number of bytes the strategy takes up.
+    virtual std::size_t memoryUsage() const = 0;
+};
+
+
+
+#endif // SUGGESTIONSTRATEGY_HPP
@@ -0,0 +1,258 @@
+// SymSpellIndex.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <string_view>
+#include <utility>
+#include "BitParallelDistance.hpp"
+#include "Hashing.hpp"
+#include "SymSpellIndex.hpp"
+
+
+
+SymSpellIndex::SymSpellException::SymSpellException(const std::string& reason)
+    : reason_{reason}
+{
+}
+
+
+std::string SymSpellIndex::SymSpellException::reason() const
+{
+    return reason_;
+}
+
+
+
+namespace
+{
+    // Deletes each character of s at or after the given index in turn,
+    // recording the hash of what's left and (if more may be deleted)
+    // recursing on it, then puts the character back.  Starting each
+    // recursion where the last deletion was made means each set of deleted
+    // positions is tried exactly once.  The hashes are finalized, since
+    // their low bits choose the bucket.
+    void hashDeletions(
+        std::string& s, std::string::size_type from, unsigned int remaining,
+        std::vector<std::uint32_t>& hashes)
+    {
+        for (std::string::size_type i = from; i < s.size(); ++i)
+        {
+            char c = s[i];
+            s.erase(i, 1);
+
+            hashes.push_back(Hashing::mixed32(s));
+
+            if (remaining > 1)
+            {
+                hashDeletions(s, i, remaining - 1, hashes);
+            }
+
+            s.insert(i, 1, c);
+        }
+    }
+}
+
+
+
+SymSpellIndex::SymSpellIndex(unsigned int maxDistance)
+    : maxDistance_{maxDistance}, offsets{0}, bucketMask{0}, finished{false}
+{
+    if (maxDistance == 0 || maxDistance > maxSupportedDistance)
+    {
+        throw SymSpellException{
+            "The distance for a SymSpellIndex must be between 1 and "
+            + std::to_string(maxSupportedDistance)};
+    }
+}
+
+
+void SymSpellIndex::addWord(const std::string& word)
+{
+    if (finished)
+    {
+        throw SymSpellException{"Cannot add a word to a SymSpellIndex that has been finished"};
+    }
+
+    std::uint32_t number = offsets.size() - 1;
+
+    arena.insert(arena.end(), word.begin(), word.end());
+    offsets.push_back(arena.size());
+
+    thread_local std::vector<std::uint32_t> hashes;
+    deletionHashes(word, hashes);
+
+    for (std::uint32_t hash : hashes)
+    {
+        pending.push_back((std::uint64_t{hash} << 32) | number);
+    }
+}
+
+
+void SymSpellIndex::finish()
+{
+    if (finished)
+    {
+        return;
+    }
+
+    // About two entries per bucket keeps the buckets small without the
+    // bucket array outgrowing the entries.
+    std::size_t bucketCount = 1;
+
+    while (2 * bucketCount < pending.size())
+    {
+        bucketCount *= 2;
+    }
+
+    bucketMask = bucketCount - 1;
+
+    // A counting sort of the entries by bucket: count each bucket's
+    // entries, turn the counts into starting positions, then place them.
+    bucketStarts.assign(bucketCount + 1, 0);
+
+    for (std::uint64_t p : pending)
+    {
+        ++bucketStarts[((p >> 32) & bucketMask) + 1];
+    }
+
+    for (std::size_t b = 1; b <= bucketCount; ++b)
+    {
+        bucketStarts[b] += bucketStarts[b - 1];
+    }
+
+    entries.resize(pending.size());
+    std::vector<std::uint32_t> next(bucketStarts.begin(), bucketStarts.end() - 1);
+
+    for (std::uint64_t p : pending)
+    {
+        entries[next[(p >> 32) & bucketMask]++] = static_cast<std::uint32_t>(p);
+    }
+
+    pending.clear();
+    pending.shrink_to_fit();
+    arena.shrink_to_fit();
+    offsets.shrink_to_fit();
+
+    finished = true;
+}
+
+
+std::vector<std::string> SymSpellIndex::findSuggestions(const std::string& word) const
+{
+    std::vector<std::string> suggestions;
+
+    if (!finished)
+    {
+        return suggestions;
+    }
+
+    thread_local std::vector<std::uint32_t> hashes;
+    thread_local std::vector<std::uint32_t> candidates;
+
+    deletionHashes(word, hashes);
+    candidates.clear();
+
+    for (std::uint32_t hash : hashes)
+    {
+        std::uint32_t b = hash & bucketMask;
+        candidates.insert(
+            candidates.end(),
+            entries.begin() + bucketStarts[b], entries.begin() + bucketStarts[b + 1]);
+    }
+
+    // The same word is usually filed under several of the deletions.
+    std::sort(candidates.begin(), candidates.end());
+    candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+    // The candidates are checked all at once, which lets the bit-parallel
+    // kernel compare the word against several of them at a time.
+    thread_local std::vector<std::string_view> candidateWords;
+    thread_local std::vector<unsigned int> distances;
+
+    candidateWords.clear();
+
+    for (std::uint32_t number : candidates)
+    {
+        candidateWords.emplace_back(arena.data() + offsets[number], offsets[number + 1] - offsets[number]);
+    }
+
+    distances.resize(candidateWords.size());
+
+    BitParallelDistance::distanceMany(
+        BitParallelDistance::Pattern{word}, candidateWords.data(), candidateWords.size(), distances.data());
+
+    std::vector<std::pair<unsigned int, std::string>> found;
+
+    for (std::size_t i = 0; i < candidateWords.size(); ++i)
+    {
+        if (distances[i] <= maxDistance_)
+        {
+            found.emplace_back(distances[i], std::string{candidateWords[i]});
+        }
+    }
+
+    // A word added more than once comes out of this more than once.
+    std::sort(found.begin(), found.end());
+    found.erase(std::unique(found.begin(), found.end()), found.end());
+
+    suggestions.reserve(found.size());
+
+    for (std::pair<unsigned int, std::string>& f : found)
+    {
+        suggestions.push_back(std::move(f.second));
+    }
+
+    return suggestions;
+}
+
+
+std::size_t SymSpellIndex::memoryUsage() const
+{
+    return arena.capacity() * sizeof(char)
+        + offsets.capacity() * sizeof(std::uint32_t)
+        + pending.capacity() * sizeof(std::uint64_t)
+        + bucketStarts.capacity() * sizeof(std::uint32_t)
+        + entries.capacity() * sizeof(std::uint32_t);
+}
+
+
+unsigned int SymSpellIndex::maxDistance() const
+{
+    return maxDistance_;
+}
+
+
+std::size_t SymSpellIndex::wordCount() const
+{
+    return offsets.size() - 1;
+}
+
+
+std::size_t SymSpellIndex::entryCount() const
+{
+    return finished ? entries.size() : pending.size();
+}
+
+
+bool SymSpellIndex::isFinished() const
+{
+    return finished;
+}
+
+
+void SymSpellIndex::deletionHashes(const std::string& word, std::vector<std::uint32_t>& hashes) const
+{
+    thread_local std::string scratch;
+    scratch.assign(word);
+
+    hashes.clear();
+    hashes.push_back(Hashing::mixed32(scratch));
+    hashDeletions(scratch, 0, maxDistance_, hashes);
+
+    // Deleting different characters often leaves the same string, as when
+    // either of a doubled letter is deleted.
+    std::sort(hashes.begin(), hashes.end());
+    hashes.erase(std::unique(hashes.begin(), hashes.end()), hashes.end());
+}
@@ -0,0 +1,136 @@
+// SymSpellIndex.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A SymSpellIndex is a SuggestionStrategy that finds every dictionary word
+// within a small edit distance (2, by default) of a misspelled word using
+// the "symmetric delete" technique.  Two words within distance k of each
+// other can both be reduced to some common string by deleting no more
+// than k characters from each, since every edit between them (insertion,
+// deletion, replacement, or swap) can be undone by deleting one character
+// from one or both.  So every way of deleting up to k characters from
+// every dictionary word is computed when the index is built, and filed
+// under its hash.  A query computes the deletions of the misspelled word
+// alone, which for a word of length n and k = 2 is about n^2 / 2 strings,
+// and looks each one up; every word filed under any of them is a candidate,
+// checked with an exact edit distance calculation.  Compare that with
+// generating every string within distance 2 of the misspelled word, which
+// is about (54n)^2 / 2 candidates, each needing a lookup.
+//
+// The price is paid when the index is built and in memory: each word of
+// length n is filed under roughly n^2 / 2 deletions.  To keep that
+// manageable, the deletions themselves are never stored, only their
+// hashes, and not even those: the index is an array of buckets, chosen by
+// hash, each holding the numbers of the words filed in it, all laid out
+// back-to-back in one array.  Hash collisions only add candidates that the
+// edit distance check then rejects.  The words themselves are stored
+// back-to-back in one array of characters, as in a SortedArraySet.
+
+#ifndef SYMSPELLINDEX_HPP
+#define SYMSPELLINDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "SuggestionStrategy.hpp"
+
+
+
+class SymSpellIndex : public SuggestionStrategy
+{
+public:
+    // A SymSpellException is thrown when an index is asked to search too
+    // far, or when a word is added after it has been finished.
+    class SymSpellException
+    {
+    public:
+        SymSpellException(const std::string& reason);
+
+        std::string reason() const;
+
+    private:
+        std::string reason_;
+    };
+
+
+public:
+    // The largest distance an index can be built for; the number of
+    // deletions filed for each word grows as its length to that power.
+    static constexpr unsigned int maxSupportedDistance = 3;
+
+
+public:
+    // Initializes an empty SymSpellIndex that will find the words within
+    // the given edit distance (between 1 and maxSupportedDistance).
+    explicit SymSpellIndex(unsigned int maxDistance = 2);
+
+
+    // addWord() adds a dictionary word, computing its deletions.  It throws
+    // a SymSpellException if the index has already been finished.
+    virtual void addWord(const std::string& word);
+
+
+    // finish() files the deletions of every word added into buckets, after
+    // which the index can be searched, but no more words can be added.
+    // Calling finish() on an index that has already been finished has no
+    // effect.
+    virtual void finish();
+
+
+    // findSuggestions() returns every word within the index's edit distance
+    // of the given word (including the word itself, if it's a dictionary
+    // word), closest first, with ties in sorted order.  An index that
+    // hasn't been finished finds nothing.
+    virtual std::vector<std::string> findSuggestions(const std::string& word) const;
+
+
+    // memoryUsage() returns the number of bytes taken up by the words, the
+    // buckets, and the word numbers in them.
+    virtual std::size_t memoryUsage() const;
+
+
+    unsigned int maxDistance() const;
+
+    // wordCount() returns how many words have been added.
+    std::size_t wordCount() const;
+
+    // entryCount() returns how many (deletion, word) pairs the index holds.
+    std::size_t entryCount() const;
+
+    bool isFinished() const;
+
+
+private:
+    unsigned int maxDistance_;
+
+    // Word number i occupies arena[offsets[i]] up to but not including
+    // arena[offsets[i + 1]].
+    std::vector<char> arena;
+    std::vector<std::uint32_t> offsets;
+
+    // Until the index is finished, the hash of each deletion (in the high
+    // 32 bits) alongside the number of the word it came from.
+    std::vector<std::uint64_t> pending;
+
+    // Once it's finished, the numbers of the words filed in bucket b are
+    // entries[bucketStarts[b]] up to but not including
+    // entries[bucketStarts[b + 1]].
+    std::vector<std::uint32_t> bucketStarts;
+    std::vector<std::uint32_t> entries;
+    std::uint32_t bucketMask;
+
+    bool finished;
+
+
+private:
+    // deletionHashes() fills hashes with the distinct hashes of the strings
+    // made by deleting up to maxDistance characters from word (including
+    // the word itself, with none deleted).
+    void deletionHashes(const std::string& word, std::vector<std::uint32_t>& hashes) const;
+};
+
+
+
+#endif // SYMSPELLINDEX_HPP
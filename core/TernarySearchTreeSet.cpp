@@ -0,0 +1,318 @@
+// TernarySearchTreeSet.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include "TernarySearchTreeSet.hpp"
+
+
+
+// A NeighborSearch holds the state of one call to nearNeighbors(): the
+// word being searched around, the prefix followed so far, and one row of
+// the edit distance table for each character of that prefix.  rows[d][j]
+// is the distance between the first d characters of the prefix and the
+// first j characters of the word.
+class TernarySearchTreeSet::NeighborSearch
+{
+public:
+    NeighborSearch(const std::string& word, unsigned int maxDistance)
+        : word{word}, maxDistance{maxDistance}
+    {
+        // With every row's smallest entry within maxDistance, the prefix
+        // can never grow more than maxDistance characters past the word.
+        rows.resize(word.size() + maxDistance + 2, std::vector<unsigned int>(word.size() + 1));
+
+        for (unsigned int j = 0; j <= word.size(); ++j)
+        {
+            rows[0][j] = j;
+        }
+    }
+
+
+    void search(const Node* node)
+    {
+        if (node == nullptr)
+        {
+            return;
+        }
+
+        search(node->lo);
+
+        std::string::size_type depth = prefix.size();
+        prefix.push_back(node->c);
+
+        if (depth + 1 < rows.size() && computeRow(depth + 1))
+        {
+            if (node->isWord && rows[depth + 1][word.size()] <= maxDistance)
+            {
+                neighbors.push_back(prefix);
+            }
+
+            search(node->eq);
+        }
+
+        prefix.pop_back();
+
+        search(node->hi);
+    }
+
+
+    std::vector<std::string> neighbors;
+
+
+private:
+    // Fills in the row for the prefix's last character, returning true if
+    // any entry in it is within maxDistance.
+    bool computeRow(std::string::size_type depth)
+    {
+        const std::vector<unsigned int>& above = rows[depth - 1];
+        std::vector<unsigned int>& row = rows[depth];
+        char c = prefix[depth - 1];
+
+        row[0] = depth;
+        unsigned int smallest = row[0];
+
+        for (std::string::size_type j = 1; j <= word.size(); ++j)
+        {
+            unsigned int substitution = above[j - 1] + (word[j - 1] == c ? 0 : 1);
+            row[j] = std::min({above[j] + 1, row[j - 1] + 1, substitution});
+
+            if (depth >= 2 && j >= 2 && word[j - 2] == c && word[j - 1] == prefix[depth - 2])
+            {
+                row[j] = std::min(row[j], rows[depth - 2][j - 2] + 1);
+            }
+
+            smallest = std::min(smallest, row[j]);
+        }
+
+        return smallest <= maxDistance;
+    }
+
+
+private:
+    const std::string& word;
+    unsigned int maxDistance;
+    std::string prefix;
+    std::vector<std::vector<unsigned int>> rows;
+};
+
+
+
+TernarySearchTreeSet::TernarySearchTreeSet()
+    : root{nullptr}, containsEmpty{false}, count{0}
+{
+}
+
+
+TernarySearchTreeSet::~TernarySearchTreeSet()
+{
+    destroyNode(root);
+}
+
+
+TernarySearchTreeSet::TernarySearchTreeSet(const TernarySearchTreeSet& s)
+    : root{copyNode(s.root)}, containsEmpty{s.containsEmpty}, count{s.count}
+{
+}
+
+
+TernarySearchTreeSet::TernarySearchTreeSet(TernarySearchTreeSet&& s)
+    : root{nullptr}, containsEmpty{false}, count{0}
+{
+    std::swap(root, s.root);
+    std::swap(containsEmpty, s.containsEmpty);
+    std::swap(count, s.count);
+}
+
+
+TernarySearchTreeSet& TernarySearchTreeSet::operator=(const TernarySearchTreeSet& s)
+{
+    if (this != &s)
+    {
+        Node* newRoot = copyNode(s.root);
+        destroyNode(root);
+        root = newRoot;
+        containsEmpty = s.containsEmpty;
+        count = s.count;
+    }
+
+    return *this;
+}
+
+
+TernarySearchTreeSet& TernarySearchTreeSet::operator=(TernarySearchTreeSet&& s)
+{
+    std::swap(root, s.root);
+    std::swap(containsEmpty, s.containsEmpty);
+    std::swap(count, s.count);
+    return *this;
+}
+
+
+bool TernarySearchTreeSet::isImplemented() const
+{
+    return true;
+}
+
+
+void TernarySearchTreeSet::add(const std::string& element)
+{
+    if (element.empty())
+    {
+        if (!containsEmpty)
+        {
+            containsEmpty = true;
+            ++count;
+        }
+
+        return;
+    }
+
+    Node** link = &root;
+    std::string::size_type i = 0;
+
+    while (true)
+    {
+        if (*link == nullptr)
+        {
+            *link = new Node{element[i], false, nullptr, nullptr, nullptr};
+        }
+
+        Node* node = *link;
+
+        if (element[i] < node->c)
+        {
+            link = &node->lo;
+        }
+        else if (element[i] > node->c)
+        {
+            link = &node->hi;
+        }
+        else if (i + 1 < element.size())
+        {
+            link = &node->eq;
+            ++i;
+        }
+        else
+        {
+            if (!node->isWord)
+            {
+                node->isWord = true;
+                ++count;
+            }
+
+            return;
+        }
+    }
+}
+
+
+bool TernarySearchTreeSet::contains(const std::string& element) const
+{
+    if (element.empty())
+    {
+        return containsEmpty;
+    }
+
+    const Node* node = root;
+    std::string::size_type i = 0;
+
+    while (node != nullptr)
+    {
+        if (element[i] < node->c)
+        {
+            node = node->lo;
+        }
+        else if (element[i] > node->c)
+        {
+            node = node->hi;
+        }
+        else if (i + 1 < element.size())
+        {
+            node = node->eq;
+            ++i;
+        }
+        else
+        {
+            return node->isWord;
+        }
+    }
+
+    return false;
+}
+
+
+unsigned int TernarySearchTreeSet::size() const
+{
+    return count;
+}
+
+
+void TernarySearchTreeSet::findWordPrefixes(
+    const std::string& s, std::vector<std::string::size_type>& lengths) const
+{
+    const Node* node = root;
+    std::string::size_type i = 0;
+
+    while (node != nullptr && i < s.size())
+    {
+        if (s[i] < node->c)
+        {
+            node = node->lo;
+        }
+        else if (s[i] > node->c)
+        {
+            node = node->hi;
+        }
+        else
+        {
+            if (node->isWord)
+            {
+                lengths.push_back(i + 1);
+            }
+
+            node = node->eq;
+            ++i;
+        }
+    }
+}
+
+
+std::vector<std::string> TernarySearchTreeSet::nearNeighbors(
+    const std::string& word, unsigned int maxDistance) const
+{
+    NeighborSearch search{word, maxDistance};
+
+    if (containsEmpty && word.size() <= maxDistance)
+    {
+        search.neighbors.push_back("");
+    }
+
+    search.search(root);
+    return search.neighbors;
+}
+
+
+TernarySearchTreeSet::Node* TernarySearchTreeSet::copyNode(const Node* node)
+{
+    if (node == nullptr)
+    {
+        return nullptr;
+    }
+
+    return new Node{
+        node->c, node->isWord, copyNode(node->lo), copyNode(node->eq), copyNode(node->hi)};
+}
+
+
+void TernarySearchTreeSet::destroyNode(Node* node)
+{
+    if (node != nullptr)
+    {
+        destroyNode(node->lo);
+        destroyNode(node->eq);
+        destroyNode(node->hi);
+        delete node;
+    }
+}
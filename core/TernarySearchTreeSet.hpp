@@ -0,0 +1,113 @@
+// TernarySearchTreeSet.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A TernarySearchTreeSet is an implementation of a Set of strings that is
+// a ternary search tree: each node holds one character and has three
+// children, leading to the nodes for smaller characters and larger ones in
+// the same position (as in a binary search tree), and to the nodes for the
+// next position of words that have this character here.  A node is marked
+// as a word if the characters chosen along the way spell one.
+//
+// Besides the usual Set operations, a TernarySearchTreeSet can find every
+// word within a given edit distance of some other string in a single walk
+// of the tree.  The walk carries one row of the edit distance table per
+// character of the prefix it's followed, computing the next row as it
+// steps to a node's middle child; a subtree is skipped as soon as every
+// entry in the row exceeds the distance, since no word below it can come
+// back within range.  Prefixes are shared, so each row is computed once
+// for all of the words that begin with the same prefix.
+
+#ifndef TERNARYSEARCHTREESET_HPP
+#define TERNARYSEARCHTREESET_HPP
+
+#include <string>
+#include <vector>
+#include "PrefixIndex.hpp"
+#include "Set.hpp"
+
+
+
+class TernarySearchTreeSet : public Set<std::string>, public PrefixIndex
+{
+public:
+    // Initializes a TernarySearchTreeSet to be empty.
+    TernarySearchTreeSet();
+
+    // Cleans up the TernarySearchTreeSet so that it leaks no memory.
+    virtual ~TernarySearchTreeSet();
+
+    // Initializes a new TernarySearchTreeSet to be a copy of an existing one.
+    TernarySearchTreeSet(const TernarySearchTreeSet& s);
+
+    // Initializes a new TernarySearchTreeSet whose contents are moved from
+    // an expiring one.
+    TernarySearchTreeSet(TernarySearchTreeSet&& s);
+
+    // Assigns an existing TernarySearchTreeSet into another.
+    TernarySearchTreeSet& operator=(const TernarySearchTreeSet& s);
+
+    // Assigns an expiring TernarySearchTreeSet into another.
+    TernarySearchTreeSet& operator=(TernarySearchTreeSet&& s);
+
+
+    virtual bool isImplemented() const;
+
+
+    // add() adds an element to the set.  If the element is already in the
+    // set, this function has no effect.
+    virtual void add(const std::string& element);
+
+
+    // contains() returns true if the given element is already in the set,
+    // false otherwise.
+    virtual bool contains(const std::string& element) const;
+
+
+    // size() returns the number of elements in the set.
+    virtual unsigned int size() const;
+
+
+    // findWordPrefixes() appends to lengths the length of every nonempty
+    // prefix of the given string that's an element, shortest first, in a
+    // single walk down the tree.
+    virtual void findWordPrefixes(
+        const std::string& s, std::vector<std::string::size_type>& lengths) const;
+
+
+    // nearNeighbors() returns, in sorted order, every element of the set
+    // whose edit distance from the given word is no more than maxDistance.
+    // The edits are inserting, deleting, or replacing a character, or
+    // swapping two adjacent characters (the "optimal string alignment"
+    // form of Damerau-Levenshtein distance), each of which costs 1.
+    std::vector<std::string> nearNeighbors(
+        const std::string& word, unsigned int maxDistance) const;
+
+
+private:
+    struct Node
+    {
+        char c;
+        bool isWord;
+        Node* lo;
+        Node* eq;
+        Node* hi;
+    };
+
+
+    Node* root;
+    bool containsEmpty;
+    unsigned int count;
+
+
+private:
+    static Node* copyNode(const Node* node);
+    static void destroyNode(Node* node);
+
+    class NeighborSearch;
+};
+
+
+
+#endif // TERNARYSEARCHTREESET_HPP
@@ -0,0 +1,117 @@
+// ThreadPool.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include "ThreadPool.hpp"
+
+
+
+ThreadPool::ThreadPool(unsigned int workerCount)
+    : task{nullptr}, count{0}, next{0},
+      active{false}, generation{0}, busy{0}, stopping{false}
+{
+    for (unsigned int i = 0; i < workerCount; ++i)
+    {
+        workers.emplace_back([this]() { work(); });
+    }
+}
+
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        stopping = true;
+    }
+
+    wake.notify_all();
+
+    for (std::thread& worker : workers)
+    {
+        worker.join();
+    }
+}
+
+
+unsigned int ThreadPool::threadCount() const
+{
+    return workers.size() + 1;
+}
+
+
+void ThreadPool::forEach(unsigned int count, const std::function<void(unsigned int)>& task)
+{
+    if (workers.empty() || count <= 1)
+    {
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            task(i);
+        }
+
+        return;
+    }
+
+    std::lock_guard<std::mutex> loopLock{loopMutex};
+
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        this->task = &task;
+        this->count = count;
+        next.store(0, std::memory_order_relaxed);
+        active = true;
+        ++generation;
+    }
+
+    wake.notify_all();
+
+    runIterations();
+
+    // Every iteration has been claimed by now, but workers may still be
+    // finishing the ones they claimed.  Once they've all left, no worker
+    // can join this loop any longer, since it's no longer active.
+    std::unique_lock<std::mutex> lock{mutex};
+    idle.wait(lock, [this]() { return busy == 0; });
+    active = false;
+}
+
+
+void ThreadPool::work()
+{
+    unsigned long long joined = 0;
+
+    while (true)
+    {
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            wake.wait(lock, [&]() { return stopping || (active && generation != joined); });
+
+            if (stopping)
+            {
+                return;
+            }
+
+            joined = generation;
+            ++busy;
+        }
+
+        runIterations();
+
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            --busy;
+        }
+
+        idle.notify_one();
+    }
+}
+
+
+void ThreadPool::runIterations()
+{
+    for (unsigned int i = next.fetch_add(1, std::memory_order_relaxed); i < count;
+         i = next.fetch_add(1, std::memory_order_relaxed))
+    {
+        (*task)(i);
+    }
+}
@@ -0,0 +1,85 @@
+// ThreadPool.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A ThreadPool keeps a fixed number of worker threads waiting to help
+// with parallel loops, so that a loop only costs waking them rather than
+// starting new threads, which matters when the whole loop only takes a
+// few tens of microseconds.  forEach() hands out the loop's iterations one
+// at a time to whichever thread is free, including the calling thread, so
+// threads that fall behind take fewer of them.
+//
+// One loop runs at a time; if several threads call forEach() at once,
+// their loops take turns.
+
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+
+
+class ThreadPool
+{
+public:
+    // Starts the given number of worker threads.  With none, forEach()
+    // runs every iteration on the calling thread.
+    explicit ThreadPool(unsigned int workerCount);
+
+    // Stops the worker threads, waiting for them to finish.
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+
+    // threadCount() returns the number of threads a loop can be spread
+    // across: the workers and the calling thread.
+    unsigned int threadCount() const;
+
+
+    // forEach() calls task(i) for every i from 0 up to but not including
+    // count, spread across the pool's threads, and returns once all of the
+    // calls have returned.  The task must not throw.
+    void forEach(unsigned int count, const std::function<void(unsigned int)>& task);
+
+
+private:
+    void work();
+    void runIterations();
+
+
+private:
+    std::vector<std::thread> workers;
+
+    // Held by forEach() for the whole of a loop, so loops take turns.
+    std::mutex loopMutex;
+
+    // Guards everything below except next, which the threads running a
+    // loop use to claim its iterations.
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable idle;
+
+    const std::function<void(unsigned int)>* task;
+    unsigned int count;
+    std::atomic<unsigned int> next;
+
+    // A loop is active from when forEach() starts it until every worker
+    // that joined it has left; generation counts the loops started, so
+    // that a worker joins each one only once.
+    bool active;
+    unsigned long long generation;
+    unsigned int busy;
+    bool stopping;
+};
+
+
+
+#endif // THREADPOOL_HPP
@@ -6,12 +6,806 @@
 // Replace and/or augment the implementations below as needed to meet
 // the requirements.
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include "CandidateGenerator.hpp"
+#include "Hashing.hpp"
 #include "WordChecker.hpp"
 
 
 
+namespace
+{
+    const std::string lettersAToZ = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+
+    // A SuggestionList appends suggestions to a vector in the order they're
+    // found, skipping any that are already there.  Rather than searching
+    // the vector for each one, it keeps an open-addressing hash table of
+    // positions in the vector, along with each suggestion's hash, so that
+    // strings are only compared when their hashes match.  Slots are chosen
+    // by the low bits of the hash, so it's a finalized one.  The table's
+    // storage is reused from one list to the next on the same thread, so
+    // once it has grown large enough, it allocates nothing.
+    class SuggestionList
+    {
+    public:
+        explicit SuggestionList(std::vector<std::string>& suggestions)
+            : suggestions{suggestions}, table{storage()}, started{false}
+        {
+        }
+
+
+        void add(const std::string& suggestion)
+        {
+            if (isNew(suggestion))
+            {
+                suggestions.push_back(suggestion);
+            }
+        }
+
+
+        void add(std::string&& suggestion)
+        {
+            if (isNew(suggestion))
+            {
+                suggestions.push_back(std::move(suggestion));
+            }
+        }
+
+
+    private:
+        struct Table
+        {
+            // slots[i] is 0 if empty, or one more than a position in the
+            // vector; hashes[p] is the hash of the suggestion at position p.
+            std::vector<std::uint32_t> slots;
+            std::vector<std::uint32_t> hashes;
+        };
+
+
+        static Table& storage()
+        {
+            thread_local Table table;
+            return table;
+        }
+
+
+        // Returns true, and records the suggestion's hash and the position
+        // it's about to take in the vector, if it's not already there.
+        bool isNew(const std::string& suggestion)
+        {
+            if (!started)
+            {
+                table.slots.assign(initialSlots, 0);
+                table.hashes.clear();
+                started = true;
+            }
+
+            std::uint32_t h = Hashing::mixed32(suggestion);
+            std::uint32_t mask = table.slots.size() - 1;
+
+            for (std::uint32_t i = h & mask; table.slots[i] != 0; i = (i + 1) & mask)
+            {
+                std::uint32_t position = table.slots[i] - 1;
+
+                if (table.hashes[position] == h && suggestions[position] == suggestion)
+                {
+                    return false;
+                }
+            }
+
+            table.hashes.push_back(h);
+            insert(h, suggestions.size() + 1);
+
+            // Keeping the table no more than half full keeps the runs of
+            // occupied slots short.
+            if (2 * table.hashes.size() > table.slots.size())
+            {
+                table.slots.assign(2 * table.slots.size(), 0);
+
+                for (std::uint32_t position = 0; position < table.hashes.size(); ++position)
+                {
+                    insert(table.hashes[position], position + 1);
+                }
+            }
+
+            return true;
+        }
+
+
+        void insert(std::uint32_t h, std::uint32_t slot)
+        {
+            std::uint32_t mask = table.slots.size() - 1;
+            std::uint32_t i = h & mask;
+
+            while (table.slots[i] != 0)
+            {
+                i = (i + 1) & mask;
+            }
+
+            table.slots[i] = slot;
+        }
+
+
+    private:
+        static constexpr std::uint32_t initialSlots = 64;
+
+        std::vector<std::string>& suggestions;
+        Table& table;
+        bool started;
+    };
+
+
+    // A CandidateBatch collects candidates so that they can all be looked
+    // up with a single call to Set::containsBatch().  The strings holding
+    // them, and the array of results, are kept from one batch to the next,
+    // so once they've grown large enough, building a batch copies
+    // characters into existing storage without allocating anything.
+    class CandidateBatch
+    {
+    public:
+        CandidateBatch()
+            : count{0}, resultCapacity{0}
+        {
+        }
+
+
+        void clear()
+        {
+            count = 0;
+        }
+
+
+        // next() returns the string to hold the next candidate, which
+        // still holds whatever it held in an earlier batch.
+        std::string& next()
+        {
+            if (count == candidates.size())
+            {
+                candidates.emplace_back();
+            }
+
+            return candidates[count++];
+        }
+
+
+        // lookUp() looks up every candidate in the batch, splitting them
+        // into chunks spread across the given pool's threads if there is
+        // one.  Each chunk's results go into its own part of the array, so
+        // they end up in the same order either way.
+        void lookUp(const Set<std::string>& words, ThreadPool* pool)
+        {
+            if (resultCapacity < count)
+            {
+                resultCapacity = std::max(count, 2 * resultCapacity);
+                results.reset(new bool[resultCapacity]);
+            }
+
+            if (pool == nullptr || pool->threadCount() == 1 || count <= minimumChunkSize)
+            {
+                words.containsBatch(candidates.data(), count, results.get());
+                return;
+            }
+
+            // Chunks too small to be worth a thread aren't split any
+            // further, but otherwise each thread gets about one chunk.
+            struct Chunks
+            {
+                const Set<std::string>& words;
+                const std::string* candidates;
+                bool* results;
+                unsigned int count;
+                unsigned int size;
+            };
+
+            unsigned int threads = pool->threadCount();
+            unsigned int size = std::max(minimumChunkSize, (count + threads - 1) / threads);
+            Chunks chunks{words, candidates.data(), results.get(), count, size};
+
+            pool->forEach(
+                (count + size - 1) / size,
+                [&chunks](unsigned int chunk)
+                {
+                    unsigned int start = chunk * chunks.size;
+                    unsigned int n = std::min(chunks.size, chunks.count - start);
+
+                    chunks.words.containsBatch(chunks.candidates + start, n, chunks.results + start);
+                });
+        }
+
+
+        unsigned int size() const
+        {
+            return count;
+        }
+
+
+        const std::string& candidate(unsigned int i) const
+        {
+            return candidates[i];
+        }
+
+
+        bool found(unsigned int i) const
+        {
+            return results[i];
+        }
+
+
+    private:
+        static constexpr unsigned int minimumChunkSize = 64;
+
+        std::vector<std::string> candidates;
+        unsigned int count;
+
+        std::unique_ptr<bool[]> results;
+        unsigned int resultCapacity;
+    };
+
+
+    // Returns the word with a space inserted before the character at the
+    // given index, allocating only the suggestion itself.
+    std::string splitSuggestion(const std::string& word, std::string::size_type i)
+    {
+        std::string suggestion;
+        suggestion.reserve(word.length() + 1);
+        suggestion.append(word, 0, i).append(1, ' ').append(word, i, std::string::npos);
+        return suggestion;
+    }
+
+
+    // Follows the characters of word starting at the given index, returning
+    // true if the cursor ends up on a word.
+    bool walkRest(RadixTrieSet::Cursor cursor, const std::string& word, std::string::size_type from)
+    {
+        return cursor.advance(word.data() + from, word.data() + word.size())
+            && cursor.isWord();
+    }
+
+
+    // The families of candidates that are generated, one for each of the
+    // algorithms in the project write-up.
+    enum class EditFamily
+    {
+        Split,
+        Swap,
+        Replacement,
+        Deletion,
+        Insertion
+    };
+
+
+    // A CandidateScreen decides which of a misspelled word's candidates are
+    // worth looking up, given a DictionaryProfile; without one, it allows
+    // them all, and its alphabet is the letters A-Z.  It can also be told
+    // not to prune, in which case it only supplies the profile's alphabet.
+    //
+    // It thinks of the word as padded with the start of a word before it
+    // and the end of a word after, so that bigram p is the pair of
+    // characters at positions p and p + 1 of the padded word; character x
+    // of the word itself is at position x + 1.  Every edit removes a
+    // few consecutive bigrams and puts new ones in their place, so a
+    // candidate can only be a word if each of the new bigrams appears in
+    // the dictionary, and each of the word's bigrams that doesn't is among
+    // the ones removed.
+    class CandidateScreen
+    {
+    public:
+        CandidateScreen(const DictionaryProfile* profile, const std::string& word, bool pruning = true)
+            : profile{profile}, word{word}, pruning{pruning},
+              firstMissing{0}, lastMissing{0}, missingCount{0}, pruned_{0}
+        {
+            if (profile == nullptr || !pruning)
+            {
+                return;
+            }
+
+            for (std::string::size_type p = 0; p <= word.length(); ++p)
+            {
+                if (!profile->hasBigram(at(p), at(p + 1)))
+                {
+                    firstMissing = missingCount == 0 ? p : firstMissing;
+                    lastMissing = p;
+                    ++missingCount;
+                }
+            }
+        }
+
+
+        bool isScreening() const
+        {
+            return profile != nullptr;
+        }
+
+
+        const std::string& alphabet() const
+        {
+            return profile != nullptr ? profile->alphabet() : lettersAToZ;
+        }
+
+
+        // Each of these returns true if the candidate made by the edit
+        // they're named for might be a word, counting it as pruned if not.
+
+        bool allowsSplit(std::string::size_type i)
+        {
+            return allows(i, i, {at(i), DictionaryProfile::wordEnd, DictionaryProfile::wordStart, at(i + 1)});
+        }
+
+
+        bool allowsSwap(std::string::size_type x)
+        {
+            return allows(x, x + 2, {at(x), at(x + 2), at(x + 2), at(x + 1), at(x + 1), at(x + 3)});
+        }
+
+
+        bool allowsReplacement(std::string::size_type x, char c)
+        {
+            unsigned int s = DictionaryProfile::symbol(c);
+            return allows(x, x + 1, {at(x), s, s, at(x + 2)});
+        }
+
+
+        bool allowsDeletion(std::string::size_type x)
+        {
+            return allows(x, x + 1, {at(x), at(x + 2)});
+        }
+
+
+        bool allowsInsertion(std::string::size_type x, char c)
+        {
+            unsigned int s = DictionaryProfile::symbol(c);
+            return allows(x, x, {at(x), s, s, at(x + 1)});
+        }
+
+
+        unsigned int pruned() const
+        {
+            return pruned_;
+        }
+
+
+    private:
+        unsigned int at(std::string::size_type p) const
+        {
+            return p == 0 ? DictionaryProfile::wordStart
+                : p > word.length() ? DictionaryProfile::wordEnd
+                : DictionaryProfile::symbol(word[p - 1]);
+        }
+
+
+        // Returns true if the word's missing bigrams all lie between first
+        // and last, and every pair of symbols in added is a bigram.
+        bool allows(
+            std::string::size_type first, std::string::size_type last,
+            std::initializer_list<unsigned int> added)
+        {
+            if (profile == nullptr || !pruning)
+            {
+                return true;
+            }
+
+            bool allowed = missingCount == 0 || (firstMissing >= first && lastMissing <= last);
+
+            for (auto i = added.begin(); allowed && i != added.end(); i += 2)
+            {
+                allowed = profile->hasBigram(*i, *(i + 1));
+            }
+
+            pruned_ += !allowed;
+            return allowed;
+        }
+
+
+    private:
+        const DictionaryProfile* profile;
+        const std::string& word;
+        bool pruning;
+
+        std::string::size_type firstMissing;
+        std::string::size_type lastMissing;
+        unsigned int missingCount;
+
+        unsigned int pruned_;
+    };
+
+
+    // Adds the given family of candidates for the word to the batch, when
+    // they're all to be added, using a CandidateGenerator specialized for
+    // the letters A-Z.
+    void addEveryCandidate(EditFamily family, const std::string& word, CandidateBatch& batch)
+    {
+        auto sink = [&batch](const char* candidate, std::size_t length)
+        {
+            batch.next().assign(candidate, length);
+        };
+
+        switch (family)
+        {
+        case EditFamily::Split:
+            CandidateGenerator<UppercaseLetters, Splits>::generate(word, sink);
+            break;
+
+        case EditFamily::Swap:
+            CandidateGenerator<UppercaseLetters, Swaps>::generate(word, sink);
+            break;
+
+        case EditFamily::Replacement:
+            CandidateGenerator<UppercaseLetters, Replacements>::generate(word, sink);
+            break;
+
+        case EditFamily::Deletion:
+            CandidateGenerator<UppercaseLetters, Deletions>::generate(word, sink);
+            break;
+
+        case EditFamily::Insertion:
+            CandidateGenerator<UppercaseLetters, Insertions>::generate(word, sink);
+            break;
+        }
+    }
+
+
+    // Adds the given family of candidates for the word to the batch,
+    // skipping the ones the screen rules out.  Each is made by editing
+    // candidate, which must hold the word, in place and copying it into
+    // the batch, then undoing the edit, so that no candidate costs an
+    // allocation.  Splits are added as a pair of candidates, the first
+    // word followed by the second, for each split.
+    void addCandidates(
+        EditFamily family, const std::string& word, std::string& candidate, CandidateBatch& batch,
+        CandidateScreen& screen)
+    {
+        if (!screen.isScreening())
+        {
+            addEveryCandidate(family, word, batch);
+            return;
+        }
+
+        switch (family)
+        {
+        case EditFamily::Split:
+            for (std::string::size_type i = 1; i < word.length(); ++i)
+            {
+                if (screen.allowsSplit(i))
+                {
+                    batch.next().assign(word, 0, i);
+                    batch.next().assign(word, i, std::string::npos);
+                }
+            }
+            break;
+
+        case EditFamily::Swap:
+            for (std::string::size_type i = 0; i + 1 < word.length(); ++i)
+            {
+                if (screen.allowsSwap(i))
+                {
+                    std::swap(candidate[i], candidate[i + 1]);
+                    batch.next().assign(candidate);
+                    std::swap(candidate[i], candidate[i + 1]);
+                }
+            }
+            break;
+
+        case EditFamily::Replacement:
+            for (char c : screen.alphabet())
+            {
+                for (std::string::size_type x = 0; x < word.length(); ++x)
+                {
+                    if (screen.allowsReplacement(x, c))
+                    {
+                        candidate[x] = c;
+                        batch.next().assign(candidate);
+                        candidate[x] = word[x];
+                    }
+                }
+            }
+            break;
+
+        case EditFamily::Deletion:
+            for (std::string::size_type i = 0; i < word.length(); ++i)
+            {
+                if (screen.allowsDeletion(i))
+                {
+                    candidate.erase(i, 1);
+                    batch.next().assign(candidate);
+                    candidate.insert(i, 1, word[i]);
+                }
+            }
+            break;
+
+        case EditFamily::Insertion:
+            for (char c : screen.alphabet())
+            {
+                for (std::string::size_type x = 0; x <= word.length(); ++x)
+                {
+                    if (screen.allowsInsertion(x, c))
+                    {
+                        candidate.insert(x, 1, c);
+                        batch.next().assign(candidate);
+                        candidate.erase(x, 1);
+                    }
+                }
+            }
+            break;
+        }
+    }
+
+
+    // Adds the candidates for splitting the word in two to the batch,
+    // returning how many entries of the batch each split takes.  Given a
+    // PrefixIndex, the word is walked through it once to find where the
+    // first half is a word, and only the second half at each of those
+    // positions is added, taking one entry; otherwise, both halves are
+    // added at every position, taking two.
+    unsigned int addSplitCandidates(
+        const PrefixIndex* prefixes, const std::string& word, std::string& candidate,
+        CandidateBatch& batch, CandidateScreen& screen)
+    {
+        if (prefixes == nullptr)
+        {
+            addCandidates(EditFamily::Split, word, candidate, batch, screen);
+            return 2;
+        }
+
+        thread_local std::vector<std::string::size_type> lengths;
+        lengths.clear();
+        prefixes->findWordPrefixes(word, lengths);
+
+        for (std::string::size_type i : lengths)
+        {
+            if (i < word.length() && screen.allowsSplit(i))
+            {
+                batch.next().assign(word, i, std::string::npos);
+            }
+        }
+
+        return 1;
+    }
+
+
+    // Given the batch entry where a split added by addSplitCandidates()
+    // starts, and how many entries each split takes, returns the length of
+    // the split's first word if both of its words were found, or 0 if not.
+    std::string::size_type foundSplit(
+        const std::string& word, const CandidateBatch& batch, unsigned int i, unsigned int stride)
+    {
+        for (unsigned int j = i; j < i + stride; ++j)
+        {
+            if (!batch.found(j))
+            {
+                return 0;
+            }
+        }
+
+        return word.length() - batch.candidate(i + stride - 1).length();
+    }
+
+
+    // Adds a suggestion for every way of splitting the word into two words
+    // to the list, looking each half up in the given set one at a time;
+    // given a PrefixIndex, only the second halves that follow a first half
+    // that's a word are looked up.
+    void addSplitSuggestions(
+        const Set<std::string>& words, const PrefixIndex* prefixes, const std::string& word,
+        SuggestionList& list)
+    {
+        thread_local std::string first;
+        thread_local std::string rest;
+
+        if (prefixes != nullptr)
+        {
+            thread_local std::vector<std::string::size_type> lengths;
+            lengths.clear();
+            prefixes->findWordPrefixes(word, lengths);
+
+            for (std::string::size_type i : lengths)
+            {
+                if (i < word.length() && words.contains(rest.assign(word, i, std::string::npos)))
+                {
+                    list.add(splitSuggestion(word, i));
+                }
+            }
+
+            return;
+        }
+
+        for (std::string::size_type i = 1; i < word.length(); ++i)
+        {
+            first.assign(word, 0, i);
+            rest.assign(word, i, std::string::npos);
+
+            if (words.contains(first) && words.contains(rest))
+            {
+                list.add(splitSuggestion(word, i));
+            }
+        }
+    }
+
+
+    // When suggestions are ranked, each one's score is the logarithm of its
+    // frequency (plus one, so that words with no frequency score 0), less
+    // a penalty for the family of edit that reached it.  The families with
+    // the fewest candidates (swaps and deletions, about one per character,
+    // against 26 per character for replacements and insertions) cost the
+    // least, and each step up in penalty means a word must be about 55
+    // times as frequent (e to the 4th) to outrank one reached by a cheaper
+    // edit.  The families are tried cheapest first, so that the search can
+    // stop as soon as even the most frequent word of any length that the
+    // remaining families could make wouldn't score well enough to make the
+    // cut, which, when a cheap edit finds a reasonably common word, saves
+    // most of the lookups.
+    struct RankedFamily
+    {
+        EditFamily family;
+        double penalty;
+    };
+
+    constexpr RankedFamily rankedFamilies[] = {
+        {EditFamily::Swap, 0.0},
+        {EditFamily::Deletion, 4.0},
+        {EditFamily::Replacement, 8.0},
+        {EditFamily::Insertion, 8.0},
+        {EditFamily::Split, 12.0}};
+
+
+    // Returns the highest frequency of any word that the given family of
+    // edits could make from a word of the given length.
+    std::uint64_t bestFrequencyOf(
+        const WordFrequencies* frequencies, EditFamily family, std::string::size_type length)
+    {
+        if (frequencies == nullptr)
+        {
+            return 0;
+        }
+
+        switch (family)
+        {
+        case EditFamily::Deletion:
+            return length > 0 ? frequencies->maxFrequency(length - 1) : 0;
+
+        case EditFamily::Insertion:
+            return frequencies->maxFrequency(length + 1);
+
+        case EditFamily::Split:
+        {
+            // Both words are shorter than the original.
+            std::uint64_t best = 0;
+
+            for (std::string::size_type n = 1; n < length; ++n)
+            {
+                best = std::max(best, frequencies->maxFrequency(n));
+            }
+
+            return best;
+        }
+
+        default:
+            return frequencies->maxFrequency(length);
+        }
+    }
+
+
+    struct RankedSuggestion
+    {
+        double score;
+        std::string suggestion;
+    };
+
+
+    // Higher scores are better, with ties going to the suggestion that
+    // comes first in sorted order.
+    bool isBetter(const RankedSuggestion& a, const RankedSuggestion& b)
+    {
+        return a.score > b.score || (a.score == b.score && a.suggestion < b.suggestion);
+    }
+
+
+    // A RankedList keeps the best count suggestions offered to it as a
+    // heap with the worst of them on top, so that each offer costs at most
+    // a logarithmic number of comparisons.
+    class RankedList
+    {
+    public:
+        explicit RankedList(unsigned int count)
+            : count{count}
+        {
+        }
+
+
+        bool isFull() const
+        {
+            return heap.size() == count;
+        }
+
+
+        // worstScore() returns the score a suggestion has to beat to make
+        // the list once it's full.
+        double worstScore() const
+        {
+            return heap.front().score;
+        }
+
+
+        void offer(double score, std::string&& suggestion)
+        {
+            // A suggestion reached again, by another edit, can't have
+            // scored better than it did the first time.
+            for (const RankedSuggestion& existing : heap)
+            {
+                if (existing.suggestion == suggestion)
+                {
+                    return;
+                }
+            }
+
+            RankedSuggestion offered{score, std::move(suggestion)};
+
+            if (!isFull())
+            {
+                heap.push_back(std::move(offered));
+                std::push_heap(heap.begin(), heap.end(), isBetter);
+            }
+            else if (isBetter(offered, heap.front()))
+            {
+                std::pop_heap(heap.begin(), heap.end(), isBetter);
+                heap.back() = std::move(offered);
+                std::push_heap(heap.begin(), heap.end(), isBetter);
+            }
+        }
+
+
+        // take() returns the suggestions, best first, leaving the list
+        // empty.
+        std::vector<std::string> take()
+        {
+            std::sort(heap.begin(), heap.end(), isBetter);
+
+            std::vector<std::string> suggestions;
+            suggestions.reserve(heap.size());
+
+            for (RankedSuggestion& ranked : heap)
+            {
+                suggestions.push_back(std::move(ranked.suggestion));
+            }
+
+            heap.clear();
+            return suggestions;
+        }
+
+
+    private:
+        unsigned int count;
+        std::vector<RankedSuggestion> heap;
+    };
+}
+
+
+
 WordChecker::WordChecker(const Set<std::string>& words)
-    : words{words}
+    : words{words},
+      trie{dynamic_cast<const RadixTrieSet*>(&words)},
+      tree{dynamic_cast<const TernarySearchTreeSet*>(&words)},
+      prefixes{dynamic_cast<const PrefixIndex*>(&words)},
+      strategy{nullptr},
+      soundAlikes{nullptr},
+      cache{nullptr},
+      pool{nullptr},
+      parallelLength{0},
+      frequencies{nullptr},
+      rankCount{0},
+      budget{nullptr},
+      completedSearches{0},
+      degradedSearches{0},
+      profile{nullptr},
+      screenedWords{0},
+      prunedCandidates{0}
 {
 }
 
@@ -24,64 +818,582 @@ bool WordChecker::wordExists(const std::string& word) const
 
 std::vector<std::string> WordChecker::findSuggestions(const std::string& word) const
 {
-    std::vector <std::string> suggestions;
-    //add spacing of each part of the string to check if its two strings
-    for(int i =0; i < word.length() -2; i++)
+    bool complete;
+
+    if (cache == nullptr)
+    {
+        return findUncachedSuggestions(word, complete);
+    }
+
+    std::vector<std::string> suggestions;
+
+    if (!cache->find(word, suggestions))
+    {
+        suggestions = findUncachedSuggestions(word, complete);
+
+        if (complete)
+        {
+            cache->insert(word, suggestions);
+        }
+    }
+
+    return suggestions;
+}
+
+
+void WordChecker::useSuggestionStrategy(const SuggestionStrategy* strategy)
+{
+    this->strategy = strategy;
+}
+
+
+void WordChecker::useSuggestionCache(SuggestionCache* cache)
+{
+    this->cache = cache;
+}
+
+
+void WordChecker::useThreadPool(ThreadPool* pool, std::string::size_type minimumLength)
+{
+    this->pool = pool;
+    this->parallelLength = minimumLength;
+}
+
+
+std::vector<std::string> WordChecker::findSuggestions(const std::string& word, unsigned int count) const
+{
+    std::size_t lookedUp;
+    return findSuggestions(word, count, lookedUp);
+}
+
+
+std::vector<std::string> WordChecker::findSuggestions(
+    const std::string& word, unsigned int count, std::size_t& lookedUp) const
+{
+    lookedUp = 0;
+
+    if (count == 0)
     {
-        std::string temp = word;
-        std::string str1 = temp.substr(0,i);
-        std::string str2 = temp.substr(i,word.length()-1);
-        if(wordExists(str1) && wordExists(str2))
-            suggestions.push_back(str1+" "+str2);
+        return {};
     }
-    //try swapping words around to check if the spelling mistake 
-    for(int i = 0; i < word.length(); i ++)
+
+    RankedList ranked{count};
+
+    // bestScores[f] is the best score that anything rankedFamilies[f] or
+    // the families after it find could possibly have.
+    constexpr unsigned int familyCount = std::size(rankedFamilies);
+    double bestScores[familyCount + 1];
+    bestScores[familyCount] = -std::numeric_limits<double>::infinity();
+
+    for (unsigned int f = familyCount; f-- > 0; )
     {
-        std::string temp = word;
-        std::swap(temp[i],temp[i+1]);
-        if(wordExists(temp) && (std::find(suggestions.begin(), suggestions.end(), temp) == suggestions.end()))
-            suggestions.push_back(temp);
+        double best = std::log1p(double(bestFrequencyOf(frequencies, rankedFamilies[f].family, word.length())));
+        bestScores[f] = std::max(best - rankedFamilies[f].penalty, bestScores[f + 1]);
     }
-    //gonna change each char of the string to another letter of alphabet to check
-    std::string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
-    for(int i = 0 ; i < alphabet.length(); i++)
+
+    thread_local std::string candidate;
+    thread_local CandidateBatch batch;
+    CandidateScreen screen{profile, word};
+
+    candidate.reserve(word.length() + 1);
+    candidate.assign(word);
+
+    for (unsigned int f = 0; f < familyCount; ++f)
     {
-        for(int x = 0; x < word.length(); x++)
+        const RankedFamily& family = rankedFamilies[f];
+
+        // Nothing this family (or any after it) finds could beat the
+        // worst of the suggestions already in hand.
+        if (ranked.isFull() && bestScores[f] < ranked.worstScore())
+        {
+            break;
+        }
+
+        batch.clear();
+        unsigned int stride = 1;
+
+        if (family.family == EditFamily::Split)
         {
-            std::string temp = word;
-            temp[x] = alphabet[i];
-            if(wordExists(temp) && (std::find(suggestions.begin(), suggestions.end(), temp) == suggestions.end()))
-                suggestions.push_back(temp);
+            stride = addSplitCandidates(prefixes, word, candidate, batch, screen);
         }
+        else
+        {
+            addCandidates(family.family, word, candidate, batch, screen);
+        }
+
+        batch.lookUp(words, word.length() >= parallelLength ? pool : nullptr);
+
+        lookedUp += batch.size();
+
+        if (family.family == EditFamily::Split)
+        {
+            thread_local std::string first;
+
+            for (unsigned int i = 0; i < batch.size(); i += stride)
+            {
+                if (std::string::size_type length = foundSplit(word, batch, i, stride))
+                {
+                    first.assign(word, 0, length);
+
+                    std::uint64_t frequency = std::min(
+                        frequencyOf(first), frequencyOf(batch.candidate(i + stride - 1)));
+
+                    ranked.offer(
+                        std::log1p(double(frequency)) - family.penalty,
+                        splitSuggestion(word, length));
+                }
+            }
+        }
+        else
+        {
+            for (unsigned int i = 0; i < batch.size(); ++i)
+            {
+                if (batch.found(i))
+                {
+                    ranked.offer(
+                        std::log1p(double(frequencyOf(batch.candidate(i)))) - family.penalty,
+                        std::string{batch.candidate(i)});
+                }
+            }
+        }
+    }
+
+    recordScreening(screen.pruned());
+    return ranked.take();
+}
+
 
+void WordChecker::useRanking(const WordFrequencies* frequencies, unsigned int count)
+{
+    this->frequencies = frequencies;
+    this->rankCount = count;
+}
+
+
+WordChecker::BudgetedSuggestions WordChecker::findSuggestionsWithin(
+    const std::string& word, const SearchBudget& budget) const
+{
+    using Clock = std::chrono::steady_clock;
+    const Clock::time_point deadline = Clock::now() + budget.maxTime;
+
+    BudgetedSuggestions found;
+    SuggestionList list{found.suggestions};
+    ThreadPool* lookupPool = word.length() >= parallelLength ? pool : nullptr;
+
+    // The seeds are every candidate at distance 1, which are looked up
+    // unpruned, since a candidate that can't be a word may still be one
+    // edit away from a word.  The range of seeds each family made is kept,
+    // so that they can be expanded in a different order.
+    thread_local std::string candidate;
+    thread_local CandidateBatch seeds;
+    CandidateScreen seedScreen{profile, word, false};
+
+    candidate.reserve(word.length() + 2);
+    candidate.assign(word);
+    seeds.clear();
+
+    const unsigned int splitStride = addSplitCandidates(prefixes, word, candidate, seeds, seedScreen);
+    const unsigned int splitCount = seeds.size();
+
+    const EditFamily seedFamilies[] = {
+        EditFamily::Swap, EditFamily::Replacement, EditFamily::Deletion, EditFamily::Insertion};
+
+    unsigned int familyEnds[std::size(seedFamilies)];
+
+    for (unsigned int f = 0; f < std::size(seedFamilies); ++f)
+    {
+        addCandidates(seedFamilies[f], word, candidate, seeds, seedScreen);
+        familyEnds[f] = seeds.size();
+    }
+
+    seeds.lookUp(words, lookupPool);
+    found.lookedUp = seeds.size();
+
+    for (unsigned int i = 0; i < splitCount; i += splitStride)
+    {
+        if (std::string::size_type length = foundSplit(word, seeds, i, splitStride))
+        {
+            list.add(splitSuggestion(word, length));
+        }
     }
-    //delete some of the character to check if they added extra character
-    for(int i = 0 ; i < word.length(); i++)
+
+    for (unsigned int i = splitCount; i < seeds.size(); ++i)
     {
-        std::string temp = word;
-        temp.erase(i,1);
-        if(wordExists(temp) && (std::find(suggestions.begin(), suggestions.end(), temp) ==suggestions.end()))
-            suggestions.push_back(temp);
+        if (seeds.found(i))
+        {
+            list.add(seeds.candidate(i));
+        }
+
+        // Replacing a character with itself gives back the word, whose
+        // candidates have just been looked up.
+        found.seedCount += seeds.candidate(i) != word;
     }
-    //inserts characters between each char
-    for(int i = 0 ; i < alphabet.length(); i++)
+
+    // Then each seed is expanded in turn, until they run out or the
+    // budget does.
+    thread_local std::string seedCandidate;
+    thread_local CandidateBatch batch;
+    unsigned int pruned = 0;
+
+    for (const RankedFamily& family : rankedFamilies)
     {
-        for(int x = 0; x < word.length() ; x++)
+        if (!found.completed)
+        {
+            break;
+        }
+        else if (family.family == EditFamily::Split)
+        {
+            continue;
+        }
+
+        unsigned int f = std::find(std::begin(seedFamilies), std::end(seedFamilies), family.family) - seedFamilies;
+
+        for (unsigned int i = f == 0 ? splitCount : familyEnds[f - 1]; i < familyEnds[f]; ++i)
         {
-             std::string temp = word;
-             temp.insert(x,1,alphabet[i]);
-             if(wordExists(temp)&& (std::find(suggestions.begin(), suggestions.end(), temp) == suggestions.end()))
-             suggestions.push_back(temp);
+            const std::string& seed = seeds.candidate(i);
+
+            if (seed == word)
+            {
+                continue;
+            }
+
+            if (budget.maxTime.count() > 0 && Clock::now() >= deadline)
+            {
+                found.completed = false;
+                break;
+            }
+
+            CandidateScreen screen{profile, seed};
+            seedCandidate.assign(seed);
+            batch.clear();
+
+            for (EditFamily seedFamily : seedFamilies)
+            {
+                addCandidates(seedFamily, seed, seedCandidate, batch, screen);
+            }
+
+            pruned += screen.pruned();
+
+            if (budget.maxLookups > 0 && found.lookedUp + batch.size() > budget.maxLookups)
+            {
+                found.completed = false;
+                break;
+            }
+
+            batch.lookUp(words, lookupPool);
+            found.lookedUp += batch.size();
+            ++found.seedsExpanded;
+
+            for (unsigned int j = 0; j < batch.size(); ++j)
+            {
+                if (batch.found(j))
+                {
+                    list.add(batch.candidate(j));
+                }
+            }
         }
+    }
+
+    recordScreening(pruned);
+    (found.completed ? completedSearches : degradedSearches).fetch_add(1, std::memory_order_relaxed);
+
+    return found;
+}
+
+
+void WordChecker::useSearchBudget(const SearchBudget* budget)
+{
+    this->budget = budget;
+}
+
 
-        //add to the end of the word
-        std::string temp = word;
-        temp.insert(temp.end(),1,alphabet[i]);
-        if(wordExists(temp) && (std::find(suggestions.begin(), suggestions.end(), temp) == suggestions.end()))
-            suggestions.push_back(temp);
-   }
+unsigned long long WordChecker::completedSearchCount() const
+{
+    return completedSearches.load(std::memory_order_relaxed);
+}
+
+
+unsigned long long WordChecker::degradedSearchCount() const
+{
+    return degradedSearches.load(std::memory_order_relaxed);
+}
+
+
+void WordChecker::useSoundAlikes(const PhoneticIndex* index)
+{
+    this->soundAlikes = index;
+}
+
+
+void WordChecker::useDictionaryProfile(const DictionaryProfile* profile)
+{
+    this->profile = profile;
+}
 
-   return suggestions;
-} 
 
+unsigned long long WordChecker::screenedWordCount() const
+{
+    return screenedWords.load(std::memory_order_relaxed);
+}
 
+
+unsigned long long WordChecker::prunedCandidateCount() const
+{
+    return prunedCandidates.load(std::memory_order_relaxed);
+}
+
+
+std::vector<std::string> WordChecker::findUncachedSuggestions(const std::string& word, bool& complete) const
+{
+    complete = true;
+
+    if (rankCount > 0)
+    {
+        return findSuggestions(word, rankCount);
+    }
+
+    std::vector<std::string> suggestions;
+
+    if (budget != nullptr)
+    {
+        BudgetedSuggestions found = findSuggestionsWithin(word, *budget);
+        complete = found.completed;
+        suggestions = std::move(found.suggestions);
+    }
+    else if (strategy != nullptr)
+    {
+        suggestions = findSuggestionsWithStrategy(word);
+    }
+    else if (trie != nullptr)
+    {
+        suggestions = findSuggestionsInTrie(word);
+    }
+    else if (tree != nullptr)
+    {
+        suggestions = findSuggestionsInTree(word);
+    }
+    else
+    {
+        suggestions = findSuggestionsByGenerating(word);
+    }
+
+    if (soundAlikes != nullptr)
+    {
+        addSoundAlikes(word, suggestions);
+    }
+
+    return suggestions;
+}
+
+
+std::vector<std::string> WordChecker::findSuggestionsByGenerating(const std::string& word) const
+{
+    std::vector<std::string> suggestions;
+    SuggestionList list{suggestions};
+
+    // The candidates are made in a buffer and copied into a batch that
+    // only grow when a longer word than any before it (on this thread)
+    // comes along.  Once every candidate has been made, they're all looked
+    // up at once, so that the set can overlap the lookups.
+    thread_local std::string candidate;
+    thread_local CandidateBatch batch;
+    CandidateScreen screen{profile, word};
+
+    candidate.reserve(word.length() + 1);
+    candidate.assign(word);
+    batch.clear();
+
+    const unsigned int splitStride = addSplitCandidates(prefixes, word, candidate, batch, screen);
+    const unsigned int splitCount = batch.size();
+
+    for (EditFamily family :
+            {EditFamily::Swap, EditFamily::Replacement, EditFamily::Deletion, EditFamily::Insertion})
+    {
+        addCandidates(family, word, candidate, batch, screen);
+    }
+
+    recordScreening(screen.pruned());
+    batch.lookUp(words, word.length() >= parallelLength ? pool : nullptr);
+
+    for (unsigned int i = 0; i < splitCount; i += splitStride)
+    {
+        if (std::string::size_type length = foundSplit(word, batch, i, splitStride))
+        {
+            list.add(splitSuggestion(word, length));
+        }
+    }
+
+    for (unsigned int i = splitCount; i < batch.size(); ++i)
+    {
+        if (batch.found(i))
+        {
+            list.add(batch.candidate(i));
+        }
+    }
+
+    return suggestions;
+}
+
+
+std::vector<std::string> WordChecker::findSuggestionsWithStrategy(const std::string& word) const
+{
+    std::vector<std::string> suggestions;
+    SuggestionList list{suggestions};
+
+    // Splitting into two words
+    addSplitSuggestions(words, prefixes, word, list);
+
+    for (std::string& nearby : strategy->findSuggestions(word))
+    {
+        list.add(std::move(nearby));
+    }
+
+    return suggestions;
+}
+
+
+void WordChecker::addSoundAlikes(const std::string& word, std::vector<std::string>& suggestions) const
+{
+    // There are only ever a few sound-alikes, so looking for each among
+    // the suggestions already found is cheaper than hashing them all.
+    const std::size_t found = suggestions.size();
+
+    for (std::string& soundAlike : soundAlikes->findSuggestions(word))
+    {
+        if (std::find(suggestions.begin(), suggestions.begin() + found, soundAlike)
+                == suggestions.begin() + found)
+        {
+            suggestions.push_back(std::move(soundAlike));
+        }
+    }
+}
+
+
+std::vector<std::string> WordChecker::findSuggestionsInTrie(const std::string& word) const
+{
+    std::vector<std::string> suggestions;
+    SuggestionList list{suggestions};
+
+    // prefixes[i] is positioned after the first i characters of the word.
+    // Only as many prefixes as the trie actually contains are recorded, so
+    // any candidate whose edit lies beyond the last of them would start
+    // with a prefix no word has and can be skipped outright.
+    thread_local std::vector<RadixTrieSet::Cursor> prefixes;
+    prefixes.assign(1, trie->cursor());
+
+    for (std::string::size_type i = 0; i < word.length(); ++i)
+    {
+        RadixTrieSet::Cursor next = prefixes.back();
+
+        if (!next.advance(word[i]))
+        {
+            break;
+        }
+
+        prefixes.push_back(next);
+    }
+
+    const std::string::size_type reachable = prefixes.size();
+    const std::string& letters = profile != nullptr ? profile->alphabet() : lettersAToZ;
+
+    // Splitting into two words
+    for (std::string::size_type i = 1; i < word.length() && i < reachable; ++i)
+    {
+        if (prefixes[i].isWord() && walkRest(trie->cursor(), word, i))
+        {
+            list.add(splitSuggestion(word, i));
+        }
+    }
+
+    // Swapping adjacent characters
+    for (std::string::size_type i = 0; i + 1 < word.length() && i < reachable; ++i)
+    {
+        RadixTrieSet::Cursor c = prefixes[i];
+
+        if (c.advance(word[i + 1]) && c.advance(word[i]) && walkRest(c, word, i + 2))
+        {
+            std::string suggestion = word;
+            std::swap(suggestion[i], suggestion[i + 1]);
+            list.add(std::move(suggestion));
+        }
+    }
+
+    // Replacing each character
+    for (char letter : letters)
+    {
+        for (std::string::size_type x = 0; x < word.length() && x < reachable; ++x)
+        {
+            RadixTrieSet::Cursor c = prefixes[x];
+
+            if (c.advance(letter) && walkRest(c, word, x + 1))
+            {
+                std::string suggestion = word;
+                suggestion[x] = letter;
+                list.add(std::move(suggestion));
+            }
+        }
+    }
+
+    // Deleting each character
+    for (std::string::size_type i = 0; i < word.length() && i < reachable; ++i)
+    {
+        if (walkRest(prefixes[i], word, i + 1))
+        {
+            std::string suggestion = word;
+            suggestion.erase(i, 1);
+            list.add(std::move(suggestion));
+        }
+    }
+
+    // Inserting a character before each character, and at the end
+    for (char letter : letters)
+    {
+        for (std::string::size_type x = 0; x <= word.length() && x < reachable; ++x)
+        {
+            RadixTrieSet::Cursor c = prefixes[x];
+
+            if (c.advance(letter) && walkRest(c, word, x))
+            {
+                std::string suggestion = word;
+                suggestion.insert(x, 1, letter);
+                list.add(std::move(suggestion));
+            }
+        }
+    }
+
+    return suggestions;
+}
+
+
+std::vector<std::string> WordChecker::findSuggestionsInTree(const std::string& word) const
+{
+    std::vector<std::string> suggestions;
+    SuggestionList list{suggestions};
+
+    // Splitting into two words
+    addSplitSuggestions(*tree, tree, word, list);
+
+    // Every word one swap, replacement, deletion, or insertion away
+    for (std::string& neighbor : tree->nearNeighbors(word, 1))
+    {
+        list.add(std::move(neighbor));
+    }
+
+    return suggestions;
+}
+
+
+std::uint64_t WordChecker::frequencyOf(const std::string& word) const
+{
+    return frequencies != nullptr ? frequencies->frequency(word) : 0;
+}
+
+
+void WordChecker::recordScreening(unsigned int pruned) const
+{
+    if (profile != nullptr)
+    {
+        screenedWords.fetch_add(1, std::memory_order_relaxed);
+        prunedCandidates.fetch_add(pruned, std::memory_order_relaxed);
+    }
+}
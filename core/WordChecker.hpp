@@ -14,14 +14,54 @@
 #ifndef WORDCHECKER_HPP
 #define WORDCHECKER_HPP
 
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <vector>
+#include "DictionaryProfile.hpp"
+#include "PhoneticIndex.hpp"
+#include "PrefixIndex.hpp"
+#include "RadixTrieSet.hpp"
 #include "Set.hpp"
+#include "SuggestionCache.hpp"
+#include "SuggestionStrategy.hpp"
+#include "TernarySearchTreeSet.hpp"
+#include "ThreadPool.hpp"
+#include "WordFrequencies.hpp"
 
 
 
 class WordChecker
 {
+public:
+    // A SearchBudget limits how much work findSuggestionsWithin() does
+    // beyond distance 1: how many candidates it may look up in all, and
+    // how long it may take.  A limit of 0 means there's no limit.
+    struct SearchBudget
+    {
+        std::size_t maxLookups = 0;
+        std::chrono::microseconds maxTime{0};
+    };
+
+
+    // What findSuggestionsWithin() found, and whether it finished the
+    // search at distance 2 or ran out of budget partway (in which case the
+    // search is degraded, though every suggestion at distance 1 is there).
+    // Each of the candidates at distance 1 is a seed, whose own candidates
+    // are the ones at distance 2; seedsExpanded of the seedCount seeds were
+    // expanded before the budget ran out.
+    struct BudgetedSuggestions
+    {
+        std::vector<std::string> suggestions;
+        bool completed = true;
+        std::size_t lookedUp = 0;
+        std::size_t seedsExpanded = 0;
+        std::size_t seedCount = 0;
+    };
+
+
 public:
     // The constructor requires a Set of words to be passed into it.  The
     // WordChecker will store a reference to a const Set, which it will use
@@ -36,12 +76,211 @@ public:
 
     // findSuggestions() returns a vector containing suggested alternative
     // spellings for the given word, using the five algorithms described in
-    // the project write-up.
+    // the project write-up.  When the Set of words is a RadixTrieSet, the
+    // candidates are walked through the trie directly instead, so that every
+    // candidate sharing a prefix that no word begins with is skipped without
+    // a lookup; the suggestions are the same, and in the same order, either
+    // way.  When it's a TernarySearchTreeSet, the swapped, replaced, deleted,
+    // and inserted candidates are all found by a single nearNeighbors() walk
+    // of the tree; the suggestions are the same (as long as every word is
+    // made of the letters A-Z), but those following the split words are in
+    // sorted order.
+    //
+    // Otherwise, every candidate is generated first (by a
+    // CandidateGenerator for the letters A-Z, unless a DictionaryProfile
+    // is screening them), into storage that's reused from one call to the
+    // next, and then they're all looked up with one call to the Set's
+    // containsBatch(), so that a Set that can overlap its lookups gets the
+    // chance.  Apart from the suggestions it returns (and, the first time a
+    // word of some length is checked on a thread, growing that storage),
+    // this allocates no memory.  The TernarySearchTreeSet's walk is the
+    // exception, since it needs room for its edit distance table.
+    //
+    // If a SuggestionStrategy is in use, none of that happens: the split
+    // words are found as usual, followed by the words the strategy finds.
+    //
+    // Whichever way they're found, when the Set is also a PrefixIndex, the
+    // split words are found by walking the word through it once to find
+    // the positions where its first half is a word, and looking up only
+    // the second half at each of them.
     std::vector<std::string> findSuggestions(const std::string& word) const;
 
 
+    // This findSuggestions() returns no more than count suggestions, best
+    // first, ranked by how frequent each word is (according to the
+    // WordFrequencies given to useRanking(), if any) and by how likely the
+    // edit that reached it is to be the typist's mistake.  The families of
+    // candidates are generated and looked up one at a time, most likely
+    // edit first, and the search stops as soon as the families left can't
+    // produce anything that scores better than the count-th best found so
+    // far; the number of candidates that were looked up is stored into
+    // lookedUp.  Neither a SuggestionStrategy nor a SuggestionCache is
+    // consulted, nor is a RadixTrieSet or TernarySearchTreeSet walked; the
+    // candidates are looked up with containsBatch() in every case.
+    std::vector<std::string> findSuggestions(const std::string& word, unsigned int count) const;
+
+    std::vector<std::string> findSuggestions(
+        const std::string& word, unsigned int count, std::size_t& lookedUp) const;
+
+
+    // useSuggestionStrategy() makes findSuggestions() ask the given
+    // (finished) strategy for the words near a misspelled word, or, given
+    // nullptr, go back to generating candidates itself.  The WordChecker
+    // stores a pointer to the strategy, so it must outlive the WordChecker
+    // or be replaced first.
+    void useSuggestionStrategy(const SuggestionStrategy* strategy);
+
+
+    // useSoundAlikes() makes findSuggestions(word) follow the suggestions
+    // it finds by the words the given (finished) index says sound like
+    // the misspelled word, leaving out any that were already suggested,
+    // or, given nullptr, go back to leaving them out.  Ranking takes
+    // precedence over this, since it returns a fixed number of
+    // suggestions.  As with a strategy, the WordChecker stores a pointer
+    // to the index.
+    void useSoundAlikes(const PhoneticIndex* index);
+
+
+    // useSuggestionCache() makes findSuggestions() look for a misspelled
+    // word's suggestions in the given cache before finding them, and cache
+    // the ones it finds; given nullptr, it goes back to finding them every
+    // time.  As with a strategy, the WordChecker stores a pointer to the
+    // cache, which can be shared by WordCheckers on different threads.
+    void useSuggestionCache(SuggestionCache* cache);
+
+
+    // useThreadPool() makes findSuggestions() spread the lookups of the
+    // candidates it generates for misspelled words of at least the given
+    // length across the given pool's threads, or, given nullptr, go back
+    // to looking them all up on the calling thread.  The suggestions are
+    // the same, and in the same order, either way; only the time taken to
+    // find them for a single long word changes.  The Set must allow
+    // lookups from several threads at once, which all of the ones here
+    // do.  Walks of a RadixTrieSet or TernarySearchTreeSet, and searches by
+    // a SuggestionStrategy, aren't split up.
+    void useThreadPool(ThreadPool* pool, std::string::size_type minimumLength);
+
+
+    // useRanking() makes findSuggestions(word) return findSuggestions(word,
+    // count) instead, ranked by the given frequencies (or, given nullptr,
+    // by edit alone), still consulting a SuggestionCache if there is one.
+    // A count of 0 goes back to finding every suggestion.  The WordChecker
+    // stores a pointer to the frequencies, so they must outlive it.
+    void useRanking(const WordFrequencies* frequencies, unsigned int count);
+
+
+    // findSuggestionsWithin() returns the words within distance 2 of the
+    // given word, which has to look up roughly the square of the number of
+    // candidates that findSuggestions() does, so it stays within the given
+    // budget.  First, the split words and every candidate at distance 1
+    // are looked up in full, whatever the budget; the suggestions among
+    // them come first, in the order findSuggestions() would find them
+    // when it generates candidates.  Then the candidates at distance 1 are
+    // expanded one at a time, cheapest edit first (swaps, deletions,
+    // replacements, insertions, as when ranking), each by generating and
+    // looking up its own candidates, and adding the words among them.  The
+    // budget is checked before each expansion, which is never started if
+    // it would take the number of lookups past the limit, or once the time
+    // is up.  As when ranking, candidates are always looked up with
+    // containsBatch(), and a DictionaryProfile, if there is one, supplies
+    // the alphabet and prunes the candidates at distance 2.
+    BudgetedSuggestions findSuggestionsWithin(const std::string& word, const SearchBudget& budget) const;
+
+
+    // useSearchBudget() makes findSuggestions(word) return the suggestions
+    // from findSuggestionsWithin(word, budget) instead, or, given nullptr,
+    // go back to finding only those at distance 1.  Ranking takes
+    // precedence over this.  A SuggestionCache is still consulted, but
+    // degraded searches aren't cached, so that a later search of the same
+    // word gets another chance to finish.  As with a strategy, the
+    // WordChecker stores a pointer to the budget.
+    void useSearchBudget(const SearchBudget* budget);
+
+
+    // completedSearchCount() and degradedSearchCount() return how many of
+    // the calls to findSuggestionsWithin() so far finished their searches
+    // and how many ran out of budget.
+    unsigned long long completedSearchCount() const;
+    unsigned long long degradedSearchCount() const;
+
+
+    // useDictionaryProfile() makes findSuggestions() try only the
+    // characters in the given profile's alphabet when replacing and
+    // inserting, rather than the letters A-Z, and skip any candidate with
+    // a bigram that no dictionary word has, without looking it up; given
+    // nullptr, it goes back to trying every candidate.  The profile must
+    // have been made from the same words as the Set, and, as with a
+    // strategy, the WordChecker stores a pointer to it.  The suggestions
+    // that are found are the same either way, apart from the ones made
+    // with characters outside A-Z, though a RadixTrieSet walk only uses
+    // the alphabet, and a TernarySearchTreeSet walk or a strategy uses
+    // neither.
+    void useDictionaryProfile(const DictionaryProfile* profile);
+
+
+    // screenedWordCount() returns how many misspelled words have had their
+    // candidates screened by a profile, and prunedCandidateCount() how
+    // many candidates were skipped because of it, in total.
+    unsigned long long screenedWordCount() const;
+    unsigned long long prunedCandidateCount() const;
+
+
+private:
+    std::vector<std::string> findUncachedSuggestions(const std::string& word, bool& complete) const;
+    std::vector<std::string> findSuggestionsByGenerating(const std::string& word) const;
+    std::vector<std::string> findSuggestionsWithStrategy(const std::string& word) const;
+    std::vector<std::string> findSuggestionsInTrie(const std::string& word) const;
+    void addSoundAlikes(const std::string& word, std::vector<std::string>& suggestions) const;
+    std::vector<std::string> findSuggestionsInTree(const std::string& word) const;
+
+    std::uint64_t frequencyOf(const std::string& word) const;
+    void recordScreening(unsigned int pruned) const;
+
+
 private:
     const Set<std::string>& words;
+
+    // Points to the same object as words when that's a RadixTrieSet;
+    // nullptr otherwise.
+    const RadixTrieSet* trie;
+
+    // Likewise, when it's a TernarySearchTreeSet.
+    const TernarySearchTreeSet* tree;
+
+    // Likewise, when it's a PrefixIndex, which can find a word's splits
+    // without looking up every first half.
+    const PrefixIndex* prefixes;
+
+    // nullptr unless useSuggestionStrategy() has been given one.
+    const SuggestionStrategy* strategy;
+
+    // Likewise, for useSoundAlikes().
+    const PhoneticIndex* soundAlikes;
+
+    // Likewise, for useSuggestionCache().
+    SuggestionCache* cache;
+
+    // Likewise, for useThreadPool(), along with the length of the shortest
+    // word whose candidates are spread across it.
+    ThreadPool* pool;
+    std::string::size_type parallelLength;
+
+    // Likewise, for useRanking(), along with the number of suggestions
+    // to return, which is 0 if they aren't ranked.
+    const WordFrequencies* frequencies;
+    unsigned int rankCount;
+
+    // Likewise, for useSearchBudget(), along with the counts of completed
+    // and degraded searches.
+    const SearchBudget* budget;
+    mutable std::atomic<unsigned long long> completedSearches;
+    mutable std::atomic<unsigned long long> degradedSearches;
+
+    // Likewise, for useDictionaryProfile(), along with the counts of
+    // screened words and pruned candidates.
+    const DictionaryProfile* profile;
+    mutable std::atomic<unsigned long long> screenedWords;
+    mutable std::atomic<unsigned long long> prunedCandidates;
 };
 
 
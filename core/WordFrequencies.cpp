@@ -0,0 +1,110 @@
+// WordFrequencies.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include "WordFrequencies.hpp"
+
+
+
+WordFrequencies::WordFrequenciesException::WordFrequenciesException(const std::string& reason)
+    : reason_{reason}
+{
+}
+
+
+std::string WordFrequencies::WordFrequenciesException::reason() const
+{
+    return reason_;
+}
+
+
+
+WordFrequencies::WordFrequencies()
+    : max{0}
+{
+}
+
+
+void WordFrequencies::load(const std::string& path)
+{
+    std::ifstream in{path};
+
+    if (!in)
+    {
+        throw WordFrequenciesException{"Cannot open frequency file: " + path};
+    }
+
+    std::string line;
+    unsigned int lineNumber = 0;
+
+    while (std::getline(in, line))
+    {
+        ++lineNumber;
+
+        std::istringstream fields{line};
+        std::string word;
+        std::uint64_t count;
+
+        if (!(fields >> word))
+        {
+            continue;
+        }
+
+        if (!(fields >> count) || !(fields >> std::ws).eof())
+        {
+            throw WordFrequenciesException{
+                "Invalid line " + std::to_string(lineNumber) + " in frequency file: " + path};
+        }
+
+        std::transform(
+            word.begin(), word.end(), word.begin(),
+            [](unsigned char c) { return std::toupper(c); });
+
+        add(word, count);
+    }
+}
+
+
+void WordFrequencies::add(const std::string& word, std::uint64_t count)
+{
+    std::uint64_t& frequency = counts[word];
+    frequency += count;
+    max = std::max(max, frequency);
+
+    if (word.length() >= maxByLength.size())
+    {
+        maxByLength.resize(word.length() + 1, 0);
+    }
+
+    maxByLength[word.length()] = std::max(maxByLength[word.length()], frequency);
+}
+
+
+std::uint64_t WordFrequencies::frequency(const std::string& word) const
+{
+    auto found = counts.find(word);
+    return found != counts.end() ? found->second : 0;
+}
+
+
+std::uint64_t WordFrequencies::maxFrequency() const
+{
+    return max;
+}
+
+
+std::uint64_t WordFrequencies::maxFrequency(std::string::size_type length) const
+{
+    return length < maxByLength.size() ? maxByLength[length] : 0;
+}
+
+
+std::size_t WordFrequencies::size() const
+{
+    return counts.size();
+}
@@ -0,0 +1,93 @@
+// WordFrequencies.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// A WordFrequencies holds how often each of a set of words occurs in some
+// body of text, so that a WordChecker can rank its suggestions, offering
+// the common words ahead of the obscure ones.
+//
+// Frequencies are usually loaded from a file, which lists one word per
+// line, followed by its count, separated by whitespace:
+//
+//     the 23135851162
+//     of 13151942776
+//     and 12997637966
+//
+// Words are converted to uppercase as they're loaded, the same way a
+// WordSetLoader converts the words in a word set, so that they match.  A
+// word listed more than once has its counts added together.  Words that
+// aren't listed at all have a frequency of 0.
+
+#ifndef WORDFREQUENCIES_HPP
+#define WORDFREQUENCIES_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+
+
+class WordFrequencies
+{
+public:
+    // A WordFrequenciesException is thrown when a frequency file can't be
+    // opened, or has a line that isn't a word followed by a count.
+    class WordFrequenciesException
+    {
+    public:
+        WordFrequenciesException(const std::string& reason);
+
+        std::string reason() const;
+
+    private:
+        std::string reason_;
+    };
+
+
+public:
+    // Initializes a WordFrequencies in which every word has a frequency
+    // of 0.
+    WordFrequencies();
+
+
+    // load() adds the counts listed in the given file.  It throws a
+    // WordFrequenciesException if the file can't be opened, or if any of
+    // its (non-blank) lines isn't a word followed by a count, in which
+    // case the counts on the lines before that one have been added.
+    void load(const std::string& path);
+
+
+    // add() adds the given count to a word's frequency.  The word is used
+    // as given, without converting it to uppercase.
+    void add(const std::string& word, std::uint64_t count);
+
+
+    // frequency() returns the given word's frequency, or 0 if it has none.
+    std::uint64_t frequency(const std::string& word) const;
+
+
+    // maxFrequency() returns the highest frequency of any word, or 0 if
+    // none has been added; given a length, it returns the highest
+    // frequency of any word of that length.
+    std::uint64_t maxFrequency() const;
+    std::uint64_t maxFrequency(std::string::size_type length) const;
+
+
+    // size() returns how many distinct words have a frequency.
+    std::size_t size() const;
+
+
+private:
+    std::unordered_map<std::string, std::uint64_t> counts;
+    std::uint64_t max;
+
+    // maxByLength[n] is the highest frequency of any word of length n.
+    std::vector<std::uint64_t> maxByLength;
+};
+
+
+
+#endif // WORDFREQUENCIES_HPP
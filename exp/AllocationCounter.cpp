@@ -0,0 +1,150 @@
+// AllocationCounter.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include "AllocationCounter.hpp"
+
+
+
+namespace
+{
+    // Each allocation is preceded by a header recording its size, padded
+    // so that the memory handed out keeps malloc's alignment.
+    constexpr std::size_t headerSize = alignof(std::max_align_t);
+
+    std::atomic<std::size_t> live{0};
+    std::atomic<std::size_t> peak{0};
+    std::atomic<std::size_t> count{0};
+
+
+    void* allocate(std::size_t size) noexcept
+    {
+        void* block = std::malloc(size + headerSize);
+
+        if (block == nullptr)
+        {
+            return nullptr;
+        }
+
+        *static_cast<std::size_t*>(block) = size;
+        std::size_t now = live += size;
+        std::size_t highest = peak;
+
+        // A failed exchange reloads highest, in case another thread raised
+        // the peak in the meantime.
+        while (now > highest && !peak.compare_exchange_weak(highest, now))
+        {
+        }
+
+        ++count;
+        return static_cast<char*>(block) + headerSize;
+    }
+
+
+    void deallocate(void* p) noexcept
+    {
+        if (p != nullptr)
+        {
+            void* block = static_cast<char*>(p) - headerSize;
+            live -= *static_cast<std::size_t*>(block);
+            std::free(block);
+        }
+    }
+}
+
+
+
+std::size_t AllocationCounter::liveBytes()
+{
+    return live;
+}
+
+
+std::size_t AllocationCounter::peakBytes()
+{
+    return peak;
+}
+
+
+void AllocationCounter::resetPeak()
+{
+    peak = live.load();
+}
+
+
+std::size_t AllocationCounter::allocations()
+{
+    return count;
+}
+
+
+
+void* operator new(std::size_t size)
+{
+    void* p = allocate(size);
+
+    if (p == nullptr)
+    {
+        throw std::bad_alloc{};
+    }
+
+    return p;
+}
+
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return allocate(size);
+}
+
+
+void operator delete(void* p) noexcept
+{
+    deallocate(p);
+}
+
+
+void operator delete[](void* p) noexcept
+{
+    deallocate(p);
+}
+
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    deallocate(p);
+}
+
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    deallocate(p);
+}
+
+
+void operator delete(void* p, const std::nothrow_t&) noexcept
+{
+    deallocate(p);
+}
+
+
+void operator delete[](void* p, const std::nothrow_t&) noexcept
+{
+    deallocate(p);
+}
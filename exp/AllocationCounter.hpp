@@ -0,0 +1,38 @@
+// AllocationCounter.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// The experiments replace the global operator new and operator delete
+// with versions that keep track of how much memory is allocated, so
+// that the memory taken up by a search structure can be measured as the
+// difference in live bytes before and after it's built.  Nothing outside
+// of the "exp" directory is affected by this.
+
+#ifndef ALLOCATIONCOUNTER_HPP
+#define ALLOCATIONCOUNTER_HPP
+
+#include <cstddef>
+
+
+
+namespace AllocationCounter
+{
+    // liveBytes() returns the number of bytes currently allocated with
+    // operator new and not yet deallocated.
+    std::size_t liveBytes();
+
+    // peakBytes() returns the largest number of bytes that have been live
+    // at once since the program started or resetPeak() was last called,
+    // which starts over from the bytes live now.
+    std::size_t peakBytes();
+    void resetPeak();
+
+    // allocations() returns the number of calls made to operator new since
+    // the program started.
+    std::size_t allocations();
+}
+
+
+
+#endif // ALLOCATIONCOUNTER_HPP
@@ -0,0 +1,154 @@
+// AutomatonBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "BKTree.hpp"
+#include "LevenshteinSearch.hpp"
+#include "Stopwatch.hpp"
+#include "SymSpellIndex.hpp"
+
+
+
+namespace
+{
+    // Builds the given strategy from the words, returning how long it
+    // took in microseconds.
+    double build(SuggestionStrategy& strategy, const std::vector<std::string>& words)
+    {
+        Stopwatch stopwatch;
+        stopwatch.start();
+
+        for (const std::string& word : words)
+        {
+            strategy.addWord(word);
+        }
+
+        strategy.finish();
+        stopwatch.stop();
+
+        return stopwatch.lastDuration();
+    }
+
+
+    // Finds suggestions for every misspelling, returning the average time
+    // per query in microseconds and the average number found.
+    double timeQueries(
+        const SuggestionStrategy& strategy, const std::vector<std::string>& misspellings, double& found)
+    {
+        Stopwatch stopwatch;
+        unsigned long long total = 0;
+
+        stopwatch.start();
+
+        for (const std::string& misspelling : misspellings)
+        {
+            total += strategy.findSuggestions(misspelling).size();
+        }
+
+        stopwatch.stop();
+
+        found = double(total) / misspellings.size();
+        return stopwatch.lastDuration() / misspellings.size();
+    }
+
+
+    void printRow(
+        const std::string& name, unsigned int k, double buildDuration,
+        std::size_t bytes, double queryTime, double found)
+    {
+        std::cout << std::left << std::setw(12) << name << std::right
+                  << std::setw(3) << k
+                  << std::fixed << std::setprecision(0) << std::setw(12) << buildDuration << "usec"
+                  << std::setw(12) << bytes
+                  << std::setprecision(2) << std::setw(12) << queryTime
+                  << std::setprecision(1) << std::setw(8) << found << std::endl;
+    }
+}
+
+
+
+void runAutomatonBenchmark(const std::string& wordFilePath)
+{
+    std::vector<std::string> words = BenchmarkSupport::loadWordList(wordFilePath);
+    std::vector<std::string> misspellings = BenchmarkSupport::makeMisspellings(words, 100, 1);
+
+    // A DAFSA has to be built from words in sorted order.
+    std::vector<std::string> sorted = words;
+    std::sort(sorted.begin(), sorted.end());
+    sorted.erase(std::unique(sorted.begin(), sorted.end()), sorted.end());
+
+    std::cout << words.size() << " words, " << misspellings.size()
+              << " misspellings (one edit each)" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Strategy      k       Build       Bytes   Query(us)   Found" << std::endl;
+
+    for (unsigned int k = 1; k <= 2; ++k)
+    {
+        LevenshteinSearch search{k};
+        double buildDuration = build(search, sorted);
+        double found;
+        double queryTime = timeQueries(search, misspellings, found);
+        printRow("AUTOMATON", k, buildDuration, search.memoryUsage(), queryTime, found);
+
+        SymSpellIndex index{k};
+        buildDuration = build(index, words);
+        queryTime = timeQueries(index, misspellings, found);
+        printRow("SYMSPELL", k, buildDuration, index.memoryUsage(), queryTime, found);
+
+        // The BKTree measures Levenshtein distance, so a swap costs it two
+        // and it finds a few fewer words.
+        BKTree tree{k};
+        buildDuration = build(tree, words);
+        queryTime = timeQueries(tree, misspellings, found);
+        printRow("BKTREE", k, buildDuration, tree.memoryUsage(), queryTime, found);
+    }
+
+    std::cout << std::endl;
+
+    // How much of the DAFSA each search reaches: the cost of a query
+    // follows the number of states visited, not the length of the word.
+    LevenshteinSearch search{2};
+    build(search, sorted);
+
+    std::cout << "DAFSA: " << search.dictionary().stateCount() << " states, "
+              << search.dictionary().transitionCount() << " transitions" << std::endl;
+    std::cout << "Length    Queries   k=1 Visited   k=2 Visited" << std::endl;
+
+    for (std::string::size_type length = 2; length <= 16; length += 2)
+    {
+        unsigned long long queries = 0;
+        unsigned long long visited[3] = {0, 0, 0};
+
+        for (const std::string& misspelling : misspellings)
+        {
+            if (misspelling.size() == length || misspelling.size() == length + 1)
+            {
+                ++queries;
+
+                for (unsigned int k = 1; k <= 2; ++k)
+                {
+                    std::size_t v;
+                    search.findWithin(misspelling, k, v);
+                    visited[k] += v;
+                }
+            }
+        }
+
+        if (queries > 0)
+        {
+            std::cout << std::setw(2) << length << "-" << std::left << std::setw(6) << length + 1
+                      << std::right << std::setw(8) << queries
+                      << std::fixed << std::setprecision(1)
+                      << std::setw(14) << double(visited[1]) / queries
+                      << std::setw(14) << double(visited[2]) / queries << std::endl;
+        }
+    }
+}
@@ -0,0 +1,137 @@
+// BKTreeBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <iomanip>
+#include <iostream>
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "BKTree.hpp"
+#include "EditDistance.hpp"
+#include "Stopwatch.hpp"
+
+
+
+namespace
+{
+    // Times the edit distance kernel on every pairing of the misspellings
+    // with a sample of the words, returning nanoseconds per pair.
+    double timeKernel(
+        const std::vector<std::string>& misspellings, const std::vector<std::string>& sample,
+        unsigned int limit, unsigned long long& within)
+    {
+        Stopwatch stopwatch;
+        within = 0;
+
+        stopwatch.start();
+
+        for (const std::string& misspelling : misspellings)
+        {
+            for (const std::string& word : sample)
+            {
+                within += EditDistance::levenshtein(misspelling, word, limit) <= limit;
+            }
+        }
+
+        stopwatch.stop();
+
+        return stopwatch.lastDuration() * 1000.0 / (misspellings.size() * sample.size());
+    }
+}
+
+
+
+void runBKTreeBenchmark(const std::string& wordFilePath)
+{
+    std::vector<std::string> words = BenchmarkSupport::loadWordList(wordFilePath);
+    std::vector<std::string> misspellings = BenchmarkSupport::makeMisspellings(words, 100, 1);
+
+    std::cout << words.size() << " words, " << misspellings.size()
+              << " misspellings (one edit each)" << std::endl;
+    std::cout << std::endl;
+
+    // The kernel first: giving it a small limit lets it skip most of the
+    // table and give up early on most pairs.
+    std::vector<std::string> sample;
+
+    for (std::vector<std::string>::size_type i = 0; i < words.size(); i += 60)
+    {
+        sample.push_back(words[i]);
+    }
+
+    std::cout << "Levenshtein kernel on " << misspellings.size() * sample.size()
+              << " pairs" << std::endl;
+    std::cout << "Limit       ns/pair   Within" << std::endl;
+
+    for (unsigned int limit : {1u, 2u, 3u, 100u})
+    {
+        unsigned long long within;
+        double time = timeKernel(misspellings, sample, limit, within);
+
+        std::cout << std::left << std::setw(8) << (limit == 100 ? std::string{"none"} : std::to_string(limit))
+                  << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(12) << time << std::setw(9) << within << std::endl;
+    }
+
+    std::cout << std::endl;
+
+    // Then the tree, built from every nth word for a few values of n, to
+    // show how the cost of a search grows with the size of the dictionary.
+    std::cout << "Words       Build    Bytes/Word   k   Query(us)   Visited   Found" << std::endl;
+
+    for (unsigned int stride : {8u, 4u, 2u, 1u})
+    {
+        Stopwatch stopwatch;
+        BKTree tree;
+
+        stopwatch.start();
+
+        for (std::vector<std::string>::size_type i = 0; i < words.size(); i += stride)
+        {
+            tree.addWord(words[i]);
+        }
+
+        tree.finish();
+        stopwatch.stop();
+
+        double buildDuration = stopwatch.lastDuration();
+
+        for (unsigned int k = 1; k <= 3; ++k)
+        {
+            unsigned long long visited = 0;
+            unsigned long long found = 0;
+
+            stopwatch.start();
+
+            for (const std::string& misspelling : misspellings)
+            {
+                std::size_t v;
+                found += tree.findWithin(misspelling, k, v).size();
+                visited += v;
+            }
+
+            stopwatch.stop();
+
+            double queryTime = stopwatch.lastDuration() / misspellings.size();
+
+            if (k == 1)
+            {
+                std::cout << std::right << std::setw(6) << tree.wordCount()
+                          << std::fixed << std::setprecision(0) << std::setw(10) << buildDuration << "usec"
+                          << std::setprecision(1) << std::setw(10)
+                          << double(tree.memoryUsage()) / tree.wordCount();
+            }
+            else
+            {
+                std::cout << std::setw(30) << "";
+            }
+
+            std::cout << std::setw(4) << k
+                      << std::setprecision(2) << std::setw(12) << queryTime
+                      << std::setprecision(1) << std::setw(9)
+                      << 100.0 * visited / misspellings.size() / tree.wordCount() << "%"
+                      << std::setw(8) << double(found) / misspellings.size() << std::endl;
+        }
+    }
+}
@@ -0,0 +1,190 @@
+// BenchmarkSupport.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <memory>
+#include "BenchmarkSupport.hpp"
+#include "Stopwatch.hpp"
+#include "WordSetLoader.hpp"
+
+
+
+namespace
+{
+    // A "set" that remembers everything added to it, in order, so that a
+    // WordSetLoader can be used to read a word list.
+    class WordListCollector : public Set<std::string>
+    {
+    public:
+        WordListCollector(std::vector<std::string>& words)
+            : words{words}
+        {
+        }
+
+        virtual bool isImplemented() const
+        {
+            return true;
+        }
+
+        virtual void add(const std::string& element)
+        {
+            words.push_back(element);
+        }
+
+        virtual bool contains(const std::string& element) const
+        {
+            return false;
+        }
+
+        virtual unsigned int size() const
+        {
+            return words.size();
+        }
+
+    private:
+        std::vector<std::string>& words;
+    };
+}
+
+
+
+std::vector<std::string> BenchmarkSupport::loadWordList(const std::string& wordFilePath)
+{
+    std::vector<std::string> words;
+    WordListCollector collector{words};
+    WordSetLoader{}.load(wordFilePath, collector);
+    return words;
+}
+
+
+std::vector<std::string> BenchmarkSupport::makeCandidateStream(
+    const std::vector<std::string>& words, unsigned int stride)
+{
+    static const std::string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+    std::vector<std::string> candidates;
+
+    for (std::vector<std::string>::size_type i = 0; i < words.size(); i += stride)
+    {
+        std::string candidate = words[i];
+
+        for (std::string::size_type x = 0; x < candidate.size(); ++x)
+        {
+            char original = candidate[x];
+
+            for (char c : alphabet)
+            {
+                candidate[x] = c;
+                candidates.push_back(candidate);
+            }
+
+            candidate[x] = original;
+        }
+    }
+
+    return candidates;
+}
+
+
+std::vector<std::string> BenchmarkSupport::makeMisspellings(
+    const std::vector<std::string>& words, unsigned int stride, unsigned int edits)
+{
+    static const std::string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+    std::vector<std::string> misspellings;
+    unsigned long long state = 12345;
+
+    auto next = [&state](unsigned long long limit)
+    {
+        state = state * 6364136223846793005ull + 1442695040888963407ull;
+        return (state >> 33) % limit;
+    };
+
+    for (std::vector<std::string>::size_type i = 0; i < words.size(); i += stride)
+    {
+        std::string s = words[i];
+
+        for (unsigned int e = 0; e < edits; ++e)
+        {
+            switch (s.size() < 2 ? 2 : next(4))
+            {
+            case 0:
+                s[next(s.size())] = alphabet[next(alphabet.size())];
+                break;
+
+            case 1:
+                s.erase(next(s.size()), 1);
+                break;
+
+            case 2:
+                s.insert(next(s.size() + 1), 1, alphabet[next(alphabet.size())]);
+                break;
+
+            default:
+            {
+                std::string::size_type x = next(s.size() - 1);
+                std::swap(s[x], s[x + 1]);
+                break;
+            }
+            }
+        }
+
+        misspellings.push_back(s);
+    }
+
+    return misspellings;
+}
+
+
+double BenchmarkSupport::timeLookups(
+    const Set<std::string>& set, const std::vector<std::string>& queries,
+    unsigned int& hits)
+{
+    Stopwatch stopwatch;
+
+    hits = 0;
+
+    stopwatch.start();
+
+    for (const std::string& query : queries)
+    {
+        if (set.contains(query))
+        {
+            ++hits;
+        }
+    }
+
+    stopwatch.stop();
+
+    return queries.empty() ? 0.0 : stopwatch.lastDuration() * 1000.0 / queries.size();
+}
+
+
+double BenchmarkSupport::timeBatchedLookups(
+    const Set<std::string>& set, const std::vector<std::string>& queries,
+    unsigned int batchSize, unsigned int& hits)
+{
+    Stopwatch stopwatch;
+    std::unique_ptr<bool[]> found{new bool[batchSize]};
+
+    hits = 0;
+
+    stopwatch.start();
+
+    for (std::vector<std::string>::size_type start = 0; start < queries.size(); start += batchSize)
+    {
+        unsigned int count = std::min<std::vector<std::string>::size_type>(batchSize, queries.size() - start);
+        set.containsBatch(queries.data() + start, count, found.get());
+
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            hits += found[i];
+        }
+    }
+
+    stopwatch.stop();
+
+    return queries.empty() ? 0.0 : stopwatch.lastDuration() * 1000.0 / queries.size();
+}
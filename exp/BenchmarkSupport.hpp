@@ -0,0 +1,60 @@
+// BenchmarkSupport.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Utilities shared by the experiments: loading the words from a word set
+// file into a vector (normalized the same way a WordSetLoader normalizes
+// them), producing a stream of lookups resembling the ones a WordChecker
+// makes or of misspelled words, and timing lookups against a Set.
+
+#ifndef BENCHMARKSUPPORT_HPP
+#define BENCHMARKSUPPORT_HPP
+
+#include <string>
+#include <vector>
+#include "Set.hpp"
+
+
+
+namespace BenchmarkSupport
+{
+    // loadWordList() returns the words in the given word set file, in the
+    // order they appear there.
+    std::vector<std::string> loadWordList(const std::string& wordFilePath);
+
+
+    // makeCandidateStream() returns every single-character replacement of
+    // every stride-th word in the given list -- the kind of candidates that
+    // WordChecker::findSuggestions() looks up, most of which are misses.
+    std::vector<std::string> makeCandidateStream(
+        const std::vector<std::string>& words, unsigned int stride);
+
+
+    // makeMisspellings() returns a misspelling of every stride-th word in
+    // the given list, made by applying the given number of edits to it:
+    // each a replacement, deletion, insertion, or swap at a pseudorandom
+    // position, chosen the same way every time.
+    std::vector<std::string> makeMisspellings(
+        const std::vector<std::string>& words, unsigned int stride, unsigned int edits);
+
+
+    // timeLookups() looks up every query in the given set, returning the
+    // average time per lookup in nanoseconds.  The number of queries that
+    // were found is stored into hits.
+    double timeLookups(
+        const Set<std::string>& set, const std::vector<std::string>& queries,
+        unsigned int& hits);
+
+
+    // timeBatchedLookups() is like timeLookups(), but looks the queries up
+    // with containsBatch(), batchSize at a time, the way WordChecker looks
+    // up a misspelled word's candidates.
+    double timeBatchedLookups(
+        const Set<std::string>& set, const std::vector<std::string>& queries,
+        unsigned int batchSize, unsigned int& hits);
+}
+
+
+
+#endif // BENCHMARKSUPPORT_HPP
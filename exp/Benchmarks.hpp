@@ -0,0 +1,145 @@
+// Benchmarks.hpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Declarations of the experiments that expmain.cpp can run.  Each one
+// reads whatever it needs from the given word set file and prints a table
+// of its results to std::cout.
+
+#ifndef BENCHMARKS_HPP
+#define BENCHMARKS_HPP
+
+#include <string>
+
+
+
+// Compares the load time, memory footprint, and lookup speed of every
+// implemented Set of strings.
+void runSetBenchmark(const std::string& wordFilePath);
+
+
+// Measures the size of a DafsaSet built from the word set, along with how
+// long it takes to save it to a file and load it back again.
+void runDafsaBenchmark(const std::string& wordFilePath);
+
+
+
+// Compares the cold-start cost of building a DoubleArrayTrieSet from the
+// word set against mapping one that was saved to a file, along with the
+// cost of the first lookups made against each.
+void runDoubleArrayBenchmark(const std::string& wordFilePath);
+
+
+
+// Times rank and select on a large random BitVector, and reports how many
+// bits per node a LoudsTrieSet built from the word set takes.
+void runLoudsBenchmark(const std::string& wordFilePath);
+
+
+
+// Compares Bloom filters and binary fuse filters built from the word set:
+// their size, false positive rate, and speed on a stream of single-edit
+// candidates, both alone and in front of a HashSet.
+void runFilterBenchmark(const std::string& wordFilePath);
+
+
+
+// Compares finding suggestions with a SymSpellIndex against generating
+// candidates: the index's build time and size, and the time taken to find
+// the words within distance 1 and 2 of misspelled words.
+void runSymSpellBenchmark(const std::string& wordFilePath);
+
+
+
+// Times the bounded Levenshtein kernel with and without a limit, and
+// searches of BKTrees built from growing fractions of the word set within
+// distances 1 through 3, reporting how much of each tree is visited.
+void runBKTreeBenchmark(const std::string& wordFilePath);
+
+
+
+// Compares finding suggestions by walking a Levenshtein automaton through
+// a DAFSA with a SymSpellIndex and a BKTree, within distances 1 and 2, and
+// reports how many DAFSA states a search visits for words of each length.
+void runAutomatonBenchmark(const std::string& wordFilePath);
+
+
+
+// Times finding suggestions for a stream of recurring misspellings with
+// and without SuggestionCaches of a few capacities, reporting their hit
+// rates.
+void runCacheBenchmark(const std::string& wordFilePath);
+
+
+
+// Measures the latency of finding suggestions for single misspelled words
+// of various lengths, with their candidates looked up on 1, 2, 4, and (if
+// there are more) all of the machine's threads.
+void runParallelBenchmark(const std::string& wordFilePath);
+
+
+
+// Measures the throughput of the bit-parallel distance kernels, one pair
+// and many pairs at a time, against the ordinary table-filling one, in
+// millions of word pairs per second, and compares scanning the words of
+// nearby lengths with them against a SymSpellIndex.
+void runBitParallelBenchmark(const std::string& wordFilePath);
+
+
+
+// Times finding the top few ranked suggestions for misspelled words against
+// finding all of them, reporting how many candidates are looked up and how
+// often the search stops before trying every family of edit.
+void runRankingBenchmark(const std::string& wordFilePath);
+
+
+
+// Times finding suggestions for misspelled words with and without their
+// candidates screened by a DictionaryProfile of the word set, reporting
+// how many are looked up and how many are pruned per word.
+void runPruningBenchmark(const std::string& wordFilePath);
+
+
+
+// Measures how fast every candidate for misspelled words is generated by
+// a CandidateGenerator specialized for the letters A-Z, against the
+// generic loops with the alphabet in a string, in millions of candidates
+// per second, for words short enough to have their own specialization
+// and for longer ones.
+void runGeneratorBenchmark(const std::string& wordFilePath);
+
+
+
+// Times finding the split words in compounds of two words, and then every
+// suggestion for them, with a DafsaSet and a DoubleArrayTrieSet, looking up
+// both halves of every split against walking each compound through the set
+// once and looking up only the second halves that follow a word.
+void runSplitBenchmark(const std::string& wordFilePath);
+
+
+
+// Measures the median, 99th percentile, and worst latency of searching
+// out to distance 2 for misspellings two edits away, with no budget and
+// with budgets of lookups and of time, along with how often the search
+// completes and how many suggestions it finds.
+void runBudgetBenchmark(const std::string& wordFilePath);
+
+
+
+// Measures how long a PhoneticIndex of the word set takes to build and how
+// much memory it takes, and how often it finds the word that was meant
+// for misspellings written the way the word sounds, which are more than
+// one edit away often enough that distance 1 misses them.
+void runPhoneticBenchmark(const std::string& wordFilePath);
+
+
+
+// Times checking a text made from the word set, with a misspelling every
+// so often, on 1, 2, 4, and (if there are more) all of the machine's
+// threads, reporting words checked per second and the speedup over one.
+void runPipelineBenchmark(const std::string& wordFilePath);
+
+
+
+#endif // BENCHMARKS_HPP
@@ -0,0 +1,201 @@
+// BitParallelBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <iomanip>
+#include <iostream>
+#include <string_view>
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "BitParallelDistance.hpp"
+#include "EditDistance.hpp"
+#include "LengthBucketScan.hpp"
+#include "Stopwatch.hpp"
+#include "SymSpellIndex.hpp"
+
+
+
+namespace
+{
+    enum class Kernel
+    {
+        Table,
+        BoundedTable,
+        BitParallel,
+        BitParallelMany
+    };
+
+
+    // Compares every misspelling with every word in the sample using the
+    // given kernel, returning millions of pairs per second.  The number of
+    // pairs within distance 2 is stored into within, as a check that every
+    // kernel agrees.
+    double timeKernel(
+        Kernel kernel, const std::vector<std::string>& misspellings,
+        const std::vector<std::string_view>& sample, unsigned long long& within)
+    {
+        std::vector<unsigned int> distances(sample.size());
+        Stopwatch stopwatch;
+        within = 0;
+
+        stopwatch.start();
+
+        for (const std::string& misspelling : misspellings)
+        {
+            BitParallelDistance::Pattern pattern{misspelling};
+
+            switch (kernel)
+            {
+            case Kernel::Table:
+                for (std::size_t i = 0; i < sample.size(); ++i)
+                {
+                    distances[i] = EditDistance::distance(
+                        misspelling, sample[i], misspelling.size() + sample[i].size());
+                }
+                break;
+
+            case Kernel::BoundedTable:
+                for (std::size_t i = 0; i < sample.size(); ++i)
+                {
+                    distances[i] = EditDistance::distance(misspelling, sample[i], 2);
+                }
+                break;
+
+            case Kernel::BitParallel:
+                for (std::size_t i = 0; i < sample.size(); ++i)
+                {
+                    distances[i] = BitParallelDistance::distance(pattern, sample[i]);
+                }
+                break;
+
+            case Kernel::BitParallelMany:
+                BitParallelDistance::distanceMany(pattern, sample.data(), sample.size(), distances.data());
+                break;
+            }
+
+            for (unsigned int distance : distances)
+            {
+                within += distance <= 2;
+            }
+        }
+
+        stopwatch.stop();
+
+        return misspellings.size() * sample.size() / stopwatch.lastDuration();
+    }
+
+
+    template <typename Strategy>
+    void buildStrategy(Strategy& strategy, const std::vector<std::string>& words)
+    {
+        for (const std::string& word : words)
+        {
+            strategy.addWord(word);
+        }
+
+        strategy.finish();
+    }
+
+
+    template <typename Strategy>
+    double timeQueries(const Strategy& strategy, const std::vector<std::string>& misspellings, double& found)
+    {
+        Stopwatch stopwatch;
+        unsigned long long total = 0;
+
+        stopwatch.start();
+
+        for (const std::string& misspelling : misspellings)
+        {
+            total += strategy.findSuggestions(misspelling).size();
+        }
+
+        stopwatch.stop();
+
+        found = double(total) / misspellings.size();
+        return stopwatch.lastDuration() / misspellings.size();
+    }
+}
+
+
+
+void runBitParallelBenchmark(const std::string& wordFilePath)
+{
+    std::vector<std::string> words = BenchmarkSupport::loadWordList(wordFilePath);
+    std::vector<std::string> misspellings = BenchmarkSupport::makeMisspellings(words, 200, 1);
+
+    std::cout << words.size() << " words, " << misspellings.size()
+              << " misspellings (one edit each)" << std::endl;
+    std::cout << "AVX2: " << (BitParallelDistance::usesAvx2() ? "yes" : "no") << std::endl;
+    std::cout << std::endl;
+
+    // The kernels first, each measuring the swap-aware distance between
+    // every misspelling and a sample of the words.
+    std::vector<std::string_view> sample;
+
+    for (std::vector<std::string>::size_type i = 0; i < words.size(); i += 20)
+    {
+        sample.push_back(words[i]);
+    }
+
+    std::cout << "Kernels on " << misspellings.size() * sample.size() << " pairs" << std::endl;
+    std::cout << "Kernel                       Mpairs/s   Within 2" << std::endl;
+
+    const std::pair<Kernel, const char*> kernels[] = {
+        {Kernel::Table, "Table, no limit"},
+        {Kernel::BoundedTable, "Table, limit 2"},
+        {Kernel::BitParallel, "Bit-parallel, one at a time"},
+        {Kernel::BitParallelMany, "Bit-parallel, many at once"}};
+
+    for (const auto& kernel : kernels)
+    {
+        unsigned long long within;
+        double rate = timeKernel(kernel.first, misspellings, sample, within);
+
+        std::cout << std::left << std::setw(28) << kernel.second
+                  << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << rate << std::setw(11) << within << std::endl;
+    }
+
+    std::cout << std::endl;
+
+    // Then scanning the nearby lengths of the whole dictionary, compared
+    // with a SymSpellIndex, which finds the same words.
+    std::cout << "Strategy          Build(ms)   Memory(KB)   k   Query(us)   Found" << std::endl;
+
+    for (unsigned int k = 1; k <= 2; ++k)
+    {
+        Stopwatch stopwatch;
+
+        stopwatch.start();
+        LengthBucketScan scan{k};
+        buildStrategy(scan, words);
+        stopwatch.stop();
+        double scanBuild = stopwatch.lastDuration();
+
+        stopwatch.start();
+        SymSpellIndex index{k};
+        buildStrategy(index, words);
+        stopwatch.stop();
+        double indexBuild = stopwatch.lastDuration();
+
+        double scanFound;
+        double scanTime = timeQueries(scan, misspellings, scanFound);
+
+        double indexFound;
+        double indexTime = timeQueries(index, misspellings, indexFound);
+
+        std::cout << std::left << std::setw(16) << "Length scan" << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(11) << scanBuild / 1000.0
+                  << std::setprecision(0) << std::setw(13) << scan.memoryUsage() / 1024.0
+                  << std::setw(4) << k << std::setprecision(1) << std::setw(12) << scanTime
+                  << std::setprecision(2) << std::setw(8) << scanFound << std::endl;
+
+        std::cout << std::left << std::setw(16) << "SymSpell" << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(11) << indexBuild / 1000.0
+                  << std::setprecision(0) << std::setw(13) << index.memoryUsage() / 1024.0
+                  << std::setw(4) << k << std::setprecision(1) << std::setw(12) << indexTime
+                  << std::setprecision(2) << std::setw(8) << indexFound << std::endl;
+    }
+}
@@ -0,0 +1,99 @@
+// BudgetBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "HashSet.hpp"
+#include "Stopwatch.hpp"
+#include "StringHashing.hpp"
+#include "WordChecker.hpp"
+#include "WordSetLoader.hpp"
+
+
+
+namespace
+{
+    // Returns the given percentile of the sorted latencies.
+    double percentile(const std::vector<double>& sorted, double p)
+    {
+        std::size_t i = static_cast<std::size_t>(p / 100.0 * (sorted.size() - 1) + 0.5);
+        return sorted[i];
+    }
+
+
+    void timeBudget(
+        const std::string& name, const WordChecker& checker, const WordChecker::SearchBudget& budget,
+        const std::vector<std::string>& misspellings)
+    {
+        std::vector<double> latencies;
+        unsigned long long completed = 0;
+        unsigned long long found = 0;
+        double expanded = 0.0;
+        Stopwatch stopwatch;
+
+        for (const std::string& misspelling : misspellings)
+        {
+            stopwatch.start();
+            WordChecker::BudgetedSuggestions result = checker.findSuggestionsWithin(misspelling, budget);
+            stopwatch.stop();
+
+            latencies.push_back(stopwatch.lastDuration());
+            completed += result.completed;
+            found += result.suggestions.size();
+            expanded += result.seedCount > 0 ? double(result.seedsExpanded) / result.seedCount : 1.0;
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+
+        std::cout << std::left << std::setw(18) << name << std::right << std::fixed
+                  << std::setprecision(0) << std::setw(10) << percentile(latencies, 50)
+                  << std::setw(10) << percentile(latencies, 99)
+                  << std::setw(10) << latencies.back()
+                  << std::setprecision(1) << std::setw(12) << 100.0 * completed / misspellings.size()
+                  << std::setw(11) << 100.0 * expanded / misspellings.size()
+                  << std::setprecision(2) << std::setw(13) << double(found) / misspellings.size()
+                  << std::endl;
+    }
+}
+
+
+
+void runBudgetBenchmark(const std::string& wordFilePath)
+{
+    HashSet<std::string> words{hashStringAsProduct};
+    WordSetLoader{}.load(wordFilePath, words);
+
+    std::vector<std::string> wordList = BenchmarkSupport::loadWordList(wordFilePath);
+    std::vector<std::string> misspellings = BenchmarkSupport::makeMisspellings(wordList, 200, 2);
+
+    WordChecker checker{words};
+
+    std::cout << misspellings.size() << " misspellings (two edits each)" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Budget            p50(us)   p99(us)   max(us)   Completed   Expanded   Suggestions" << std::endl;
+
+    WordChecker::SearchBudget budget;
+    timeBudget("none", checker, budget, misspellings);
+
+    for (std::size_t lookups : {5000, 20000, 80000})
+    {
+        budget = WordChecker::SearchBudget{};
+        budget.maxLookups = lookups;
+        timeBudget(std::to_string(lookups) + " lookups", checker, budget, misspellings);
+    }
+
+    for (long long time : {250, 1000, 4000})
+    {
+        budget = WordChecker::SearchBudget{};
+        budget.maxTime = std::chrono::microseconds{time};
+        timeBudget(std::to_string(time) + " us", checker, budget, misspellings);
+    }
+}
@@ -0,0 +1,101 @@
+// CacheBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "HashSet.hpp"
+#include "Stopwatch.hpp"
+#include "StringHashing.hpp"
+#include "SuggestionCache.hpp"
+#include "WordChecker.hpp"
+#include "WordSetLoader.hpp"
+
+
+
+namespace
+{
+    // Returns a stream of the given length drawn from the misspellings
+    // with a Zipf distribution, so that a few recur very often and most
+    // rarely, the way misspellings in real documents do.
+    std::vector<std::string> makeZipfStream(
+        const std::vector<std::string>& misspellings, unsigned int length)
+    {
+        std::vector<double> weights;
+
+        for (std::vector<std::string>::size_type rank = 1; rank <= misspellings.size(); ++rank)
+        {
+            weights.push_back(1.0 / rank);
+        }
+
+        std::mt19937 random{12345};
+        std::discrete_distribution<std::size_t> choose{weights.begin(), weights.end()};
+
+        std::vector<std::string> stream;
+
+        for (unsigned int i = 0; i < length; ++i)
+        {
+            stream.push_back(misspellings[choose(random)]);
+        }
+
+        return stream;
+    }
+
+
+    double timeSuggestions(const WordChecker& checker, const std::vector<std::string>& stream)
+    {
+        Stopwatch stopwatch;
+        unsigned long long found = 0;
+
+        stopwatch.start();
+
+        for (const std::string& word : stream)
+        {
+            found += checker.findSuggestions(word).size();
+        }
+
+        stopwatch.stop();
+
+        return stopwatch.lastDuration() / stream.size();
+    }
+}
+
+
+
+void runCacheBenchmark(const std::string& wordFilePath)
+{
+    HashSet<std::string> words{hashStringAsProduct};
+    WordSetLoader{}.load(wordFilePath, words);
+
+    std::vector<std::string> wordList = BenchmarkSupport::loadWordList(wordFilePath);
+    std::vector<std::string> misspellings = BenchmarkSupport::makeMisspellings(wordList, 6, 1);
+    std::vector<std::string> stream = makeZipfStream(misspellings, 100000);
+
+    std::cout << misspellings.size() << " distinct misspellings, " << stream.size()
+              << " in a Zipf-distributed stream" << std::endl;
+    std::cout << std::endl;
+
+    WordChecker checker{words};
+    double uncachedTime = timeSuggestions(checker, stream);
+
+    std::cout << "Capacity   Query(us)   HitRate   Evictions" << std::endl;
+    std::cout << std::left << std::setw(8) << "none" << std::right
+              << std::fixed << std::setprecision(2) << std::setw(12) << uncachedTime << std::endl;
+
+    for (unsigned int capacity : {100u, 1000u, 10000u})
+    {
+        SuggestionCache cache{capacity};
+        checker.useSuggestionCache(&cache);
+
+        double cachedTime = timeSuggestions(checker, stream);
+
+        std::cout << std::left << std::setw(8) << capacity << std::right
+                  << std::fixed << std::setprecision(2) << std::setw(12) << cachedTime
+                  << std::setprecision(1) << std::setw(9) << 100.0 * cache.hitRate() << "%"
+                  << std::setw(12) << cache.evictions() << std::endl;
+    }
+}
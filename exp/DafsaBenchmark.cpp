@@ -0,0 +1,65 @@
+// DafsaBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "DafsaSet.hpp"
+#include "Stopwatch.hpp"
+#include "WordSetLoader.hpp"
+
+
+
+void runDafsaBenchmark(const std::string& wordFilePath)
+{
+    std::vector<std::string> words = BenchmarkSupport::loadWordList(wordFilePath);
+    std::string dafsaFilePath = wordFilePath + ".dafsa";
+
+    Stopwatch stopwatch;
+
+    DafsaSet built;
+
+    stopwatch.start();
+    WordSetLoader{}.load(wordFilePath, built);
+    built.finish();
+    stopwatch.stop();
+
+    double buildDuration = stopwatch.lastDuration();
+
+    stopwatch.start();
+    built.save(dafsaFilePath);
+    stopwatch.stop();
+
+    double saveDuration = stopwatch.lastDuration();
+
+    stopwatch.start();
+    DafsaSet loaded = DafsaSet::load(dafsaFilePath);
+    stopwatch.stop();
+
+    double loadDuration = stopwatch.lastDuration();
+
+    std::ifstream file{dafsaFilePath, std::ios::binary | std::ios::ate};
+
+    unsigned int hits;
+    double hitTime = BenchmarkSupport::timeLookups(loaded, words, hits);
+
+    std::cout << std::fixed << std::setprecision(0);
+    std::cout << "Words:              " << built.size() << std::endl;
+    std::cout << "States:             " << built.stateCount() << std::endl;
+    std::cout << "Transitions:        " << built.transitionCount() << std::endl;
+    std::cout << "Memory:             " << built.memoryUsage() << " bytes ("
+              << std::setprecision(1) << double(built.memoryUsage()) / built.size()
+              << " per word)" << std::endl;
+    std::cout << "File size:          " << file.tellg() << " bytes" << std::endl;
+    std::cout << std::setprecision(0);
+    std::cout << "Build from text:    " << buildDuration << "usec" << std::endl;
+    std::cout << "Save to file:       " << saveDuration << "usec" << std::endl;
+    std::cout << "Load from file:     " << loadDuration << "usec" << std::endl;
+    std::cout << std::setprecision(1);
+    std::cout << "Lookup (loaded):    " << hitTime << "ns, " << hits << " of "
+              << words.size() << " words found" << std::endl;
+}
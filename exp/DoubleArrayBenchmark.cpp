@@ -0,0 +1,62 @@
+// DoubleArrayBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <iomanip>
+#include <iostream>
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "DoubleArrayTrieSet.hpp"
+#include "Stopwatch.hpp"
+#include "WordSetLoader.hpp"
+
+
+
+void runDoubleArrayBenchmark(const std::string& wordFilePath)
+{
+    std::vector<std::string> words = BenchmarkSupport::loadWordList(wordFilePath);
+    std::vector<std::string> candidates = BenchmarkSupport::makeCandidateStream(words, 100);
+    std::string savedFilePath = wordFilePath + ".dat";
+
+    Stopwatch stopwatch;
+
+    DoubleArrayTrieSet built;
+
+    stopwatch.start();
+    WordSetLoader{}.load(wordFilePath, built);
+    built.finish();
+    stopwatch.stop();
+
+    double buildDuration = stopwatch.lastDuration();
+
+    built.save(savedFilePath);
+
+    stopwatch.start();
+    DoubleArrayTrieSet mapped = DoubleArrayTrieSet::map(savedFilePath);
+    stopwatch.stop();
+
+    double mapDuration = stopwatch.lastDuration();
+
+    // Mapping the file checks every cell, which faults its pages in, so
+    // the first pass over it should be close to the second, steady one.
+    unsigned int hits;
+    double firstHitTime = BenchmarkSupport::timeLookups(mapped, words, hits);
+    double hitTime = BenchmarkSupport::timeLookups(mapped, words, hits);
+
+    unsigned int candidateHits;
+    double candidateTime = BenchmarkSupport::timeLookups(mapped, candidates, candidateHits);
+
+    std::cout << std::fixed << std::setprecision(0);
+    std::cout << "Words:              " << mapped.size() << std::endl;
+    std::cout << "Cells:              " << mapped.cellCount() << std::endl;
+    std::cout << "Memory:             " << mapped.memoryUsage() << " bytes" << std::endl;
+    std::cout << "Build from text:    " << buildDuration << "usec" << std::endl;
+    std::cout << "Map saved file:     " << mapDuration << "usec" << std::endl;
+    std::cout << std::setprecision(1);
+    std::cout << "First lookups:      " << firstHitTime << "ns" << std::endl;
+    std::cout << "Lookups:            " << hitTime << "ns, " << hits << " of "
+              << words.size() << " words found" << std::endl;
+    std::cout << "Candidate lookups:  " << candidateTime << "ns, " << candidateHits
+              << " of " << candidates.size() << " found" << std::endl;
+}
@@ -0,0 +1,164 @@
+// FilterBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <unordered_set>
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "BinaryFuseFilter.hpp"
+#include "BloomFilter.hpp"
+#include "FilteredSet.hpp"
+#include "HashSet.hpp"
+#include "Stopwatch.hpp"
+#include "StringHashing.hpp"
+#include "WordSetLoader.hpp"
+
+
+
+namespace
+{
+    struct FilterUnderTest
+    {
+        std::string name;
+        FilteredSet::FilterFactory make;
+    };
+
+
+    std::vector<FilterUnderTest> allFilters()
+    {
+        auto bloom = [](double rate) -> FilteredSet::FilterFactory
+        {
+            return [rate](const std::vector<std::uint64_t>& hashes)
+            {
+                return std::make_unique<BloomFilter>(hashes, rate);
+            };
+        };
+
+        return {
+            {"BLOOM 0.01", bloom(0.01)},
+            {"BLOOM 0.004", bloom(0.004)},
+            {"BLOOM 0.0001", bloom(0.0001)},
+            {"FUSE 8",
+             [](const std::vector<std::uint64_t>& hashes)
+             {
+                 return std::make_unique<BinaryFuseFilter<std::uint8_t>>(hashes);
+             }},
+            {"FUSE 16",
+             [](const std::vector<std::uint64_t>& hashes)
+             {
+                 return std::make_unique<BinaryFuseFilter<std::uint16_t>>(hashes);
+             }}
+        };
+    }
+}
+
+
+
+void runFilterBenchmark(const std::string& wordFilePath)
+{
+    std::vector<std::string> words = BenchmarkSupport::loadWordList(wordFilePath);
+    std::vector<std::string> candidates = BenchmarkSupport::makeCandidateStream(words, 100);
+
+    std::vector<std::uint64_t> wordHashes;
+
+    for (const std::string& word : words)
+    {
+        wordHashes.push_back(FilteredSet::hashElement(word));
+    }
+
+    // Only the candidates that aren't words can be false positives, so the
+    // rate is measured on them alone; the probes, though, are timed on the
+    // whole stream, as the WordChecker would make them.
+    std::unordered_set<std::string> wordLookup{words.begin(), words.end()};
+    std::vector<std::uint64_t> candidateHashes;
+    std::vector<bool> isWord;
+
+    for (const std::string& candidate : candidates)
+    {
+        candidateHashes.push_back(FilteredSet::hashElement(candidate));
+        isWord.push_back(wordLookup.count(candidate) > 0);
+    }
+
+    // Each filter is compared against the same set with nothing in front.
+    HashSet<std::string> hashSet{hashStringAsProduct};
+    WordSetLoader{}.load(wordFilePath, hashSet);
+
+    unsigned int hits;
+    double unfilteredTime = BenchmarkSupport::timeLookups(hashSet, candidates, hits);
+
+    std::cout << words.size() << " words, " << candidates.size()
+              << " single-edit candidates (" << candidates.size() - hits << " misses)" << std::endl;
+    std::cout << "HASH PRODUCT alone: " << std::fixed << std::setprecision(1)
+              << unfilteredTime << "ns per candidate" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Filter          Build       Bytes  Bits/Key    FP Rate  Probe(ns)  Filtered(ns)"
+              << std::endl;
+
+    for (const FilterUnderTest& test : allFilters())
+    {
+        HashSet<std::string> inner{hashStringAsProduct};
+        FilteredSet filtered{inner, test.make};
+        WordSetLoader{}.load(wordFilePath, filtered);
+
+        Stopwatch stopwatch;
+
+        stopwatch.start();
+        filtered.finish();
+        stopwatch.stop();
+
+        double buildDuration = stopwatch.lastDuration();
+
+        const MembershipFilter* filter = filtered.filter();
+        unsigned int passed = 0;
+
+        stopwatch.start();
+
+        for (std::uint64_t hash : candidateHashes)
+        {
+            passed += filter->mightContain(hash);
+        }
+
+        stopwatch.stop();
+
+        double probeTime = stopwatch.lastDuration() * 1000.0 / candidateHashes.size();
+
+        unsigned int falsePositives = 0;
+
+        for (std::vector<std::uint64_t>::size_type i = 0; i < candidateHashes.size(); ++i)
+        {
+            if (!isWord[i] && filter->mightContain(candidateHashes[i]))
+            {
+                ++falsePositives;
+            }
+        }
+
+        unsigned int filteredHits;
+        double filteredTime = BenchmarkSupport::timeLookups(filtered, candidates, filteredHits);
+
+        std::size_t bytes = filter->memoryUsage();
+
+        std::cout << std::left << std::setw(12) << test.name;
+        std::cout << std::right << std::fixed << std::setprecision(0)
+                  << std::setw(9) << buildDuration << "usec"
+                  << std::setw(12) << bytes
+                  << std::setprecision(2) << std::setw(10) << bytes * 8.0 / words.size()
+                  << std::setprecision(4) << std::setw(10)
+                  << 100.0 * falsePositives / (candidates.size() - hits) << "%"
+                  << std::setprecision(1) << std::setw(11) << probeTime
+                  << std::setw(14) << filteredTime;
+
+        if (filteredHits != hits || passed < hits)
+        {
+            std::cout << "  (wrong answers!)";
+        }
+
+        std::cout << std::endl;
+    }
+}
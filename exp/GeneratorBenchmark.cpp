@@ -0,0 +1,222 @@
+// GeneratorBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <iomanip>
+#include <iostream>
+#include <utility>
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "CandidateGenerator.hpp"
+#include "Stopwatch.hpp"
+
+
+
+namespace
+{
+    // Each sink sees every candidate; one only folds its characters into a
+    // checksum, so that generating is all that's measured, while the other
+    // copies them into reused strings, the way a WordChecker's batch does.
+    struct ChecksumSink
+    {
+        unsigned long long checksum = 0;
+        unsigned long long count = 0;
+
+        void startWord()
+        {
+        }
+
+        void operator()(const char* candidate, std::size_t length)
+        {
+            checksum = checksum * 31 + length;
+
+            if (length > 0)
+            {
+                checksum += static_cast<unsigned char>(candidate[length / 2]);
+            }
+            ++count;
+        }
+    };
+
+
+    struct CopyingSink
+    {
+        std::vector<std::string> candidates;
+        std::size_t used = 0;
+        unsigned long long count = 0;
+
+        void startWord()
+        {
+            used = 0;
+        }
+
+        void operator()(const char* candidate, std::size_t length)
+        {
+            if (used == candidates.size())
+            {
+                candidates.emplace_back();
+            }
+
+            candidates[used++].assign(candidate, length);
+            ++count;
+        }
+    };
+
+
+    // The loops a WordChecker used before it had a CandidateGenerator,
+    // with the alphabet in a string and each candidate made by editing a
+    // copy of the word in place.
+    template <typename Sink>
+    void generateWithLoops(const std::string& word, const std::string& alphabet, std::string& candidate, Sink& sink)
+    {
+        candidate.assign(word);
+
+        for (std::string::size_type i = 1; i < word.length(); ++i)
+        {
+            sink(word.data(), i);
+            sink(word.data() + i, word.length() - i);
+        }
+
+        for (std::string::size_type i = 0; i + 1 < word.length(); ++i)
+        {
+            std::swap(candidate[i], candidate[i + 1]);
+            sink(candidate.data(), candidate.length());
+            std::swap(candidate[i], candidate[i + 1]);
+        }
+
+        for (char c : alphabet)
+        {
+            for (std::string::size_type x = 0; x < word.length(); ++x)
+            {
+                candidate[x] = c;
+                sink(candidate.data(), candidate.length());
+                candidate[x] = word[x];
+            }
+        }
+
+        for (std::string::size_type i = 0; i < word.length(); ++i)
+        {
+            candidate.erase(i, 1);
+            sink(candidate.data(), candidate.length());
+            candidate.insert(i, 1, word[i]);
+        }
+
+        for (char c : alphabet)
+        {
+            for (std::string::size_type x = 0; x <= word.length(); ++x)
+            {
+                candidate.insert(x, 1, c);
+                sink(candidate.data(), candidate.length());
+                candidate.erase(x, 1);
+            }
+        }
+    }
+
+
+    using Generator = CandidateGenerator<UppercaseLetters, Splits, Swaps, Replacements, Deletions, Insertions>;
+
+
+    // Generates every candidate for every misspelling the given number of
+    // times, returning millions of candidates per second.
+    template <typename Sink>
+    double timeGenerating(bool specialized, const std::vector<std::string>& misspellings, unsigned int rounds, Sink& sink)
+    {
+        static const std::string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+        std::string candidate;
+        Stopwatch stopwatch;
+
+        stopwatch.start();
+
+        for (unsigned int round = 0; round < rounds; ++round)
+        {
+            for (const std::string& misspelling : misspellings)
+            {
+                sink.startWord();
+
+                if (specialized)
+                {
+                    Generator::generate(misspelling, sink);
+                }
+                else
+                {
+                    generateWithLoops(misspelling, alphabet, candidate, sink);
+                }
+            }
+        }
+
+        stopwatch.stop();
+
+        return sink.count / stopwatch.lastDuration();
+    }
+}
+
+
+
+void runGeneratorBenchmark(const std::string& wordFilePath)
+{
+    std::vector<std::string> words = BenchmarkSupport::loadWordList(wordFilePath);
+    std::vector<std::string> misspellings = BenchmarkSupport::makeMisspellings(words, 30, 1);
+
+    // Words no longer than the longest specialized length are handled by
+    // their own copy of the code; the rest share the general one.
+    std::vector<std::string> shortWords;
+    std::vector<std::string> longWords;
+
+    for (const std::string& misspelling : misspellings)
+    {
+        (misspelling.length() <= Generator::maxSpecializedLength ? shortWords : longWords).push_back(misspelling);
+    }
+
+    std::cout << misspellings.size() << " misspellings (one edit each), " << shortWords.size()
+              << " of at most " << Generator::maxSpecializedLength << " characters" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Words   Sink       Loops(Mcand/s)   Generator(Mcand/s)   Speedup" << std::endl;
+
+    const std::pair<const char*, const std::vector<std::string>*> groups[] = {
+        {"all", &misspellings}, {"short", &shortWords}, {"long", &longWords}};
+
+    for (const auto& group : groups)
+    {
+        if (group.second->empty())
+        {
+            continue;
+        }
+
+        for (bool copying : {false, true})
+        {
+            double loops;
+            double generator;
+            bool agree;
+
+            if (copying)
+            {
+                CopyingSink loopSink;
+                loops = timeGenerating(false, *group.second, 5, loopSink);
+
+                CopyingSink generatorSink;
+                generator = timeGenerating(true, *group.second, 5, generatorSink);
+
+                agree = loopSink.count == generatorSink.count;
+            }
+            else
+            {
+                ChecksumSink loopSink;
+                loops = timeGenerating(false, *group.second, 20, loopSink);
+
+                ChecksumSink generatorSink;
+                generator = timeGenerating(true, *group.second, 20, generatorSink);
+
+                agree = loopSink.checksum == generatorSink.checksum;
+            }
+
+            std::cout << std::left << std::setw(8) << group.first
+                      << std::setw(11) << (copying ? "copy" : "checksum")
+                      << std::right << std::fixed << std::setprecision(1)
+                      << std::setw(14) << loops << std::setw(21) << generator
+                      << std::setprecision(2) << std::setw(10) << generator / loops << "x"
+                      << (agree ? "" : "   (candidates differ!)") << std::endl;
+        }
+    }
+}
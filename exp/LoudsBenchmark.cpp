@@ -0,0 +1,138 @@
+// LoudsBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <set>
+#include "AllocationCounter.hpp"
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "BitVector.hpp"
+#include "LoudsTrieSet.hpp"
+#include "Stopwatch.hpp"
+#include "WordSetLoader.hpp"
+
+
+
+namespace
+{
+    const std::size_t bitCount = 1 << 26;
+    const std::size_t queryCount = 1 << 22;
+
+
+    template <typename Query>
+    double timeQueries(const std::vector<std::size_t>& arguments, Query query)
+    {
+        Stopwatch stopwatch;
+        std::size_t sum = 0;
+
+        stopwatch.start();
+
+        for (std::size_t argument : arguments)
+        {
+            sum += query(argument);
+        }
+
+        stopwatch.stop();
+
+        // Keeps the compiler from discarding the queries.
+        if (sum == 1)
+        {
+            std::cout << "";
+        }
+
+        return stopwatch.lastDuration() * 1000.0 / arguments.size();
+    }
+}
+
+
+
+void runLoudsBenchmark(const std::string& wordFilePath)
+{
+    std::mt19937_64 random{46};
+
+    std::vector<bool> bits(bitCount);
+
+    for (std::size_t i = 0; i < bitCount; ++i)
+    {
+        bits[i] = random() & 1;
+    }
+
+    BitVector v{bits};
+    std::size_t ones = v.rank1(v.size());
+
+    std::vector<std::size_t> positions(queryCount);
+    std::vector<std::size_t> oneRanks(queryCount);
+    std::vector<std::size_t> zeroRanks(queryCount);
+
+    for (std::size_t i = 0; i < queryCount; ++i)
+    {
+        positions[i] = random() % bitCount;
+        oneRanks[i] = random() % ones;
+        zeroRanks[i] = random() % (bitCount - ones);
+    }
+
+    double rankTime = timeQueries(positions, [&](std::size_t i) { return v.rank1(i); });
+    double select1Time = timeQueries(oneRanks, [&](std::size_t k) { return v.select1(k); });
+    double select0Time = timeQueries(zeroRanks, [&](std::size_t k) { return v.select0(k); });
+
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "BitVector of " << bitCount << " random bits ("
+              << 8.0 * v.memoryUsage() / bitCount << " bits of memory per bit)" << std::endl;
+    std::cout << "  rank1:    " << rankTime << "ns" << std::endl;
+    std::cout << "  select1:  " << select1Time << "ns" << std::endl;
+    std::cout << "  select0:  " << select0Time << "ns" << std::endl;
+    std::cout << std::endl;
+
+    std::vector<std::string> words = BenchmarkSupport::loadWordList(wordFilePath);
+
+    // The peak is measured from just before the set is made, so it covers
+    // the words kept while loading as well as finish()'s working storage.
+    std::size_t liveBefore = AllocationCounter::liveBytes();
+    AllocationCounter::resetPeak();
+
+    LoudsTrieSet louds;
+    WordSetLoader{}.load(wordFilePath, louds);
+    louds.finish();
+
+    std::size_t peakBuildBytes = AllocationCounter::peakBytes() - liveBefore;
+
+    // For comparison, the pointer-based structure the words could have
+    // been kept in instead.
+    std::size_t treeBytes;
+
+    {
+        std::size_t liveBeforeTree = AllocationCounter::liveBytes();
+        std::set<std::string> tree{words.begin(), words.end()};
+        treeBytes = AllocationCounter::liveBytes() - liveBeforeTree;
+    }
+
+    std::size_t wordCharacters = 0;
+
+    for (const std::string& word : words)
+    {
+        wordCharacters += word.size();
+    }
+
+    unsigned int hits;
+    double hitTime = BenchmarkSupport::timeLookups(louds, words, hits);
+
+    std::size_t labelBytes = louds.nodeCount() - 1;
+
+    std::cout << "LoudsTrieSet of " << louds.size() << " words" << std::endl;
+    std::cout << "  nodes:             " << louds.nodeCount() << std::endl;
+    std::cout << "  bits per node:     "
+              << 8.0 * (louds.memoryUsage() - labelBytes) / louds.nodeCount()
+              << " plus an 8-bit label" << std::endl;
+    std::cout << "  bytes per word:    " << double(louds.memoryUsage()) / louds.size() << std::endl;
+    std::cout << "  peak while built:  " << peakBuildBytes << " bytes ("
+              << double(peakBuildBytes) / louds.size() << " per word), for "
+              << wordCharacters << " characters of words" << std::endl;
+    std::cout << "  std::set of words: " << treeBytes << " bytes ("
+              << double(treeBytes) / words.size() << " per word)" << std::endl;
+    std::cout << "  lookup:            " << hitTime << "ns, " << hits << " of "
+              << words.size() << " words found" << std::endl;
+}
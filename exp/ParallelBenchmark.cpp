@@ -0,0 +1,134 @@
+// ParallelBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "HashSet.hpp"
+#include "Stopwatch.hpp"
+#include "StringHashing.hpp"
+#include "ThreadPool.hpp"
+#include "WordChecker.hpp"
+#include "WordSetLoader.hpp"
+
+
+
+namespace
+{
+    struct LengthRange
+    {
+        std::string::size_type shortest;
+        std::string::size_type longest;
+    };
+
+
+    // Returns the average time, in microseconds, that findSuggestions()
+    // takes for each of the words, one at a time, as an interactive query
+    // would.
+    double timeQueries(const WordChecker& checker, const std::vector<std::string>& queries)
+    {
+        Stopwatch stopwatch;
+        unsigned long long found = 0;
+
+        stopwatch.start();
+
+        for (const std::string& query : queries)
+        {
+            found += checker.findSuggestions(query).size();
+        }
+
+        stopwatch.stop();
+
+        // Using the suggestions keeps the calls from being optimized away.
+        return found > 0 ? stopwatch.lastDuration() / queries.size() : 0.0;
+    }
+}
+
+
+
+void runParallelBenchmark(const std::string& wordFilePath)
+{
+    HashSet<std::string> words{hashStringAsProduct};
+    WordSetLoader{}.load(wordFilePath, words);
+
+    std::vector<std::string> misspellings =
+        BenchmarkSupport::makeMisspellings(BenchmarkSupport::loadWordList(wordFilePath), 5, 1);
+
+    std::vector<unsigned int> threadCounts{1, 2, 4};
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+
+    if (hardwareThreads > 4)
+    {
+        threadCounts.push_back(hardwareThreads);
+    }
+
+    std::cout << misspellings.size() << " misspellings, " << hardwareThreads
+              << " hardware threads" << std::endl;
+    std::cout << std::endl;
+
+    std::vector<std::unique_ptr<ThreadPool>> pools;
+
+    std::cout << "Length   Queries  Candidates";
+
+    for (unsigned int threads : threadCounts)
+    {
+        pools.push_back(std::make_unique<ThreadPool>(threads - 1));
+        std::cout << std::setw(8) << threads << " thr";
+    }
+
+    std::cout << "   (us per query)" << std::endl;
+
+    for (LengthRange range : {
+             LengthRange{1, 5}, LengthRange{6, 9}, LengthRange{10, 13},
+             LengthRange{14, 17}, LengthRange{18, 100}})
+    {
+        std::vector<std::string> queries;
+
+        for (const std::string& misspelling : misspellings)
+        {
+            if (misspelling.size() >= range.shortest && misspelling.size() <= range.longest)
+            {
+                queries.push_back(misspelling);
+            }
+        }
+
+        if (queries.empty())
+        {
+            continue;
+        }
+
+        // Roughly how many candidates each query looks up: the two halves
+        // of each split, and 53 edits for each character, plus 26 more
+        // insertions at the end.
+        double averageLength = 0.0;
+
+        for (const std::string& query : queries)
+        {
+            averageLength += query.size();
+        }
+
+        averageLength /= queries.size();
+
+        std::cout << std::setw(2) << range.shortest << "-" << std::left
+                  << std::setw(5) << (range.longest >= 100 ? std::string{""} : std::to_string(range.longest))
+                  << std::right << std::setw(8) << queries.size()
+                  << std::fixed << std::setprecision(0)
+                  << std::setw(12) << 2 * (averageLength - 1) + 53 * averageLength + 26;
+
+        for (std::unique_ptr<ThreadPool>& pool : pools)
+        {
+            WordChecker checker{words};
+            checker.useThreadPool(pool.get(), 0);
+
+            std::cout << std::setprecision(1) << std::setw(12) << timeQueries(checker, queries);
+        }
+
+        std::cout << std::endl;
+    }
+}
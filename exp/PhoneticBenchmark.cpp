@@ -0,0 +1,208 @@
+// PhoneticBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include "AllocationCounter.hpp"
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "HashSet.hpp"
+#include "Metaphone.hpp"
+#include "PhoneticIndex.hpp"
+#include "Stopwatch.hpp"
+#include "StringHashing.hpp"
+#include "WordChecker.hpp"
+#include "WordSetLoader.hpp"
+
+
+
+namespace
+{
+    // Spellings that are often written the way they sound, along with how
+    // they sound; each misspelling is made by applying the first of them
+    // that appears in a word.
+    const std::pair<std::string, std::string> respellings[] = {
+        {"PH", "F"}, {"TION", "SHUN"}, {"GH", ""}, {"CK", "K"}, {"KN", "N"},
+        {"WR", "R"}, {"EA", "EE"}, {"QU", "KW"}, {"CE", "SE"}, {"X", "KS"},
+        {"LL", "L"}, {"SS", "S"}, {"TT", "T"}, {"Y", "I"}, {"C", "K"}};
+
+
+    // A misspelling of every stride-th word in the list that can be
+    // respelled as it sounds and isn't then a word itself, paired with the
+    // word it was made from.
+    std::vector<std::pair<std::string, std::string>> makeSoundAlikes(
+        const std::vector<std::string>& words, const HashSet<std::string>& wordSet,
+        unsigned int stride)
+    {
+        std::vector<std::pair<std::string, std::string>> soundAlikes;
+
+        for (std::vector<std::string>::size_type i = 0; i < words.size(); i += stride)
+        {
+            const std::string& word = words[i];
+
+            for (const auto& respelling : respellings)
+            {
+                std::string::size_type at = word.find(respelling.first);
+
+                if (at != std::string::npos)
+                {
+                    std::string misspelling = word;
+                    misspelling.replace(at, respelling.first.size(), respelling.second);
+
+                    if (!misspelling.empty() && !wordSet.contains(misspelling))
+                    {
+                        soundAlikes.emplace_back(misspelling, word);
+                    }
+
+                    break;
+                }
+            }
+        }
+
+        return soundAlikes;
+    }
+
+
+    bool contains(const std::vector<std::string>& suggestions, const std::string& word)
+    {
+        return std::find(suggestions.begin(), suggestions.end(), word) != suggestions.end();
+    }
+
+
+    void printRow(
+        const std::string& name, double time, unsigned long long found,
+        unsigned long long suggestions, std::size_t count)
+    {
+        std::cout << std::left << std::setw(22) << name << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(12) << time
+                  << std::setprecision(1) << std::setw(11) << 100.0 * found / count << "%"
+                  << std::setw(14) << double(suggestions) / count << std::endl;
+    }
+}
+
+
+
+void runPhoneticBenchmark(const std::string& wordFilePath)
+{
+    std::vector<std::string> words = BenchmarkSupport::loadWordList(wordFilePath);
+
+    HashSet<std::string> wordSet{hashStringAsProduct};
+    WordSetLoader{}.load(wordFilePath, wordSet);
+
+    Stopwatch stopwatch;
+
+    // Keys alone, to separate the cost of computing them from the cost of
+    // filing the words.
+    stopwatch.start();
+
+    std::size_t keyCharacters = 0;
+
+    for (const std::string& word : words)
+    {
+        keyCharacters += Metaphone::key(word).size();
+    }
+
+    stopwatch.stop();
+
+    double keyDuration = stopwatch.lastDuration();
+
+    std::size_t liveBefore = AllocationCounter::liveBytes();
+    PhoneticIndex index;
+
+    stopwatch.start();
+
+    for (const std::string& word : words)
+    {
+        index.addWord(word);
+    }
+
+    index.finish();
+    stopwatch.stop();
+
+    double buildDuration = stopwatch.lastDuration();
+    std::size_t bytes = AllocationCounter::liveBytes() - liveBefore;
+
+    std::cout << words.size() << " words, " << index.keyCount() << " distinct keys ("
+              << std::fixed << std::setprecision(1) << double(keyCharacters) / words.size()
+              << " characters on average), largest bucket " << index.largestBucket()
+              << " words" << std::endl;
+    std::cout << "Build: " << std::setprecision(0) << buildDuration << " usec ("
+              << keyDuration << " usec computing keys alone), " << bytes << " bytes ("
+              << std::setprecision(1) << double(bytes) / words.size() << " per word; "
+              << index.memoryUsage() << " reported)" << std::endl;
+    std::cout << std::endl;
+
+    std::vector<std::pair<std::string, std::string>> soundAlikes = makeSoundAlikes(words, wordSet, 25);
+    std::vector<std::string> typos = BenchmarkSupport::makeMisspellings(words, 25, 1);
+
+    std::cout << soundAlikes.size() << " misspellings respelled as they sound (PH as F, CK as K, ...)"
+              << " and " << typos.size() << " made by single random edits" << std::endl;
+    std::cout << "Found is how often the word that was meant is among the suggestions"
+              << " (respellings only)" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Suggestions                  us/word      Found   Suggestions" << std::endl;
+
+    WordChecker checker{wordSet};
+
+    for (bool withSoundAlikes : {false, true})
+    {
+        checker.useSoundAlikes(withSoundAlikes ? &index : nullptr);
+
+        unsigned long long found = 0;
+        unsigned long long suggestions = 0;
+
+        stopwatch.start();
+
+        for (const auto& soundAlike : soundAlikes)
+        {
+            std::vector<std::string> s = checker.findSuggestions(soundAlike.first);
+            found += contains(s, soundAlike.second);
+            suggestions += s.size();
+        }
+
+        stopwatch.stop();
+
+        printRow(
+            withSoundAlikes ? "Distance 1 + phonetic" : "Distance 1",
+            stopwatch.lastDuration() / soundAlikes.size(), found, suggestions, soundAlikes.size());
+    }
+
+    // The index by itself, on both kinds of misspelling: one key and one
+    // bucket per word, whatever kind of misspelling it is.
+    unsigned long long found = 0;
+    unsigned long long suggestions = 0;
+
+    stopwatch.start();
+
+    for (const auto& soundAlike : soundAlikes)
+    {
+        std::vector<std::string> s = index.findSuggestions(soundAlike.first);
+        found += contains(s, soundAlike.second);
+        suggestions += s.size();
+    }
+
+    stopwatch.stop();
+
+    printRow(
+        "Phonetic alone", stopwatch.lastDuration() / soundAlikes.size(),
+        found, suggestions, soundAlikes.size());
+
+    suggestions = 0;
+    stopwatch.start();
+
+    for (const std::string& typo : typos)
+    {
+        suggestions += index.findSuggestions(typo).size();
+    }
+
+    stopwatch.stop();
+
+    std::cout << std::left << std::setw(22) << "Phonetic, random typos" << std::right
+              << std::setprecision(2) << std::setw(12) << stopwatch.lastDuration() / typos.size()
+              << std::setw(12) << "-" << std::setprecision(1) << std::setw(14)
+              << double(suggestions) / typos.size() << std::endl;
+}
@@ -0,0 +1,120 @@
+// PipelineBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "HashSet.hpp"
+#include "SpellChecker.hpp"
+#include "SpellCheckerListener.hpp"
+#include "Stopwatch.hpp"
+#include "StringHashing.hpp"
+#include "TextFileReader.hpp"
+#include "WordChecker.hpp"
+#include "WordSetLoader.hpp"
+
+
+
+namespace
+{
+    // Counts the misspellings it's told about, and the suggestions for
+    // them, so that runs on different numbers of threads can be compared.
+    class CountingListener : public SpellCheckerListener
+    {
+    public:
+        virtual void misspellingFound(
+            const std::string&, const std::string&,
+            const std::vector<std::string>& suggestions) override
+        {
+            ++misspellings;
+            suggestionCount += suggestions.size();
+        }
+
+        unsigned long long misspellings = 0;
+        unsigned long long suggestionCount = 0;
+    };
+
+
+    // Writes a text made of the words in the list, twelve to a line, with
+    // every tenth one misspelled, returning the number of words written.
+    std::size_t writeText(const std::string& path, const std::vector<std::string>& words)
+    {
+        std::vector<std::string> misspellings = BenchmarkSupport::makeMisspellings(words, 10, 1);
+        std::ofstream out{path};
+
+        for (std::size_t i = 0; i < words.size(); ++i)
+        {
+            out << (i % 10 == 0 && i / 10 < misspellings.size() ? misspellings[i / 10] : words[i])
+                << (i % 12 == 11 ? "\n" : " ");
+        }
+
+        out << "\n";
+        return words.size();
+    }
+}
+
+
+
+void runPipelineBenchmark(const std::string& wordFilePath)
+{
+    HashSet<std::string> words{hashStringAsProduct};
+    WordSetLoader{}.load(wordFilePath, words);
+
+    std::string textPath = (std::filesystem::temp_directory_path() / "pipeline_benchmark.txt").string();
+    std::size_t wordCount = writeText(textPath, BenchmarkSupport::loadWordList(wordFilePath));
+
+    std::vector<unsigned int> threadCounts{1, 2, 4};
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+
+    if (hardwareThreads > 4)
+    {
+        threadCounts.push_back(hardwareThreads);
+    }
+
+    std::cout << wordCount << " words of text, " << SpellChecker::chunkWords
+              << " words per chunk, " << hardwareThreads << " hardware threads" << std::endl;
+    std::cout << "1 thread is the ordinary run(), which reads and checks on the calling thread"
+              << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Threads        Time    Words/sec   Speedup  Misspellings  Suggestions" << std::endl;
+
+    Stopwatch stopwatch;
+    double serialDuration = 0.0;
+
+    for (unsigned int threads : threadCounts)
+    {
+        WordChecker checker{words};
+        SpellChecker spellChecker;
+        std::shared_ptr<CountingListener> listener = std::make_shared<CountingListener>();
+        spellChecker.addObserver(listener);
+
+        stopwatch.start();
+        TextFileReader reader{textPath};
+        spellChecker.run(checker, reader, threads);
+        stopwatch.stop();
+
+        double duration = stopwatch.lastDuration();
+
+        if (threads == 1)
+        {
+            serialDuration = duration;
+        }
+
+        std::cout << std::setw(7) << threads << std::fixed << std::setprecision(0)
+                  << std::setw(12) << duration << "usec" << std::setw(9)
+                  << wordCount / (duration / 1e6) << std::setprecision(2) << std::setw(10)
+                  << serialDuration / duration << std::setw(14) << listener->misspellings
+                  << std::setw(13) << listener->suggestionCount << std::endl;
+    }
+
+    std::remove(textPath.c_str());
+}
@@ -0,0 +1,102 @@
+// PruningBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <cctype>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "DictionaryProfile.hpp"
+#include "HashSet.hpp"
+#include "Stopwatch.hpp"
+#include "StringHashing.hpp"
+#include "WordChecker.hpp"
+#include "WordSetLoader.hpp"
+
+
+
+void runPruningBenchmark(const std::string& wordFilePath)
+{
+    HashSet<std::string> words{hashStringAsProduct};
+    WordSetLoader{}.load(wordFilePath, words);
+
+    std::vector<std::string> wordList = BenchmarkSupport::loadWordList(wordFilePath);
+
+    // The first line of the file is the number of words in it, which is
+    // loaded as though it were a word.  It's dropped here; every other word
+    // goes into the profile, whatever characters it has.
+    if (!wordList.empty() && !wordList.front().empty()
+        && std::all_of(
+            wordList.front().begin(), wordList.front().end(),
+            [](unsigned char c) { return std::isdigit(c); }))
+    {
+        wordList.erase(wordList.begin());
+    }
+
+    std::vector<std::string> misspellings = BenchmarkSupport::makeMisspellings(wordList, 30, 1);
+
+    Stopwatch stopwatch;
+
+    stopwatch.start();
+    DictionaryProfile profile;
+
+    for (const std::string& word : wordList)
+    {
+        profile.addWord(word);
+    }
+
+    stopwatch.stop();
+
+    std::cout << misspellings.size() << " misspellings (one edit each)" << std::endl;
+    std::cout << "Profile: built in " << std::fixed << std::setprecision(1)
+              << stopwatch.lastDuration() / 1000.0 << "ms, alphabet of "
+              << profile.alphabet().size() << " characters, " << profile.bigramCount()
+              << " bigrams" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Screening   us/word   Looked up   Pruned   Suggestions" << std::endl;
+
+    const DictionaryProfile* screens[] = {nullptr, &profile};
+
+    for (const DictionaryProfile* screen : screens)
+    {
+        WordChecker checker{words};
+        checker.useDictionaryProfile(screen);
+
+        unsigned long long found = 0;
+
+        stopwatch.start();
+
+        for (const std::string& misspelling : misspellings)
+        {
+            found += checker.findSuggestions(misspelling).size();
+        }
+
+        stopwatch.stop();
+
+        unsigned long long pruned = checker.prunedCandidateCount();
+
+        // The ranked search, asked for every suggestion, tries every
+        // family, so it counts the candidates the one above looked up.
+        unsigned long long lookedUp = 0;
+
+        for (const std::string& misspelling : misspellings)
+        {
+            std::size_t l;
+            checker.findSuggestions(misspelling, std::numeric_limits<unsigned int>::max(), l);
+            lookedUp += l;
+        }
+
+        std::cout << std::left << std::setw(10) << (screen == nullptr ? "none" : "profile")
+                  << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << stopwatch.lastDuration() / misspellings.size()
+                  << std::setw(12) << double(lookedUp) / misspellings.size()
+                  << std::setw(9) << double(pruned) / misspellings.size()
+                  << std::setprecision(2) << std::setw(14) << double(found) / misspellings.size()
+                  << std::endl;
+    }
+}
@@ -0,0 +1,125 @@
+// RankingBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "HashSet.hpp"
+#include "Stopwatch.hpp"
+#include "StringHashing.hpp"
+#include "WordChecker.hpp"
+#include "WordFrequencies.hpp"
+#include "WordSetLoader.hpp"
+
+
+
+namespace
+{
+    // Loads wordfreq.txt from alongside the word set, if there is one;
+    // otherwise, gives the words Zipf-distributed frequencies in an order
+    // chosen the same way every time, which is how word frequencies in
+    // real text are distributed, even if these aren't the real ones.
+    bool loadFrequencies(
+        const std::string& wordFilePath, const std::vector<std::string>& words,
+        WordFrequencies& frequencies)
+    {
+        std::string::size_type slash = wordFilePath.find_last_of('/');
+        std::string path = (slash == std::string::npos ? "" : wordFilePath.substr(0, slash + 1)) + "wordfreq.txt";
+
+        if (std::ifstream{path})
+        {
+            frequencies.load(path);
+            return true;
+        }
+
+        std::vector<std::string> ranked = words;
+        std::shuffle(ranked.begin(), ranked.end(), std::mt19937{12345});
+
+        for (std::vector<std::string>::size_type rank = 0; rank < ranked.size(); ++rank)
+        {
+            frequencies.add(ranked[rank], static_cast<std::uint64_t>(1e9 / (rank + 1)));
+        }
+
+        return false;
+    }
+}
+
+
+
+void runRankingBenchmark(const std::string& wordFilePath)
+{
+    HashSet<std::string> words{hashStringAsProduct};
+    WordSetLoader{}.load(wordFilePath, words);
+
+    std::vector<std::string> wordList = BenchmarkSupport::loadWordList(wordFilePath);
+    std::vector<std::string> misspellings = BenchmarkSupport::makeMisspellings(wordList, 30, 1);
+
+    WordFrequencies frequencies;
+    bool loaded = loadFrequencies(wordFilePath, wordList, frequencies);
+
+    std::cout << misspellings.size() << " misspellings (one edit each), frequencies "
+              << (loaded ? "loaded from wordfreq.txt" : "made up (Zipf-distributed)") << std::endl;
+    std::cout << std::endl;
+
+    WordChecker checker{words};
+    checker.useRanking(&frequencies, 0);
+
+    Stopwatch stopwatch;
+    unsigned long long found = 0;
+
+    stopwatch.start();
+
+    for (const std::string& misspelling : misspellings)
+    {
+        found += checker.findSuggestions(misspelling).size();
+    }
+
+    stopwatch.stop();
+
+    std::cout << "Top        us/word   Looked up   Stopped early   Suggestions" << std::endl;
+
+    std::cout << std::left << std::setw(6) << "all" << std::right << std::fixed
+              << std::setprecision(1) << std::setw(12) << stopwatch.lastDuration() / misspellings.size()
+              << std::setw(12) << "" << std::setw(16) << ""
+              << std::setprecision(2) << std::setw(14) << double(found) / misspellings.size()
+              << std::endl;
+
+    for (unsigned int count : {1u, 3u, 5u, 10u, std::numeric_limits<unsigned int>::max()})
+    {
+        unsigned long long lookedUp = 0;
+        unsigned long long stoppedEarly = 0;
+        found = 0;
+
+        stopwatch.start();
+
+        for (const std::string& misspelling : misspellings)
+        {
+            std::size_t l;
+            found += checker.findSuggestions(misspelling, count, l).size();
+            lookedUp += l;
+
+            // Every family of a word of length n has this many candidates.
+            std::size_t n = misspelling.length();
+            stoppedEarly += l < 2 * (n - 1) + (n - 1) + 26 * n + n + 26 * (n + 1);
+        }
+
+        stopwatch.stop();
+
+        std::cout << std::left << std::setw(6)
+                  << (count == std::numeric_limits<unsigned int>::max() ? std::string{"every"} : std::to_string(count))
+                  << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(12) << stopwatch.lastDuration() / misspellings.size()
+                  << std::setw(12) << double(lookedUp) / misspellings.size()
+                  << std::setw(15) << 100.0 * stoppedEarly / misspellings.size() << "%"
+                  << std::setprecision(2) << std::setw(14) << double(found) / misspellings.size()
+                  << std::endl;
+    }
+}
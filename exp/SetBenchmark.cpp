@@ -0,0 +1,129 @@
+// SetBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include "AllocationCounter.hpp"
+#include "AVLSet.hpp"
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "BSTSet.hpp"
+#include "DafsaSet.hpp"
+#include "DoubleArrayTrieSet.hpp"
+#include "HashSet.hpp"
+#include "HatTrieSet.hpp"
+#include "LoudsTrieSet.hpp"
+#include "RadixTrieSet.hpp"
+#include "Set.hpp"
+#include "SkipListSet.hpp"
+#include "SortedArraySet.hpp"
+#include "Stopwatch.hpp"
+#include "StringHashing.hpp"
+#include "TernarySearchTreeSet.hpp"
+#include "WordSetLoader.hpp"
+
+
+
+namespace
+{
+    struct SetUnderTest
+    {
+        std::string name;
+        std::function<std::unique_ptr<Set<std::string>>()> make;
+
+        // Called once the words have been loaded, for sets that need to be
+        // told that no more words are coming.
+        std::function<void(Set<std::string>&)> finish;
+    };
+
+
+    std::vector<SetUnderTest> allSets()
+    {
+        auto nothing = [](Set<std::string>&) { };
+
+        return {
+            {"AVL", [] { return std::make_unique<AVLSet<std::string>>(); }, nothing},
+            {"BST", [] { return std::make_unique<BSTSet<std::string>>(); }, nothing},
+            {"HASH PRODUCT",
+             [] { return std::make_unique<HashSet<std::string>>(hashStringAsProduct); },
+             nothing},
+            {"HAT TRIE", [] { return std::make_unique<HatTrieSet>(); }, nothing},
+            {"SKIPLIST", [] { return std::make_unique<SkipListSet<std::string>>(); }, nothing},
+            {"RADIX TRIE", [] { return std::make_unique<RadixTrieSet>(); }, nothing},
+            {"TERNARY TREE", [] { return std::make_unique<TernarySearchTreeSet>(); }, nothing},
+            {"DAFSA", [] { return std::make_unique<DafsaSet>(); },
+             [](Set<std::string>& s) { static_cast<DafsaSet&>(s).finish(); }},
+            {"DOUBLE ARRAY", [] { return std::make_unique<DoubleArrayTrieSet>(); },
+             [](Set<std::string>& s) { static_cast<DoubleArrayTrieSet&>(s).finish(); }},
+            {"LOUDS TRIE", [] { return std::make_unique<LoudsTrieSet>(); },
+             [](Set<std::string>& s) { static_cast<LoudsTrieSet&>(s).finish(); }},
+            {"SORTED ARRAY", [] { return std::make_unique<SortedArraySet>(); },
+             [](Set<std::string>& s) { static_cast<SortedArraySet&>(s).finish(); }}
+        };
+    }
+}
+
+
+
+void runSetBenchmark(const std::string& wordFilePath)
+{
+    std::vector<std::string> words = BenchmarkSupport::loadWordList(wordFilePath);
+    std::vector<std::string> candidates = BenchmarkSupport::makeCandidateStream(words, 100);
+
+    std::cout << words.size() << " words, " << candidates.size()
+              << " single-edit candidates" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Structure         LoadTime       Bytes  Bytes/Word   Hit(ns)  Candidate(ns)  Batched(ns)"
+              << std::endl;
+
+    for (const SetUnderTest& test : allSets())
+    {
+        std::unique_ptr<Set<std::string>> set = test.make();
+
+        if (!set->isImplemented())
+        {
+            continue;
+        }
+
+        Stopwatch stopwatch;
+        std::size_t before = AllocationCounter::liveBytes();
+
+        stopwatch.start();
+        WordSetLoader{}.load(wordFilePath, *set);
+        test.finish(*set);
+        stopwatch.stop();
+
+        std::size_t bytes = AllocationCounter::liveBytes() - before;
+
+        unsigned int hits;
+        double hitTime = BenchmarkSupport::timeLookups(*set, words, hits);
+
+        unsigned int candidateHits;
+        double candidateTime = BenchmarkSupport::timeLookups(*set, candidates, candidateHits);
+
+        // In batches about the size of a misspelled word's candidates.
+        unsigned int batchedHits;
+        double batchedTime = BenchmarkSupport::timeBatchedLookups(*set, candidates, 256, batchedHits);
+
+        std::cout << std::left << std::setw(14) << test.name;
+        std::cout << std::right << std::fixed << std::setprecision(0)
+                  << std::setw(11) << stopwatch.lastDuration() << "usec"
+                  << std::setw(12) << bytes
+                  << std::setprecision(1) << std::setw(12) << double(bytes) / words.size()
+                  << std::setw(10) << hitTime
+                  << std::setw(15) << candidateTime
+                  << std::setw(13) << batchedTime;
+
+        if (hits != words.size())
+        {
+            std::cout << "  (only " << hits << " words found!)";
+        }
+
+        std::cout << std::endl;
+    }
+}
@@ -0,0 +1,193 @@
+// SplitBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "DafsaSet.hpp"
+#include "DoubleArrayTrieSet.hpp"
+#include "PrefixIndex.hpp"
+#include "Stopwatch.hpp"
+#include "SuggestionStrategy.hpp"
+#include "WordChecker.hpp"
+
+
+
+namespace
+{
+    // A CountingSet passes lookups through to another set, counting how
+    // many words are looked up.  It isn't a PrefixIndex, even when the set
+    // behind it is, so a WordChecker looks up both halves of every split.
+    class CountingSet : public Set<std::string>
+    {
+    public:
+        explicit CountingSet(const Set<std::string>& words)
+            : words{words}, lookups{0}
+        {
+        }
+
+        virtual bool isImplemented() const
+        {
+            return true;
+        }
+
+        virtual void add(const std::string& element)
+        {
+        }
+
+        virtual bool contains(const std::string& element) const
+        {
+            ++lookups;
+            return words.contains(element);
+        }
+
+        virtual void containsBatch(const std::string* elements, unsigned int count, bool* found) const
+        {
+            lookups += count;
+            words.containsBatch(elements, count, found);
+        }
+
+        virtual unsigned int size() const
+        {
+            return words.size();
+        }
+
+        unsigned long long lookupCount() const
+        {
+            return lookups;
+        }
+
+    private:
+        const Set<std::string>& words;
+        mutable unsigned long long lookups;
+    };
+
+
+    // A CountingPrefixSet is a CountingSet that passes prefix walks
+    // through, too, so that a WordChecker only looks up the second halves.
+    class CountingPrefixSet : public CountingSet, public PrefixIndex
+    {
+    public:
+        CountingPrefixSet(const Set<std::string>& words, const PrefixIndex& prefixes)
+            : CountingSet{words}, prefixes{prefixes}
+        {
+        }
+
+        virtual void findWordPrefixes(
+            const std::string& s, std::vector<std::string::size_type>& lengths) const
+        {
+            prefixes.findWordPrefixes(s, lengths);
+        }
+
+    private:
+        const PrefixIndex& prefixes;
+    };
+
+
+    // A strategy that finds nothing, so that a WordChecker using it only
+    // looks for split words.
+    class NoSuggestions : public SuggestionStrategy
+    {
+    public:
+        virtual void addWord(const std::string& word)
+        {
+        }
+
+        virtual std::vector<std::string> findSuggestions(const std::string& word) const
+        {
+            return {};
+        }
+
+        virtual std::size_t memoryUsage() const
+        {
+            return 0;
+        }
+    };
+
+
+    // Runs the WordChecker over every misspelling, printing a row of the
+    // results.
+    void timeChecker(
+        const char* name, const CountingSet& words, bool splitsOnly,
+        const std::vector<std::string>& misspellings)
+    {
+        NoSuggestions none;
+        WordChecker checker{words};
+
+        if (splitsOnly)
+        {
+            checker.useSuggestionStrategy(&none);
+        }
+
+        unsigned long long found = 0;
+        unsigned long long lookupsBefore = words.lookupCount();
+        Stopwatch stopwatch;
+
+        stopwatch.start();
+
+        for (const std::string& misspelling : misspellings)
+        {
+            found += checker.findSuggestions(misspelling).size();
+        }
+
+        stopwatch.stop();
+
+        std::cout << std::left << std::setw(30) << name << std::setw(10)
+                  << (splitsOnly ? "splits" : "all") << std::right << std::fixed
+                  << std::setprecision(2) << std::setw(10) << stopwatch.lastDuration() / misspellings.size()
+                  << std::setprecision(1) << std::setw(12)
+                  << double(words.lookupCount() - lookupsBefore) / misspellings.size()
+                  << std::setprecision(2) << std::setw(14) << double(found) / misspellings.size()
+                  << std::endl;
+    }
+}
+
+
+
+void runSplitBenchmark(const std::string& wordFilePath)
+{
+    std::vector<std::string> words = BenchmarkSupport::loadWordList(wordFilePath);
+
+    // Compound-heavy text: pairs of words run together, the way technical
+    // writing runs together identifiers and jargon.
+    std::vector<std::string> compounds;
+
+    for (std::vector<std::string>::size_type i = 0; i + 1 < words.size(); i += 61)
+    {
+        compounds.push_back(words[i] + words[(i * 7919 + 1) % words.size()]);
+    }
+
+    DafsaSet dafsa;
+    DoubleArrayTrieSet doubleArray;
+
+    for (const std::string& word : words)
+    {
+        dafsa.add(word);
+        doubleArray.add(word);
+    }
+
+    dafsa.finish();
+    doubleArray.finish();
+
+    std::cout << compounds.size() << " compounds of two words each" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Set, splits found by         Finding   us/word   Lookups/word   Suggestions" << std::endl;
+
+    for (bool splitsOnly : {true, false})
+    {
+        CountingSet dafsaHalves{dafsa};
+        CountingPrefixSet dafsaWalk{dafsa, dafsa};
+        CountingSet doubleArrayHalves{doubleArray};
+        CountingPrefixSet doubleArrayWalk{doubleArray, doubleArray};
+
+        timeChecker("DAFSA, both halves", dafsaHalves, splitsOnly, compounds);
+        timeChecker("DAFSA, prefix walk", dafsaWalk, splitsOnly, compounds);
+        timeChecker("Double array, both halves", doubleArrayHalves, splitsOnly, compounds);
+        timeChecker("Double array, prefix walk", doubleArrayWalk, splitsOnly, compounds);
+    }
+}
@@ -0,0 +1,257 @@
+// SymSpellBenchmark.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+
+#include <iomanip>
+#include <iostream>
+#include <unordered_set>
+#include "AllocationCounter.hpp"
+#include "BenchmarkSupport.hpp"
+#include "Benchmarks.hpp"
+#include "HashSet.hpp"
+#include "Stopwatch.hpp"
+#include "StringHashing.hpp"
+#include "SymSpellIndex.hpp"
+#include "WordChecker.hpp"
+#include "WordSetLoader.hpp"
+
+
+
+namespace
+{
+    const std::string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+
+    // Every string one replacement, deletion, insertion, or swap away from
+    // the given one.
+    std::vector<std::string> singleEdits(const std::string& word)
+    {
+        std::vector<std::string> edits;
+
+        for (std::string::size_type i = 0; i + 1 < word.size(); ++i)
+        {
+            std::string s = word;
+            std::swap(s[i], s[i + 1]);
+            edits.push_back(s);
+        }
+
+        for (std::string::size_type i = 0; i < word.size(); ++i)
+        {
+            std::string s = word;
+            s.erase(i, 1);
+            edits.push_back(s);
+
+            for (char c : alphabet)
+            {
+                s = word;
+                s[i] = c;
+                edits.push_back(s);
+            }
+        }
+
+        for (std::string::size_type i = 0; i <= word.size(); ++i)
+        {
+            for (char c : alphabet)
+            {
+                std::string s = word;
+                s.insert(i, 1, c);
+                edits.push_back(s);
+            }
+        }
+
+        return edits;
+    }
+
+
+    // Finds the words within two edits by brute force: generating every
+    // candidate two edits away and looking each one up, which is what
+    // extending WordChecker::findSuggestions() to distance 2 would mean.
+    unsigned int bruteForceDistanceTwo(const Set<std::string>& words, const std::string& word)
+    {
+        std::unordered_set<std::string> found;
+
+        for (const std::string& once : singleEdits(word))
+        {
+            if (words.contains(once))
+            {
+                found.insert(once);
+            }
+
+            for (const std::string& twice : singleEdits(once))
+            {
+                if (words.contains(twice))
+                {
+                    found.insert(twice);
+                }
+            }
+        }
+
+        return found.size();
+    }
+
+
+    void printRow(
+        const std::string& name, double buildDuration, std::size_t bytes,
+        double entriesPerWord, double distanceOneTime, double distanceTwoTime,
+        double distanceTwoFound)
+    {
+        std::cout << std::left << std::setw(20) << name << std::right << std::fixed
+                  << std::setprecision(0) << std::setw(10) << buildDuration << "usec";
+
+        if (bytes > 0)
+        {
+            std::cout << std::setw(12) << bytes << std::setprecision(1) << std::setw(11) << entriesPerWord;
+        }
+        else
+        {
+            std::cout << std::setw(12) << "-" << std::setw(11) << "-";
+        }
+
+        std::cout << std::setprecision(2) << std::setw(12) << distanceOneTime;
+
+        if (distanceTwoTime > 0.0)
+        {
+            std::cout << std::setw(12) << distanceTwoTime << std::setprecision(1) << std::setw(9) << distanceTwoFound;
+        }
+        else
+        {
+            std::cout << std::setw(12) << "-" << std::setw(9) << "-";
+        }
+
+        std::cout << std::endl;
+    }
+}
+
+
+
+void runSymSpellBenchmark(const std::string& wordFilePath)
+{
+    std::vector<std::string> words = BenchmarkSupport::loadWordList(wordFilePath);
+    std::vector<std::string> distanceOne = BenchmarkSupport::makeMisspellings(words, 50, 1);
+    std::vector<std::string> distanceTwo = BenchmarkSupport::makeMisspellings(words, 50, 2);
+
+    // The brute force search at distance 2 is slow enough that it's only
+    // run on a sample of the misspellings.
+    std::vector<std::string> bruteForceSample;
+
+    for (std::vector<std::string>::size_type i = 0; i < distanceTwo.size(); i += 20)
+    {
+        bruteForceSample.push_back(distanceTwo[i]);
+    }
+
+    std::cout << words.size() << " words, " << distanceOne.size()
+              << " misspellings each at distance 1 and 2 ("
+              << bruteForceSample.size() << " for brute force at distance 2)" << std::endl;
+    std::cout << "Latencies are per misspelling; Found is the average number of words found"
+              << " within distance 2 of those in the brute force sample" << std::endl;
+    std::cout << std::endl;
+
+    std::cout << "Strategy                 Build       Bytes  Entries/Wd  Dist1(us)   Dist2(us)    Found"
+              << std::endl;
+
+    Stopwatch stopwatch;
+
+    HashSet<std::string> hashSet{hashStringAsProduct};
+
+    stopwatch.start();
+    WordSetLoader{}.load(wordFilePath, hashSet);
+    stopwatch.stop();
+
+    double hashSetLoadDuration = stopwatch.lastDuration();
+
+    {
+        WordChecker checker{hashSet};
+
+        stopwatch.start();
+
+        for (const std::string& misspelling : distanceOne)
+        {
+            checker.findSuggestions(misspelling);
+        }
+
+        stopwatch.stop();
+
+        double distanceOneTime = stopwatch.lastDuration() / distanceOne.size();
+
+        unsigned long long found = 0;
+
+        stopwatch.start();
+
+        for (const std::string& misspelling : bruteForceSample)
+        {
+            found += bruteForceDistanceTwo(hashSet, misspelling);
+        }
+
+        stopwatch.stop();
+
+        double distanceTwoTime = stopwatch.lastDuration() / bruteForceSample.size();
+
+        printRow(
+            "Candidates (HASH)", hashSetLoadDuration, 0, 0.0,
+            distanceOneTime, distanceTwoTime, double(found) / bruteForceSample.size());
+    }
+
+    for (unsigned int distance = 1; distance <= 2; ++distance)
+    {
+        std::size_t liveBefore = AllocationCounter::liveBytes();
+
+        SymSpellIndex index{distance};
+
+        stopwatch.start();
+
+        for (const std::string& word : words)
+        {
+            index.addWord(word);
+        }
+
+        index.finish();
+        stopwatch.stop();
+
+        double buildDuration = stopwatch.lastDuration();
+        std::size_t bytes = AllocationCounter::liveBytes() - liveBefore;
+
+        WordChecker checker{hashSet};
+        checker.useSuggestionStrategy(&index);
+
+        stopwatch.start();
+
+        for (const std::string& misspelling : distanceOne)
+        {
+            checker.findSuggestions(misspelling);
+        }
+
+        stopwatch.stop();
+
+        double distanceOneTime = stopwatch.lastDuration() / distanceOne.size();
+        double distanceTwoTime = 0.0;
+        unsigned long long found = 0;
+
+        if (distance == 2)
+        {
+            stopwatch.start();
+
+            for (const std::string& misspelling : distanceTwo)
+            {
+                index.findSuggestions(misspelling);
+            }
+
+            stopwatch.stop();
+
+            distanceTwoTime = stopwatch.lastDuration() / distanceTwo.size();
+
+            // Counted on the same sample as the brute force search, which
+            // finds a few more: two edits in a row can edit the same
+            // character twice, which the edit distance doesn't allow.
+            for (const std::string& misspelling : bruteForceSample)
+            {
+                found += index.findSuggestions(misspelling).size();
+            }
+        }
+
+        printRow(
+            "SYMSPELL " + std::to_string(distance), buildDuration, bytes,
+            double(index.entryCount()) / index.wordCount(),
+            distanceOneTime, distanceTwoTime, double(found) / bruteForceSample.size());
+    }
+}
@@ -3,15 +3,103 @@
 // ICS 46 Spring 2017
 // Project #3: Set the Controls for the Heart of the Sun
 //
-// Do whatever you'd like here.  This is intended to allow you to experiment
-// with your code, outside of the context of the broader program or Google
-// Test.
+// Runs one of the experiments declared in Benchmarks.hpp.  Like the
+// spell checker itself, it reads its input from the standard input: the
+// name of the experiment on the first line and the path to a word set
+// file on the second.  For example:
+//
+//     SETS
+//     wordset.txt
+
+#include <iostream>
+#include <string>
+#include "Benchmarks.hpp"
 
 
 int main()
 {
+    std::string experiment;
+    std::getline(std::cin, experiment);
 
+    std::string wordFilePath;
+    std::getline(std::cin, wordFilePath);
+
+    if (experiment == "SETS")
+    {
+        runSetBenchmark(wordFilePath);
+    }
+    else if (experiment == "DAFSA")
+    {
+        runDafsaBenchmark(wordFilePath);
+    }
+    else if (experiment == "DOUBLE ARRAY")
+    {
+        runDoubleArrayBenchmark(wordFilePath);
+    }
+    else if (experiment == "LOUDS")
+    {
+        runLoudsBenchmark(wordFilePath);
+    }
+    else if (experiment == "FILTERS")
+    {
+        runFilterBenchmark(wordFilePath);
+    }
+    else if (experiment == "SYMSPELL")
+    {
+        runSymSpellBenchmark(wordFilePath);
+    }
+    else if (experiment == "BKTREE")
+    {
+        runBKTreeBenchmark(wordFilePath);
+    }
+    else if (experiment == "AUTOMATON")
+    {
+        runAutomatonBenchmark(wordFilePath);
+    }
+    else if (experiment == "CACHE")
+    {
+        runCacheBenchmark(wordFilePath);
+    }
+    else if (experiment == "PARALLEL")
+    {
+        runParallelBenchmark(wordFilePath);
+    }
+    else if (experiment == "BITPARALLEL")
+    {
+        runBitParallelBenchmark(wordFilePath);
+    }
+    else if (experiment == "RANKING")
+    {
+        runRankingBenchmark(wordFilePath);
+    }
+    else if (experiment == "PRUNING")
+    {
+        runPruningBenchmark(wordFilePath);
+    }
+    else if (experiment == "GENERATORS")
+    {
+        runGeneratorBenchmark(wordFilePath);
+    }
+    else if (experiment == "SPLITS")
+    {
+        runSplitBenchmark(wordFilePath);
+    }
+    else if (experiment == "BUDGET")
+    {
+        runBudgetBenchmark(wordFilePath);
+    }
+    else if (experiment == "PHONETIC")
+    {
+        runPhoneticBenchmark(wordFilePath);
+    }
+    else if (experiment == "PIPELINE")
+    {
+        runPipelineBenchmark(wordFilePath);
+    }
+    else
+    {
+        std::cout << "ERROR: Invalid experiment: " << experiment << std::endl;
+    }
 
     return 0;
 }
-
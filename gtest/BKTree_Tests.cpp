@@ -0,0 +1,203 @@
+// BKTree_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the BKTree.  Its searches are checked against measuring
+// the Levenshtein distance to every word in the dictionary, and the number
+// of nodes it visits against the size of the dictionary, to make sure the
+// pruning happens.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "BKTree.hpp"
+#include "EditDistance.hpp"
+#include "ListSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    const std::vector<std::string> sampleWords{
+        "A", "AN", "AND", "ANT", "ANTS", "ANTHEM", "BE", "BEE", "BEEN",
+        "BEET", "CAT", "CATS", "CART", "CAST", "COAT", "DOG", "GOD", "GOOD",
+        "HE", "HELLO", "HELP", "HELM", "THE", "THEN", "TEN", "TEA"};
+
+
+    BKTree makeTree(const std::vector<std::string>& words, unsigned int maxDistance = 2)
+    {
+        BKTree tree{maxDistance};
+
+        for (const std::string& word : words)
+        {
+            tree.addWord(word);
+        }
+
+        tree.finish();
+        return tree;
+    }
+
+
+    std::vector<std::string> bruteForce(
+        const std::vector<std::string>& words, const std::string& word, unsigned int maxDistance)
+    {
+        std::vector<std::pair<unsigned int, std::string>> found;
+
+        for (const std::string& candidate : words)
+        {
+            unsigned int distance = EditDistance::levenshtein(word, candidate, maxDistance);
+
+            if (distance <= maxDistance)
+            {
+                found.emplace_back(distance, candidate);
+            }
+        }
+
+        std::sort(found.begin(), found.end());
+
+        std::vector<std::string> result;
+
+        for (const auto& f : found)
+        {
+            result.push_back(f.second);
+        }
+
+        return result;
+    }
+
+
+    // Every string of exactly the given length over the letters A-D, in
+    // an order that doesn't favor the tree.
+    std::vector<std::string> allWords(unsigned int length)
+    {
+        std::vector<std::string> words{""};
+
+        for (unsigned int i = 0; i < length; ++i)
+        {
+            std::vector<std::string> longer;
+
+            for (const std::string& word : words)
+            {
+                for (char c : {'D', 'B', 'A', 'C'})
+                {
+                    longer.push_back(word + c);
+                }
+            }
+
+            words = longer;
+        }
+
+        return words;
+    }
+}
+
+
+TEST(BKTree_Tests, findsWordsWithinTheDistanceClosestFirst)
+{
+    BKTree tree = makeTree(sampleWords);
+
+    EXPECT_EQ(
+        (std::vector<std::string>{"HELLO", "HELM", "HELP", "HE"}),
+        tree.findWithin("HELO", 2));
+
+    EXPECT_EQ((std::vector<std::string>{"CAST", "COAT"}), tree.findWithin("COST", 1));
+
+    EXPECT_TRUE(tree.findWithin("XYZZY", 2).empty());
+}
+
+
+TEST(BKTree_Tests, swapsCostTwo)
+{
+    BKTree tree = makeTree(sampleWords);
+
+    EXPECT_EQ((std::vector<std::string>{"TEA", "TEN"}), tree.findWithin("TEH", 1));
+
+    std::vector<std::string> withinTwo = tree.findWithin("TEH", 2);
+    EXPECT_NE(withinTwo.end(), std::find(withinTwo.begin(), withinTwo.end(), "THE"));
+}
+
+
+TEST(BKTree_Tests, agreesWithBruteForce)
+{
+    std::vector<std::string> words = allWords(5);
+    BKTree tree = makeTree(words);
+
+    EXPECT_EQ(words.size(), tree.wordCount());
+
+    for (const char* word : {"", "A", "ABCD", "ABCDA", "DDDDDD", "CABBAGE", "BADDAD"})
+    {
+        for (unsigned int maxDistance = 0; maxDistance <= 3; ++maxDistance)
+        {
+            EXPECT_EQ(bruteForce(words, word, maxDistance), tree.findWithin(word, maxDistance))
+                << word << " " << maxDistance;
+        }
+    }
+}
+
+
+TEST(BKTree_Tests, visitsOnlyPartOfTheTree)
+{
+    std::vector<std::string> words = allWords(6);
+    BKTree tree = makeTree(words);
+
+    std::size_t visited;
+    tree.findWithin("ABCDAB", 1, visited);
+
+    EXPECT_LT(visited, words.size() / 2);
+}
+
+
+TEST(BKTree_Tests, ignoresWordsAddedTwice)
+{
+    BKTree tree = makeTree({"CAT", "CAT", "CUT"}, 1);
+
+    EXPECT_EQ(2, tree.wordCount());
+    EXPECT_EQ((std::vector<std::string>{"CAT", "CUT"}), tree.findSuggestions("CAT"));
+}
+
+
+TEST(BKTree_Tests, findsNothingUntilFinished)
+{
+    BKTree tree;
+    tree.addWord("CAT");
+
+    EXPECT_TRUE(tree.findSuggestions("CAT").empty());
+
+    tree.finish();
+
+    EXPECT_EQ((std::vector<std::string>{"CAT"}), tree.findSuggestions("CAT"));
+}
+
+
+TEST(BKTree_Tests, cannotAddWordsOnceFinished)
+{
+    BKTree tree = makeTree(sampleWords);
+    EXPECT_THROW(tree.addWord("DOGS"), BKTree::BKTreeException);
+}
+
+
+TEST(BKTree_Tests, searchingWithinZeroIsNotAllowed)
+{
+    EXPECT_THROW(BKTree{0}, BKTree::BKTreeException);
+}
+
+
+TEST(BKTree_Tests, wordCheckerUsesTheTreeForEverythingButSplits)
+{
+    ListSet<std::string> words;
+
+    for (const std::string& word : sampleWords)
+    {
+        words.add(word);
+    }
+
+    BKTree tree = makeTree(sampleWords, 1);
+
+    WordChecker checker{words};
+    checker.useSuggestionStrategy(&tree);
+
+    EXPECT_EQ((std::vector<std::string>{"ANT", "ANTS"}), checker.findSuggestions("ANTT"));
+    EXPECT_EQ((std::vector<std::string>{"THE A", "TEA", "THE", "THEN"}), checker.findSuggestions("THEA"));
+}
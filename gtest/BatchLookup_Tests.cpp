@@ -0,0 +1,104 @@
+// BatchLookup_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for Set::containsBatch(): the interleaved overrides in the
+// HashSet, AVLSet, and BSTSet, and the default that the rest of the sets
+// inherit, are checked against contains() on batches of various sizes,
+// including ones that don't divide evenly into groups.
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "AVLSet.hpp"
+#include "BSTSet.hpp"
+#include "Hashing.hpp"
+#include "HashSet.hpp"
+#include "ListSet.hpp"
+
+
+namespace
+{
+    unsigned int hashString(const std::string& s)
+    {
+        return Hashing::mixed32(s);
+    }
+
+
+    // Every third string of up to three of the letters A-D goes into the
+    // set; the batches look up all of them.
+    std::vector<std::string> allStrings()
+    {
+        std::vector<std::string> strings{""};
+
+        for (std::size_t i = 0; i < strings.size(); ++i)
+        {
+            if (strings[i].size() < 3)
+            {
+                for (char c : {'C', 'A', 'D', 'B'})
+                {
+                    strings.push_back(strings[i] + c);
+                }
+            }
+        }
+
+        return strings;
+    }
+
+
+    void expectBatchesMatchContains(Set<std::string>& set)
+    {
+        std::vector<std::string> strings = allStrings();
+
+        for (std::size_t i = 1; i < strings.size(); i += 3)
+        {
+            set.add(strings[i]);
+        }
+
+        for (unsigned int count : {0u, 1u, 15u, 16u, 17u, 40u, unsigned(strings.size())})
+        {
+            std::unique_ptr<bool[]> found{new bool[count + 1]};
+            found[count] = true;
+
+            set.containsBatch(strings.data(), count, found.get());
+
+            for (unsigned int i = 0; i < count; ++i)
+            {
+                EXPECT_EQ(set.contains(strings[i]), found[i]) << strings[i];
+            }
+
+            EXPECT_TRUE(found[count]);
+        }
+    }
+}
+
+
+TEST(BatchLookup_Tests, hashSetMatchesContains)
+{
+    HashSet<std::string> set{hashString};
+    expectBatchesMatchContains(set);
+}
+
+
+TEST(BatchLookup_Tests, avlSetMatchesContains)
+{
+    AVLSet<std::string> set;
+    expectBatchesMatchContains(set);
+}
+
+
+TEST(BatchLookup_Tests, bstSetMatchesContains)
+{
+    BSTSet<std::string> set;
+    expectBatchesMatchContains(set);
+}
+
+
+TEST(BatchLookup_Tests, defaultMatchesContains)
+{
+    ListSet<std::string> set;
+    expectBatchesMatchContains(set);
+}
+
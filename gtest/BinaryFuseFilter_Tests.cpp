@@ -0,0 +1,122 @@
+// BinaryFuseFilter_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the BinaryFuseFilter, with both 8- and 16-bit
+// fingerprints.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "BinaryFuseFilter.hpp"
+#include "FilteredSet.hpp"
+#include "ListSet.hpp"
+
+
+namespace
+{
+    std::vector<std::uint64_t> hashesOf(const std::string& prefix, unsigned int count)
+    {
+        std::vector<std::uint64_t> hashes;
+
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            hashes.push_back(FilteredSet::hashElement(prefix + std::to_string(i)));
+        }
+
+        return hashes;
+    }
+
+
+    template <typename Fingerprint>
+    double measuredRate(const BinaryFuseFilter<Fingerprint>& filter)
+    {
+        std::vector<std::uint64_t> others = hashesOf("OTHER", 500000);
+        unsigned int positives = 0;
+
+        for (std::uint64_t hash : others)
+        {
+            positives += filter.mightContain(hash);
+        }
+
+        return double(positives) / others.size();
+    }
+}
+
+
+TEST(BinaryFuseFilter_Tests, neverRejectsWhatItWasBuiltFrom)
+{
+    for (unsigned int count : {0, 1, 2, 3, 10, 100, 1000, 50000})
+    {
+        std::vector<std::uint64_t> hashes = hashesOf("WORD", count);
+        BinaryFuseFilter<std::uint8_t> filter{hashes};
+
+        for (std::uint64_t hash : hashes)
+        {
+            ASSERT_TRUE(filter.mightContain(hash)) << count;
+        }
+    }
+}
+
+
+TEST(BinaryFuseFilter_Tests, repeatedHashesAreStoredOnce)
+{
+    std::vector<std::uint64_t> hashes = hashesOf("WORD", 1000);
+    std::vector<std::uint64_t> twice = hashes;
+    twice.insert(twice.end(), hashes.begin(), hashes.end());
+
+    BinaryFuseFilter<std::uint8_t> once{hashes};
+    BinaryFuseFilter<std::uint8_t> repeated{twice};
+
+    EXPECT_EQ(once.memoryUsage(), repeated.memoryUsage());
+
+    for (std::uint64_t hash : hashes)
+    {
+        EXPECT_TRUE(repeated.mightContain(hash));
+    }
+}
+
+
+TEST(BinaryFuseFilter_Tests, sizeAndFalsePositiveRateFollowTheFingerprints)
+{
+    std::vector<std::uint64_t> hashes = hashesOf("WORD", 50000);
+
+    BinaryFuseFilter<std::uint8_t> small{hashes};
+    BinaryFuseFilter<std::uint16_t> large{hashes};
+
+    EXPECT_LT(small.memoryUsage() * 8.0 / hashes.size(), 10.0);
+    EXPECT_EQ(2 * small.memoryUsage(), large.memoryUsage());
+
+    EXPECT_NEAR(1.0 / 256, measuredRate(small), 0.001);
+    EXPECT_LT(measuredRate(large), 0.0001);
+}
+
+
+TEST(BinaryFuseFilter_Tests, canFrontASet)
+{
+    ListSet<std::string> list;
+    FilteredSet s{
+        list,
+        [](const std::vector<std::uint64_t>& hashes)
+        {
+            return std::make_unique<BinaryFuseFilter<std::uint8_t>>(hashes);
+        }};
+
+    for (unsigned int i = 0; i < 200; ++i)
+    {
+        s.add("WORD" + std::to_string(i));
+    }
+
+    s.finish();
+    ASSERT_TRUE(s.isFiltering());
+
+    for (unsigned int i = 0; i < 200; ++i)
+    {
+        EXPECT_TRUE(s.contains("WORD" + std::to_string(i)));
+        EXPECT_FALSE(s.contains("OTHER" + std::to_string(i)));
+    }
+
+    EXPECT_EQ(400, s.lookupCount());
+}
@@ -0,0 +1,148 @@
+// BitParallelDistance_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the bit-parallel distance kernels.  Every pairing of
+// short strings is compared against EditDistance, which fills in the
+// table the ordinary way; the functions that compare against many strings
+// at once are given enough of them, of mixed lengths, to fill several
+// groups of lanes and leave some of the last one empty.
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <gtest/gtest.h>
+#include "BitParallelDistance.hpp"
+#include "EditDistance.hpp"
+
+
+namespace
+{
+    // Every string of up to the given length over the letters A-C.
+    std::vector<std::string> allStrings(unsigned int maxLength)
+    {
+        std::vector<std::string> strings{""};
+
+        for (std::size_t i = 0; i < strings.size(); ++i)
+        {
+            if (strings[i].size() < maxLength)
+            {
+                for (char c : {'A', 'B', 'C'})
+                {
+                    strings.push_back(strings[i] + c);
+                }
+            }
+        }
+
+        return strings;
+    }
+
+
+    unsigned int exactDistance(std::string_view a, std::string_view b)
+    {
+        return EditDistance::distance(a, b, a.size() + b.size());
+    }
+
+
+    unsigned int exactLevenshtein(std::string_view a, std::string_view b)
+    {
+        return EditDistance::levenshtein(a, b, a.size() + b.size());
+    }
+}
+
+
+TEST(BitParallelDistance_Tests, measuresEachKindOfEdit)
+{
+    BitParallelDistance::Pattern pattern{"HELLO"};
+
+    EXPECT_EQ(0, BitParallelDistance::distance(pattern, "HELLO"));
+    EXPECT_EQ(1, BitParallelDistance::distance(pattern, "HELO"));
+    EXPECT_EQ(1, BitParallelDistance::distance(pattern, "HELLOS"));
+    EXPECT_EQ(1, BitParallelDistance::distance(pattern, "JELLO"));
+    EXPECT_EQ(1, BitParallelDistance::distance(pattern, "HLELO"));
+    EXPECT_EQ(5, BitParallelDistance::distance(pattern, ""));
+    EXPECT_EQ(5, BitParallelDistance::distance(pattern, "XYZZY"));
+}
+
+
+TEST(BitParallelDistance_Tests, swapsCostTwoInLevenshteinDistance)
+{
+    BitParallelDistance::Pattern pattern{"THE"};
+
+    EXPECT_EQ(1, BitParallelDistance::distance(pattern, "TEH"));
+    EXPECT_EQ(2, BitParallelDistance::levenshtein(pattern, "TEH"));
+}
+
+
+TEST(BitParallelDistance_Tests, agreesWithEditDistanceOnEveryShortPair)
+{
+    std::vector<std::string> strings = allStrings(5);
+
+    for (const std::string& a : strings)
+    {
+        BitParallelDistance::Pattern pattern{a};
+
+        for (const std::string& b : strings)
+        {
+            ASSERT_EQ(exactDistance(a, b), BitParallelDistance::distance(pattern, b)) << a << " " << b;
+            ASSERT_EQ(exactLevenshtein(a, b), BitParallelDistance::levenshtein(pattern, b)) << a << " " << b;
+        }
+    }
+}
+
+
+TEST(BitParallelDistance_Tests, manyAgreesWithOneAtATime)
+{
+    std::vector<std::string> strings = allStrings(5);
+    std::vector<std::string_view> views{strings.begin(), strings.end()};
+
+    // A few that are long enough to need the 32-bit lanes, or more.
+    for (const char* pattern : {"", "A", "ABCAB", "CABBAGECABBAGECABBAGE", "ABCABCABCABCABCABCABCABCABCABCABCABC"})
+    {
+        BitParallelDistance::Pattern p{pattern};
+
+        std::vector<unsigned int> distances(views.size());
+        std::vector<unsigned int> levenshteins(views.size());
+
+        BitParallelDistance::distanceMany(p, views.data(), views.size(), distances.data());
+        BitParallelDistance::levenshteinMany(p, views.data(), views.size(), levenshteins.data());
+
+        for (std::size_t i = 0; i < views.size(); ++i)
+        {
+            ASSERT_EQ(exactDistance(pattern, views[i]), distances[i]) << pattern << " " << views[i];
+            ASSERT_EQ(exactLevenshtein(pattern, views[i]), levenshteins[i]) << pattern << " " << views[i];
+        }
+    }
+}
+
+
+TEST(BitParallelDistance_Tests, manyHandlesStringsLongerThanThePattern)
+{
+    std::vector<std::string> strings{"HELLO", std::string(100, 'H'), "", "HELLO THERE, HELLO AGAIN", "OLLEH"};
+    std::vector<std::string_view> views{strings.begin(), strings.end()};
+
+    BitParallelDistance::Pattern pattern{"HELLO"};
+    std::vector<unsigned int> distances(views.size());
+
+    BitParallelDistance::distanceMany(pattern, views.data(), views.size(), distances.data());
+
+    for (std::size_t i = 0; i < views.size(); ++i)
+    {
+        EXPECT_EQ(exactDistance("HELLO", views[i]), distances[i]) << views[i];
+    }
+}
+
+
+TEST(BitParallelDistance_Tests, patternsLongerThanAWordStillWork)
+{
+    std::string longer(80, 'A');
+    std::string other = longer;
+    other[10] = 'B';
+    other.erase(40, 1);
+
+    BitParallelDistance::Pattern pattern{longer};
+
+    EXPECT_EQ(2, BitParallelDistance::distance(pattern, other));
+    EXPECT_EQ(76, BitParallelDistance::levenshtein(pattern, "AAAA"));
+}
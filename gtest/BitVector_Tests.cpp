@@ -0,0 +1,71 @@
+// BitVector_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the BitVector, checking rank and select against a
+// straightforward count of the bits.
+
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+#include "BitVector.hpp"
+
+
+TEST(BitVector_Tests, rankAndSelectAgreeWithCounting)
+{
+    std::mt19937 random{46};
+
+    // Long enough to span several rank blocks, and not a multiple of 64.
+    std::vector<bool> bits(5000 + 13);
+
+    for (std::size_t i = 0; i < bits.size(); ++i)
+    {
+        // Runs of mostly-ones and mostly-zeros make for uneven blocks.
+        bits[i] = (i / 700) % 2 == 0 ? random() % 8 != 0 : random() % 8 == 0;
+    }
+
+    BitVector v{bits};
+    ASSERT_EQ(bits.size(), v.size());
+
+    std::size_t ones = 0;
+    std::size_t zeros = 0;
+
+    for (std::size_t i = 0; i < bits.size(); ++i)
+    {
+        ASSERT_EQ(bits[i], v.get(i));
+        ASSERT_EQ(ones, v.rank1(i));
+        ASSERT_EQ(zeros, v.rank0(i));
+
+        if (bits[i])
+        {
+            ASSERT_EQ(i, v.select1(ones));
+            ++ones;
+        }
+        else
+        {
+            ASSERT_EQ(i, v.select0(zeros));
+            ++zeros;
+        }
+    }
+
+    EXPECT_EQ(ones, v.rank1(bits.size()));
+}
+
+
+TEST(BitVector_Tests, countsRunsOfOnes)
+{
+    std::vector<bool> bits(200, false);
+
+    for (std::size_t i = 50; i < 180; ++i)
+    {
+        bits[i] = true;
+    }
+
+    BitVector v{bits};
+
+    EXPECT_EQ(0, v.countOnesFrom(0));
+    EXPECT_EQ(130, v.countOnesFrom(50));
+    EXPECT_EQ(100, v.countOnesFrom(80));
+    EXPECT_EQ(0, v.countOnesFrom(180));
+}
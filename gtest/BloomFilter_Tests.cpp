@@ -0,0 +1,92 @@
+// BloomFilter_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the BloomFilter.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "BloomFilter.hpp"
+#include "FilteredSet.hpp"
+
+
+namespace
+{
+    std::vector<std::uint64_t> hashesOf(const std::string& prefix, unsigned int count)
+    {
+        std::vector<std::uint64_t> hashes;
+
+        for (unsigned int i = 0; i < count; ++i)
+        {
+            hashes.push_back(FilteredSet::hashElement(prefix + std::to_string(i)));
+        }
+
+        return hashes;
+    }
+
+
+    double measuredRate(const BloomFilter& filter)
+    {
+        std::vector<std::uint64_t> others = hashesOf("OTHER", 200000);
+        unsigned int positives = 0;
+
+        for (std::uint64_t hash : others)
+        {
+            positives += filter.mightContain(hash);
+        }
+
+        return double(positives) / others.size();
+    }
+}
+
+
+TEST(BloomFilter_Tests, neverRejectsWhatItWasBuiltFrom)
+{
+    std::vector<std::uint64_t> hashes = hashesOf("WORD", 20000);
+    BloomFilter filter{hashes, 0.01};
+
+    for (std::uint64_t hash : hashes)
+    {
+        EXPECT_TRUE(filter.mightContain(hash));
+    }
+}
+
+
+TEST(BloomFilter_Tests, falsePositiveRateIsCloseToTheRequestedOne)
+{
+    std::vector<std::uint64_t> hashes = hashesOf("WORD", 20000);
+
+    for (double rate : {0.1, 0.01, 0.001})
+    {
+        BloomFilter filter{hashes, rate};
+        double measured = measuredRate(filter);
+
+        EXPECT_LT(measured, rate * 1.5) << rate;
+        EXPECT_GT(measured, rate / 10.0) << rate;
+    }
+}
+
+
+TEST(BloomFilter_Tests, smallerRatesTakeMoreMemory)
+{
+    std::vector<std::uint64_t> hashes = hashesOf("WORD", 20000);
+
+    BloomFilter loose{hashes, 0.1};
+    BloomFilter tight{hashes, 0.001};
+
+    EXPECT_LT(loose.memoryUsage(), tight.memoryUsage());
+    EXPECT_LT(loose.hashCount(), tight.hashCount());
+    EXPECT_EQ(64 * tight.blockCount(), tight.memoryUsage());
+}
+
+
+TEST(BloomFilter_Tests, emptyFilterRejectsEverything)
+{
+    BloomFilter filter{{}, 0.01};
+
+    EXPECT_EQ(1, filter.blockCount());
+    EXPECT_LT(measuredRate(filter), 0.001);
+}
@@ -0,0 +1,206 @@
+// CandidateGenerator_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for CandidateGenerator, checking every family against
+// straightforward loops, for words short enough to have their own
+// specialization and words too long for one.
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include "CandidateGenerator.hpp"
+
+
+namespace
+{
+    struct Collector
+    {
+        std::vector<std::string> candidates;
+
+        void operator()(const char* candidate, std::size_t length)
+        {
+            candidates.emplace_back(candidate, length);
+        }
+    };
+
+
+    template <typename... Families>
+    std::vector<std::string> generate(const std::string& word)
+    {
+        Collector collector;
+        CandidateGenerator<UppercaseLetters, Families...>::generate(word, collector);
+        return collector.candidates;
+    }
+
+
+    // The loops a WordChecker has always used, one family at a time.
+    std::vector<std::string> expectedSplits(const std::string& word)
+    {
+        std::vector<std::string> candidates;
+
+        for (std::string::size_type i = 1; i < word.length(); ++i)
+        {
+            candidates.push_back(word.substr(0, i));
+            candidates.push_back(word.substr(i));
+        }
+
+        return candidates;
+    }
+
+
+    std::vector<std::string> expectedSwaps(const std::string& word)
+    {
+        std::vector<std::string> candidates;
+
+        for (std::string::size_type i = 0; i + 1 < word.length(); ++i)
+        {
+            std::string candidate = word;
+            std::swap(candidate[i], candidate[i + 1]);
+            candidates.push_back(candidate);
+        }
+
+        return candidates;
+    }
+
+
+    std::vector<std::string> expectedReplacements(const std::string& word, const std::string& alphabet)
+    {
+        std::vector<std::string> candidates;
+
+        for (char c : alphabet)
+        {
+            for (std::string::size_type x = 0; x < word.length(); ++x)
+            {
+                std::string candidate = word;
+                candidate[x] = c;
+                candidates.push_back(candidate);
+            }
+        }
+
+        return candidates;
+    }
+
+
+    std::vector<std::string> expectedDeletions(const std::string& word)
+    {
+        std::vector<std::string> candidates;
+
+        for (std::string::size_type x = 0; x < word.length(); ++x)
+        {
+            candidates.push_back(std::string{word}.erase(x, 1));
+        }
+
+        return candidates;
+    }
+
+
+    std::vector<std::string> expectedInsertions(const std::string& word, const std::string& alphabet)
+    {
+        std::vector<std::string> candidates;
+
+        for (char c : alphabet)
+        {
+            for (std::string::size_type x = 0; x <= word.length(); ++x)
+            {
+                candidates.push_back(std::string{word}.insert(x, 1, c));
+            }
+        }
+
+        return candidates;
+    }
+
+
+    const std::string uppercase = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+
+    // Words of every length up to a few past the longest specialized one.
+    std::vector<std::string> sampleWords()
+    {
+        const std::string letters = "MISSPELLINGSAREFUNTOFIX";
+        std::vector<std::string> words;
+
+        for (std::size_t n = 0; n <= CandidateGenerator<UppercaseLetters>::maxSpecializedLength + 3; ++n)
+        {
+            words.push_back(letters.substr(0, n));
+        }
+
+        return words;
+    }
+}
+
+
+TEST(CandidateGenerator_Tests, splitsMatchTheLoops)
+{
+    for (const std::string& word : sampleWords())
+    {
+        EXPECT_EQ(expectedSplits(word), generate<Splits>(word)) << word;
+    }
+}
+
+
+TEST(CandidateGenerator_Tests, swapsMatchTheLoops)
+{
+    for (const std::string& word : sampleWords())
+    {
+        EXPECT_EQ(expectedSwaps(word), generate<Swaps>(word)) << word;
+    }
+}
+
+
+TEST(CandidateGenerator_Tests, replacementsMatchTheLoops)
+{
+    for (const std::string& word : sampleWords())
+    {
+        EXPECT_EQ(expectedReplacements(word, uppercase), generate<Replacements>(word)) << word;
+    }
+}
+
+
+TEST(CandidateGenerator_Tests, deletionsMatchTheLoops)
+{
+    for (const std::string& word : sampleWords())
+    {
+        EXPECT_EQ(expectedDeletions(word), generate<Deletions>(word)) << word;
+    }
+}
+
+
+TEST(CandidateGenerator_Tests, insertionsMatchTheLoops)
+{
+    for (const std::string& word : sampleWords())
+    {
+        EXPECT_EQ(expectedInsertions(word, uppercase), generate<Insertions>(word)) << word;
+    }
+}
+
+
+TEST(CandidateGenerator_Tests, familiesComeInTheOrderListed)
+{
+    const std::string word = "TEH";
+
+    std::vector<std::string> expected = expectedDeletions(word);
+    std::vector<std::string> swaps = expectedSwaps(word);
+    expected.insert(expected.end(), swaps.begin(), swaps.end());
+
+    EXPECT_EQ(expected, (generate<Deletions, Swaps>(word)));
+}
+
+
+TEST(CandidateGenerator_Tests, otherAlphabetsCanBeUsed)
+{
+    const std::string word = "dont";
+    const std::string alphabet = "abcdefghijklmnopqrstuvwxyz'";
+
+    Collector collector;
+    CandidateGenerator<LowercaseLettersAndApostrophe, Replacements, Insertions>::generate(word, collector);
+
+    std::vector<std::string> expected = expectedReplacements(word, alphabet);
+    std::vector<std::string> insertions = expectedInsertions(word, alphabet);
+    expected.insert(expected.end(), insertions.begin(), insertions.end());
+
+    EXPECT_EQ(expected, collector.candidates);
+    EXPECT_EQ(27u, LowercaseLettersAndApostrophe::size);
+}
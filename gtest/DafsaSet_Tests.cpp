@@ -0,0 +1,239 @@
+// DafsaSet_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the DafsaSet, including a check that the WordChecker
+// finds the same split words by walking it as it does by probing an
+// ordinary Set.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "DafsaSet.hpp"
+#include "ListSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    const std::vector<std::string> sortedWords{
+        "CAT", "CATS", "DO", "DOG", "DOGS", "HELLO", "HELP", "JUMPED",
+        "JUMPING", "JUMPS", "WALKED", "WALKING", "WALKS"};
+
+
+    std::string readFile(const std::string& path)
+    {
+        std::ifstream in{path, std::ios::binary};
+        return std::string{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+    }
+
+
+    void writeFile(const std::string& path, const std::string& contents)
+    {
+        std::ofstream{path, std::ios::binary} << contents;
+    }
+
+
+    void overwrite(std::string& contents, std::size_t at, std::uint32_t value)
+    {
+        std::memcpy(&contents[at], &value, sizeof(value));
+    }
+}
+
+
+TEST(DafsaSet_Tests, containsOnlyWhatWasAdded)
+{
+    DafsaSet s;
+
+    for (const std::string& word : sortedWords)
+    {
+        s.add(word);
+
+        // Lookups have to work while the set is still being built, too.
+        EXPECT_TRUE(s.contains(word));
+        EXPECT_TRUE(s.contains("CAT"));
+    }
+
+    for (const std::string& word : sortedWords)
+    {
+        EXPECT_TRUE(s.contains(word));
+    }
+
+    EXPECT_FALSE(s.contains(""));
+    EXPECT_FALSE(s.contains("CA"));
+    EXPECT_FALSE(s.contains("WALK"));
+    EXPECT_FALSE(s.contains("JUMPINGS"));
+    EXPECT_EQ(sortedWords.size(), s.size());
+
+    s.finish();
+
+    for (const std::string& word : sortedWords)
+    {
+        EXPECT_TRUE(s.contains(word));
+    }
+
+    EXPECT_FALSE(s.contains("WALK"));
+}
+
+
+TEST(DafsaSet_Tests, sharesSuffixes)
+{
+    DafsaSet s;
+    s.add("JUMPED");
+    s.add("JUMPING");
+    s.add("WALKED");
+    s.add("WALKING");
+    s.finish();
+
+    // J-U-M-P and W-A-L-K each need their own states, but everything after
+    // them (E-D and I-N-G, plus the final state) is shared.
+    EXPECT_EQ(1 + 3 + 3 + 1 + 1 + 2 + 1, s.stateCount());
+}
+
+
+TEST(DafsaSet_Tests, duplicatesAreIgnoredButUnsortedInputIsRejected)
+{
+    DafsaSet s;
+    s.add("DOG");
+    s.add("DOG");
+    EXPECT_EQ(1, s.size());
+
+    EXPECT_THROW(s.add("CAT"), DafsaSet::DafsaException);
+
+    s.finish();
+    EXPECT_THROW(s.add("EMU"), DafsaSet::DafsaException);
+}
+
+
+TEST(DafsaSet_Tests, savedSetsCanBeLoaded)
+{
+    DafsaSet s;
+
+    for (const std::string& word : sortedWords)
+    {
+        s.add(word);
+    }
+
+    s.finish();
+
+    std::string path = testing::TempDir() + "DafsaSet_Tests.dafsa";
+    s.save(path);
+
+    DafsaSet loaded = DafsaSet::load(path);
+    std::remove(path.c_str());
+
+    EXPECT_EQ(s.size(), loaded.size());
+    EXPECT_EQ(s.stateCount(), loaded.stateCount());
+
+    for (const std::string& word : sortedWords)
+    {
+        EXPECT_TRUE(loaded.contains(word));
+    }
+
+    EXPECT_FALSE(loaded.contains("WALK"));
+}
+
+
+TEST(DafsaSet_Tests, corruptSavedSetsAreRejected)
+{
+    DafsaSet s;
+
+    for (const std::string& word : sortedWords)
+    {
+        s.add(word);
+    }
+
+    s.finish();
+
+    std::string path = testing::TempDir() + "DafsaSet_Tests_corrupt.dafsa";
+    s.save(path);
+    const std::string saved = readFile(path);
+
+    // The header is 24 bytes, with the state count at offset 12; then come
+    // the states, the labels, and the targets.
+    const std::size_t statesAt = 24;
+    const std::size_t targetsAt = saved.size() - 4 * s.transitionCount();
+
+    std::string truncated = saved.substr(0, saved.size() - 1);
+
+    std::string hugeStateCount = saved;
+    overwrite(hugeStateCount, 12, 0xffffffffu);
+
+    std::string targetOutOfRange = saved;
+    overwrite(targetOutOfRange, targetsAt, s.stateCount());
+
+    std::string offsetOutOfRange = saved;
+    overwrite(offsetOutOfRange, statesAt + 4 * s.stateCount(), (s.transitionCount() + 1) << 1);
+
+    std::string offsetsDecreasing = saved;
+    overwrite(offsetsDecreasing, statesAt, 2u << 1);
+
+    for (const std::string& corrupt :
+            {truncated, hugeStateCount, targetOutOfRange, offsetOutOfRange, offsetsDecreasing})
+    {
+        writeFile(path, corrupt);
+        EXPECT_THROW(DafsaSet::load(path), DafsaSet::DafsaException);
+    }
+
+    writeFile(path, saved);
+    EXPECT_EQ(s.size(), DafsaSet::load(path).size());
+
+    std::remove(path.c_str());
+}
+
+
+TEST(DafsaSet_Tests, findsEveryPrefixThatIsAWordBeforeAndAfterFinishing)
+{
+    DafsaSet s;
+
+    for (const std::string& word : sortedWords)
+    {
+        s.add(word);
+    }
+
+    for (bool finished : {false, true})
+    {
+        if (finished)
+        {
+            s.finish();
+        }
+
+        std::vector<std::string::size_type> lengths;
+        s.findWordPrefixes("DOGSLED", lengths);
+        EXPECT_EQ((std::vector<std::string::size_type>{2, 3, 4}), lengths);
+
+        lengths.clear();
+        s.findWordPrefixes("WALK", lengths);
+        EXPECT_TRUE(lengths.empty());
+    }
+}
+
+
+TEST(DafsaSet_Tests, wordCheckerSplitsMatchOrdinarySet)
+{
+    DafsaSet dafsa;
+    ListSet<std::string> list;
+
+    for (const std::string& word : sortedWords)
+    {
+        dafsa.add(word);
+        list.add(word);
+    }
+
+    dafsa.finish();
+
+    WordChecker dafsaChecker{dafsa};
+    WordChecker listChecker{list};
+
+    for (const char* word : {"CATSDOG", "DOGCAT", "HELPDO", "DOGSWALKED", "CATT", "X", ""})
+    {
+        EXPECT_EQ(listChecker.findSuggestions(word), dafsaChecker.findSuggestions(word));
+        EXPECT_EQ(listChecker.findSuggestions(word, 5), dafsaChecker.findSuggestions(word, 5));
+    }
+}
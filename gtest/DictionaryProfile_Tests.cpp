@@ -0,0 +1,82 @@
+// DictionaryProfile_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for DictionaryProfile, which records the characters and
+// bigrams that appear in a dictionary's words.
+
+#include <string>
+#include <gtest/gtest.h>
+#include "DictionaryProfile.hpp"
+
+
+namespace
+{
+    unsigned int s(char c)
+    {
+        return DictionaryProfile::symbol(c);
+    }
+}
+
+
+TEST(DictionaryProfile_Tests, emptyProfileHasNothing)
+{
+    DictionaryProfile profile;
+
+    EXPECT_EQ("", profile.alphabet());
+    EXPECT_EQ(0, profile.wordCount());
+    EXPECT_EQ(0, profile.bigramCount());
+    EXPECT_FALSE(profile.hasBigram(DictionaryProfile::wordStart, s('A')));
+}
+
+
+TEST(DictionaryProfile_Tests, alphabetIsSortedAndDistinct)
+{
+    DictionaryProfile profile;
+    profile.addWord("DON'T");
+    profile.addWord("CAT");
+    profile.addWord("TACO");
+
+    EXPECT_EQ("'ACDNOT", profile.alphabet());
+    EXPECT_EQ(3, profile.wordCount());
+}
+
+
+TEST(DictionaryProfile_Tests, bigramsIncludeTheStartAndEnd)
+{
+    DictionaryProfile profile;
+    profile.addWord("CAT");
+
+    EXPECT_TRUE(profile.hasBigram(DictionaryProfile::wordStart, s('C')));
+    EXPECT_TRUE(profile.hasBigram(s('C'), s('A')));
+    EXPECT_TRUE(profile.hasBigram(s('A'), s('T')));
+    EXPECT_TRUE(profile.hasBigram(s('T'), DictionaryProfile::wordEnd));
+    EXPECT_EQ(4, profile.bigramCount());
+
+    EXPECT_FALSE(profile.hasBigram(s('A'), s('C')));
+    EXPECT_FALSE(profile.hasBigram(DictionaryProfile::wordStart, s('A')));
+    EXPECT_FALSE(profile.hasBigram(s('C'), DictionaryProfile::wordEnd));
+}
+
+
+TEST(DictionaryProfile_Tests, repeatedBigramsAreCountedOnce)
+{
+    DictionaryProfile profile;
+    profile.addWord("AA");
+    profile.addWord("AAA");
+
+    EXPECT_EQ(3, profile.bigramCount());
+    EXPECT_EQ("A", profile.alphabet());
+}
+
+
+TEST(DictionaryProfile_Tests, charactersAboveAsciiAreSupported)
+{
+    DictionaryProfile profile;
+    profile.addWord("CAF\xC9");
+
+    EXPECT_TRUE(profile.hasBigram(s('F'), s('\xC9')));
+    EXPECT_TRUE(profile.hasBigram(s('\xC9'), DictionaryProfile::wordEnd));
+    EXPECT_EQ("ACF\xC9", profile.alphabet());
+}
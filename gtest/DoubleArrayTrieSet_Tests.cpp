@@ -0,0 +1,202 @@
+// DoubleArrayTrieSet_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the DoubleArrayTrieSet.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "DoubleArrayTrieSet.hpp"
+
+
+namespace
+{
+    const std::vector<std::string> words{
+        "THE", "A", "THEN", "AN", "THERE", "ANT", "ANTHEM", "ZEBRA", "ZEN", "TO"};
+
+
+    void expectOnlyWords(const DoubleArrayTrieSet& s)
+    {
+        for (const std::string& word : words)
+        {
+            EXPECT_TRUE(s.contains(word));
+        }
+
+        EXPECT_FALSE(s.contains(""));
+        EXPECT_FALSE(s.contains("TH"));
+        EXPECT_FALSE(s.contains("THENS"));
+        EXPECT_FALSE(s.contains("ANTHE"));
+        EXPECT_FALSE(s.contains("Z"));
+        EXPECT_FALSE(s.contains("QUIZ"));
+        EXPECT_EQ(words.size(), s.size());
+    }
+
+
+    std::string readFile(const std::string& path)
+    {
+        std::ifstream in{path, std::ios::binary};
+        return std::string{std::istreambuf_iterator<char>{in}, std::istreambuf_iterator<char>{}};
+    }
+
+
+    void writeFile(const std::string& path, const std::string& contents)
+    {
+        std::ofstream{path, std::ios::binary} << contents;
+    }
+
+
+    void overwrite(std::string& contents, std::size_t at, std::uint32_t value)
+    {
+        std::memcpy(&contents[at], &value, sizeof(value));
+    }
+}
+
+
+TEST(DoubleArrayTrieSet_Tests, containsOnlyWhatWasAddedBeforeAndAfterFinishing)
+{
+    DoubleArrayTrieSet s;
+
+    for (const std::string& word : words)
+    {
+        s.add(word);
+        s.add(word);
+    }
+
+    expectOnlyWords(s);
+
+    s.finish();
+    EXPECT_TRUE(s.isFinished());
+    expectOnlyWords(s);
+
+    EXPECT_THROW(s.add("ZOO"), DoubleArrayTrieSet::DoubleArrayTrieException);
+}
+
+
+TEST(DoubleArrayTrieSet_Tests, emptySetsContainNothing)
+{
+    DoubleArrayTrieSet s;
+    s.finish();
+
+    EXPECT_FALSE(s.contains(""));
+    EXPECT_FALSE(s.contains("A"));
+    EXPECT_EQ(0, s.size());
+}
+
+
+TEST(DoubleArrayTrieSet_Tests, savedSetsCanBeMapped)
+{
+    DoubleArrayTrieSet s;
+
+    for (const std::string& word : words)
+    {
+        s.add(word);
+    }
+
+    s.finish();
+
+    std::string path = testing::TempDir() + "DoubleArrayTrieSet_Tests.dat";
+    s.save(path);
+
+    EXPECT_TRUE(DoubleArrayTrieSet::isSavedFile(path));
+
+    DoubleArrayTrieSet mapped = DoubleArrayTrieSet::map(path);
+    expectOnlyWords(mapped);
+
+    // A copy of a mapped set stands on its own once the mapping is gone.
+    DoubleArrayTrieSet copy{mapped};
+    mapped = DoubleArrayTrieSet{};
+    std::remove(path.c_str());
+
+    expectOnlyWords(copy);
+}
+
+
+TEST(DoubleArrayTrieSet_Tests, corruptSavedSetsAreRejected)
+{
+    DoubleArrayTrieSet s;
+
+    for (const std::string& word : words)
+    {
+        s.add(word);
+    }
+
+    s.finish();
+
+    std::string path = testing::TempDir() + "DoubleArrayTrieSet_Tests_corrupt.dat";
+    s.save(path);
+    const std::string saved = readFile(path);
+
+    // The header is 16 bytes, with the word count at offset 8 and the cell
+    // count at offset 12; then come the base and check arrays.  The last
+    // cell is always taken.
+    const std::uint32_t cells = s.cellCount();
+    const std::size_t lastCheckAt = 16 + 4 * cells + 4 * (cells - 1);
+
+    std::string truncated = saved.substr(0, saved.size() - 1);
+
+    // Doubled in 32 bits, this cell count wraps around to the real one.
+    std::string wrappedCellCount = saved;
+    overwrite(wrappedCellCount, 12, cells + 0x80000000u);
+
+    std::string noCells = saved.substr(0, 16);
+    overwrite(noCells, 12, 0);
+
+    std::string wrongWordCount = saved;
+    overwrite(wrongWordCount, 8, words.size() + 1);
+
+    std::string rootNotTaken = saved;
+    overwrite(rootNotTaken, 16 + 4 * cells, 0xffffffffu);
+
+    std::string checkOutOfRange = saved;
+    overwrite(checkOutOfRange, lastCheckAt, cells);
+
+    for (const std::string& corrupt :
+            {truncated, wrappedCellCount, noCells, wrongWordCount, rootNotTaken, checkOutOfRange})
+    {
+        writeFile(path, corrupt);
+        EXPECT_THROW(DoubleArrayTrieSet::map(path), DoubleArrayTrieSet::DoubleArrayTrieException);
+    }
+
+    writeFile(path, saved);
+    expectOnlyWords(DoubleArrayTrieSet::map(path));
+
+    std::remove(path.c_str());
+}
+
+
+TEST(DoubleArrayTrieSet_Tests, findsEveryPrefixThatIsAWordBeforeAndAfterFinishing)
+{
+    DoubleArrayTrieSet s;
+
+    for (const std::string& word : words)
+    {
+        s.add(word);
+    }
+
+    for (bool finished : {false, true})
+    {
+        if (finished)
+        {
+            s.finish();
+        }
+
+        std::vector<std::string::size_type> lengths;
+        s.findWordPrefixes("ANTHEMS", lengths);
+        EXPECT_EQ((std::vector<std::string::size_type>{1, 2, 3, 6}), lengths);
+
+        lengths.clear();
+        s.findWordPrefixes("THERE", lengths);
+        EXPECT_EQ((std::vector<std::string::size_type>{3, 5}), lengths);
+
+        lengths.clear();
+        s.findWordPrefixes("QUIZ", lengths);
+        EXPECT_TRUE(lengths.empty());
+    }
+}
@@ -0,0 +1,154 @@
+// EditDistance_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the EditDistance functions, checked against the full table
+// computed the obvious way for every pair of short strings over a small
+// alphabet, so that every kind of edit (and every way of exceeding the
+// limit) turns up.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "EditDistance.hpp"
+
+
+namespace
+{
+    unsigned int fullDistance(const std::string& a, const std::string& b, bool withSwaps)
+    {
+        std::vector<std::vector<unsigned int>> d(
+            a.size() + 1, std::vector<unsigned int>(b.size() + 1));
+
+        for (unsigned int i = 0; i <= a.size(); ++i)
+        {
+            for (unsigned int j = 0; j <= b.size(); ++j)
+            {
+                if (i == 0 || j == 0)
+                {
+                    d[i][j] = i + j;
+                    continue;
+                }
+
+                d[i][j] = std::min({
+                    d[i - 1][j] + 1, d[i][j - 1] + 1,
+                    d[i - 1][j - 1] + (a[i - 1] == b[j - 1] ? 0 : 1)});
+
+                if (withSwaps && i >= 2 && j >= 2 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1])
+                {
+                    d[i][j] = std::min(d[i][j], d[i - 2][j - 2] + 1);
+                }
+            }
+        }
+
+        return d[a.size()][b.size()];
+    }
+
+
+    // Every string of up to the given length over the letters A-C.
+    std::vector<std::string> allStrings(unsigned int maxLength)
+    {
+        std::vector<std::string> strings{""};
+
+        for (std::vector<std::string>::size_type i = 0; i < strings.size(); ++i)
+        {
+            if (strings[i].size() < maxLength)
+            {
+                for (char c : {'A', 'B', 'C'})
+                {
+                    strings.push_back(strings[i] + c);
+                }
+            }
+        }
+
+        return strings;
+    }
+}
+
+
+TEST(EditDistance_Tests, countsEachKindOfEdit)
+{
+    EXPECT_EQ(0, EditDistance::distance("CAT", "CAT", 3));
+    EXPECT_EQ(1, EditDistance::distance("CAT", "CUT", 3));
+    EXPECT_EQ(1, EditDistance::distance("CAT", "CAST", 3));
+    EXPECT_EQ(1, EditDistance::distance("CAST", "CAT", 3));
+    EXPECT_EQ(1, EditDistance::distance("CAT", "ACT", 3));
+    EXPECT_EQ(2, EditDistance::distance("CAT", "TAC", 3));
+    EXPECT_EQ(3, EditDistance::distance("", "CAT", 3));
+}
+
+
+TEST(EditDistance_Tests, doesNotEditAnyCharacterTwice)
+{
+    // Swapping, then inserting between the swapped characters, would take
+    // only two edits.
+    EXPECT_EQ(3, EditDistance::distance("CA", "ABC", 3));
+}
+
+
+TEST(EditDistance_Tests, reportsOneMoreThanTheLimitWhenItIsExceeded)
+{
+    EXPECT_EQ(2, EditDistance::distance("CAT", "DOG", 1));
+    EXPECT_EQ(3, EditDistance::distance("HELLO", "HE", 2));
+    EXPECT_EQ(1, EditDistance::distance("A", "B", 0));
+}
+
+
+TEST(EditDistance_Tests, matchesTheFullTableForAllShortStrings)
+{
+    std::vector<std::string> strings = allStrings(5);
+
+    for (const std::string& a : strings)
+    {
+        for (const std::string& b : strings)
+        {
+            unsigned int expected = fullDistance(a, b, true);
+
+            for (unsigned int limit = 0; limit <= 3; ++limit)
+            {
+                ASSERT_EQ(std::min(expected, limit + 1), EditDistance::distance(a, b, limit))
+                    << a << " " << b << " " << limit;
+            }
+        }
+    }
+}
+
+
+TEST(EditDistance_Tests, levenshteinCountsASwapAsTwoEdits)
+{
+    EXPECT_EQ(2, EditDistance::levenshtein("CAT", "ACT", 3));
+    EXPECT_EQ(1, EditDistance::levenshtein("CAT", "CART", 3));
+    EXPECT_EQ(3, EditDistance::levenshtein("CA", "ABC", 3));
+    EXPECT_EQ(3, EditDistance::levenshtein("KITTEN", "SITTING", 5));
+    EXPECT_EQ(3, EditDistance::levenshtein("KITTEN", "SITTING", 2));
+}
+
+
+TEST(EditDistance_Tests, levenshteinMatchesTheFullTableForAllShortStrings)
+{
+    std::vector<std::string> strings = allStrings(5);
+
+    for (const std::string& a : strings)
+    {
+        for (const std::string& b : strings)
+        {
+            unsigned int expected = fullDistance(a, b, false);
+
+            for (unsigned int limit = 0; limit <= 3; ++limit)
+            {
+                ASSERT_EQ(std::min(expected, limit + 1), EditDistance::levenshtein(a, b, limit))
+                    << a << " " << b << " " << limit;
+            }
+        }
+    }
+}
+
+
+TEST(EditDistance_Tests, isExactForLimitsLongerThanTheStrings)
+{
+    EXPECT_EQ(4, EditDistance::distance("ABCD", "WXYZ", 100));
+    EXPECT_EQ(5, EditDistance::levenshtein("HELLO", "", 100));
+    EXPECT_EQ(3, EditDistance::levenshtein("ANTHEM", "THE", 100));
+}
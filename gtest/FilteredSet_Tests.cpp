@@ -0,0 +1,102 @@
+// FilteredSet_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the FilteredSet, using a Bloom filter in front of an
+// ordinary Set.
+
+#include <memory>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "BloomFilter.hpp"
+#include "FilteredSet.hpp"
+#include "ListSet.hpp"
+
+
+namespace
+{
+    std::unique_ptr<MembershipFilter> makeBloomFilter(const std::vector<std::uint64_t>& hashes)
+    {
+        return std::make_unique<BloomFilter>(hashes, 0.01);
+    }
+}
+
+
+TEST(FilteredSet_Tests, answersTheSameAsTheSetBehindIt)
+{
+    ListSet<std::string> list;
+    FilteredSet s{list, makeBloomFilter};
+
+    for (unsigned int i = 0; i < 500; ++i)
+    {
+        s.add("WORD" + std::to_string(i));
+    }
+
+    EXPECT_FALSE(s.isFiltering());
+    s.finish();
+    EXPECT_TRUE(s.isFiltering());
+
+    EXPECT_EQ(500, s.size());
+    EXPECT_EQ(500, list.size());
+
+    for (unsigned int i = 0; i < 500; ++i)
+    {
+        EXPECT_TRUE(s.contains("WORD" + std::to_string(i)));
+        EXPECT_FALSE(s.contains("OTHER" + std::to_string(i)));
+    }
+}
+
+
+TEST(FilteredSet_Tests, countsWhatTheFilterAnswered)
+{
+    ListSet<std::string> list;
+    FilteredSet s{list, makeBloomFilter};
+    s.add("HELLO");
+    s.add("HELLO");
+    s.finish();
+
+    s.contains("HELLO");
+
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+        s.contains("OTHER" + std::to_string(i));
+    }
+
+    EXPECT_EQ(1001, s.lookupCount());
+    EXPECT_EQ(1000, s.rejectionCount() + s.falsePositiveCount());
+    EXPECT_GT(s.rejectionCount(), 950);
+}
+
+
+TEST(FilteredSet_Tests, noFilterWhenTheSetWasFilledSomeOtherWay)
+{
+    ListSet<std::string> list;
+    list.add("HELLO");
+
+    FilteredSet s{list, makeBloomFilter};
+    s.add("WORLD");
+    s.finish();
+
+    EXPECT_FALSE(s.isFiltering());
+    EXPECT_TRUE(s.contains("HELLO"));
+    EXPECT_TRUE(s.contains("WORLD"));
+    EXPECT_EQ(0, s.lookupCount());
+}
+
+
+TEST(FilteredSet_Tests, addingAfterFinishingDiscardsTheFilter)
+{
+    ListSet<std::string> list;
+    FilteredSet s{list, makeBloomFilter};
+    s.add("HELLO");
+    s.finish();
+
+    s.add("HELLO");
+    EXPECT_TRUE(s.isFiltering());
+
+    s.add("WORLD");
+    EXPECT_FALSE(s.isFiltering());
+    EXPECT_TRUE(s.contains("WORLD"));
+}
@@ -0,0 +1,123 @@
+// HatTrieSet_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the HatTrieSet.  Enough words are added to force several
+// containers to burst, so that lookups and prefix searches are checked on
+// both sides of the boundary between trie nodes and containers.
+
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "HatTrieSet.hpp"
+
+
+namespace
+{
+    // Every string of two to five letters drawn from "ABCDEFGHIJ" that
+    // starts with A, B, or C, plus a couple of others; that's over 10,000
+    // strings beginning with each letter, so containers have to burst.
+    void extend(std::vector<std::string>& words, const std::string& word)
+    {
+        if (word.size() >= 2)
+        {
+            words.push_back(word);
+        }
+
+        if (word.size() < 5)
+        {
+            for (char c : std::string{"ABCDEFGHIJ"})
+            {
+                extend(words, word + c);
+            }
+        }
+    }
+
+
+    std::vector<std::string> makeWords()
+    {
+        std::vector<std::string> words;
+
+        for (char first : std::string{"ABC"})
+        {
+            extend(words, std::string{first});
+        }
+
+        words.push_back("A");
+        words.push_back(std::string(300, 'B'));
+        std::sort(words.begin(), words.end());
+        return words;
+    }
+}
+
+
+TEST(HatTrieSet_Tests, containsOnlyWhatWasAdded)
+{
+    std::vector<std::string> words = makeWords();
+    ASSERT_GT(words.size(), HatTrieSet::BURST_THRESHOLD);
+
+    HatTrieSet s;
+
+    // Adding them backward (and twice) keeps this from depending on order.
+    for (auto it = words.rbegin(); it != words.rend(); ++it)
+    {
+        s.add(*it);
+        s.add(*it);
+    }
+
+    EXPECT_EQ(words.size(), s.size());
+
+    for (const std::string& word : words)
+    {
+        EXPECT_TRUE(s.contains(word));
+    }
+
+    EXPECT_FALSE(s.contains(""));
+    EXPECT_FALSE(s.contains("B"));
+    EXPECT_FALSE(s.contains("AK"));
+    EXPECT_FALSE(s.contains("ABCDEF"));
+    EXPECT_FALSE(s.contains("DA"));
+    EXPECT_FALSE(s.contains(std::string(299, 'B')));
+}
+
+
+TEST(HatTrieSet_Tests, wordsWithPrefixAreSorted)
+{
+    std::vector<std::string> words = makeWords();
+
+    HatTrieSet s;
+
+    for (const std::string& word : words)
+    {
+        s.add(word);
+    }
+
+    EXPECT_EQ(words, s.wordsWithPrefix(""));
+
+    for (std::string prefix : {"A", "AB", "ABC", "ABCD", "ABCDE", "C", "CJJ", "BB", "D"})
+    {
+        std::vector<std::string> expected;
+
+        std::copy_if(
+            words.begin(), words.end(), std::back_inserter(expected),
+            [&](const std::string& word) { return word.compare(0, prefix.size(), prefix) == 0; });
+
+        EXPECT_EQ(expected, s.wordsWithPrefix(prefix));
+    }
+}
+
+
+TEST(HatTrieSet_Tests, copiesAreIndependent)
+{
+    HatTrieSet s1;
+    s1.add("HELLO");
+
+    HatTrieSet s2{s1};
+    s2.add("HELP");
+
+    EXPECT_TRUE(s2.contains("HELLO"));
+    EXPECT_FALSE(s1.contains("HELP"));
+}
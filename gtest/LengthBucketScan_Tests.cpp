@@ -0,0 +1,194 @@
+// LengthBucketScan_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the LengthBucketScan.  Its searches are checked against
+// a SymSpellIndex, which measures the same distance, and the number of
+// words it scans against the size of the dictionary, to make sure that
+// only the nearby lengths are looked at.
+
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <gtest/gtest.h>
+#include "LengthBucketScan.hpp"
+#include "ListSet.hpp"
+#include "SymSpellIndex.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    const std::vector<std::string> sampleWords{
+        "A", "AN", "AND", "ANT", "ANTS", "ANTHEM", "BE", "BEE", "BEEN",
+        "BEET", "CAT", "CATS", "CART", "CAST", "COAT", "DOG", "GOD", "GOOD",
+        "HE", "HELLO", "HELP", "HELM", "THE", "THEN", "TEN", "TEA"};
+
+
+    LengthBucketScan makeScan(const std::vector<std::string>& words, unsigned int maxDistance = 2)
+    {
+        LengthBucketScan scan{maxDistance};
+
+        for (const std::string& word : words)
+        {
+            scan.addWord(word);
+        }
+
+        scan.finish();
+        return scan;
+    }
+
+
+    // Every string of up to the given length over the letters A-D.
+    std::vector<std::string> allWords(unsigned int maxLength)
+    {
+        std::vector<std::string> words{""};
+
+        for (std::size_t i = 0; i < words.size(); ++i)
+        {
+            if (words[i].size() < maxLength)
+            {
+                for (char c : {'D', 'B', 'A', 'C'})
+                {
+                    words.push_back(words[i] + c);
+                }
+            }
+        }
+
+        return words;
+    }
+}
+
+
+TEST(LengthBucketScan_Tests, findsWordsWithinTheDistanceClosestFirst)
+{
+    LengthBucketScan scan = makeScan(sampleWords);
+
+    EXPECT_EQ(
+        (std::vector<std::string>{"HELLO", "HELM", "HELP", "HE"}),
+        scan.findWithin("HELO", 2));
+
+    EXPECT_EQ((std::vector<std::string>{"CAST", "COAT"}), scan.findWithin("COST", 1));
+
+    EXPECT_TRUE(scan.findWithin("XYZZY", 2).empty());
+}
+
+
+TEST(LengthBucketScan_Tests, swapsCostOne)
+{
+    LengthBucketScan scan = makeScan(sampleWords);
+
+    EXPECT_EQ((std::vector<std::string>{"TEA", "TEN", "THE"}), scan.findWithin("TEH", 1));
+}
+
+
+TEST(LengthBucketScan_Tests, agreesWithSymSpell)
+{
+    std::vector<std::string> words = allWords(5);
+    LengthBucketScan scan = makeScan(words);
+
+    SymSpellIndex index{2};
+
+    for (const std::string& word : words)
+    {
+        index.addWord(word);
+    }
+
+    index.finish();
+
+    EXPECT_EQ(words.size(), scan.wordCount());
+
+    for (const char* word : {"", "A", "ABCD", "ABCDA", "DDDDDD", "CABBAGE", "BADDAD"})
+    {
+        EXPECT_EQ(index.findSuggestions(word), scan.findSuggestions(word)) << word;
+    }
+}
+
+
+TEST(LengthBucketScan_Tests, scansOnlyNearbyLengths)
+{
+    std::vector<std::string> words = allWords(6);
+    LengthBucketScan scan = makeScan(words);
+
+    std::size_t scanned;
+    scan.findWithin("ABC", 1, scanned);
+
+    // The words of lengths 2 through 4.
+    EXPECT_EQ(16 + 64 + 256, scanned);
+}
+
+
+TEST(LengthBucketScan_Tests, ignoresWordsAddedTwice)
+{
+    LengthBucketScan scan = makeScan({"CAT", "CAT", "CUT"}, 1);
+
+    EXPECT_EQ(2, scan.wordCount());
+    EXPECT_EQ((std::vector<std::string>{"CAT", "CUT"}), scan.findSuggestions("CAT"));
+}
+
+
+TEST(LengthBucketScan_Tests, findsNothingUntilFinished)
+{
+    LengthBucketScan scan;
+    scan.addWord("CAT");
+
+    EXPECT_TRUE(scan.findSuggestions("CAT").empty());
+
+    scan.finish();
+
+    EXPECT_EQ((std::vector<std::string>{"CAT"}), scan.findSuggestions("CAT"));
+}
+
+
+TEST(LengthBucketScan_Tests, movedScansStillFindTheirWords)
+{
+    static_assert(!std::is_copy_constructible_v<LengthBucketScan>);
+    static_assert(!std::is_copy_assignable_v<LengthBucketScan>);
+
+    auto original = std::make_unique<LengthBucketScan>(makeScan(sampleWords));
+    LengthBucketScan moved{std::move(*original)};
+    original.reset();
+
+    EXPECT_EQ((std::vector<std::string>{"CAST", "COAT"}), moved.findWithin("COST", 1));
+
+    LengthBucketScan assigned;
+    assigned = std::move(moved);
+
+    EXPECT_EQ((std::vector<std::string>{"CAST", "COAT"}), assigned.findWithin("COST", 1));
+    EXPECT_EQ(sampleWords.size(), assigned.wordCount());
+}
+
+
+TEST(LengthBucketScan_Tests, cannotAddWordsOnceFinished)
+{
+    LengthBucketScan scan = makeScan(sampleWords);
+    EXPECT_THROW(scan.addWord("DOGS"), LengthBucketScan::LengthBucketScanException);
+}
+
+
+TEST(LengthBucketScan_Tests, searchingWithinZeroIsNotAllowed)
+{
+    EXPECT_THROW(LengthBucketScan{0}, LengthBucketScan::LengthBucketScanException);
+}
+
+
+TEST(LengthBucketScan_Tests, wordCheckerUsesTheScanForEverythingButSplits)
+{
+    ListSet<std::string> words;
+
+    for (const std::string& word : sampleWords)
+    {
+        words.add(word);
+    }
+
+    LengthBucketScan scan = makeScan(sampleWords, 1);
+
+    WordChecker checker{words};
+    checker.useSuggestionStrategy(&scan);
+
+    EXPECT_EQ((std::vector<std::string>{"ANT", "ANTS"}), checker.findSuggestions("ANTT"));
+    EXPECT_EQ((std::vector<std::string>{"THE A", "TEA", "THE", "THEN"}), checker.findSuggestions("THEA"));
+}
@@ -0,0 +1,125 @@
+// LevenshteinAutomaton_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the LevenshteinAutomaton.  Running it over every short
+// string and comparing the distance it reports to EditDistance::distance()
+// covers every combination of edits, including swaps, that fits.
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "EditDistance.hpp"
+#include "LevenshteinAutomaton.hpp"
+
+
+namespace
+{
+    // Runs the automaton over the given string, returning the distance it
+    // reports, or maxDistance + 1 if it dies along the way.
+    unsigned int run(const LevenshteinAutomaton& automaton, const std::string& s, unsigned int maxDistance)
+    {
+        LevenshteinAutomaton::State state = automaton.start();
+
+        for (char c : s)
+        {
+            if (automaton.isDead(state))
+            {
+                return maxDistance + 1;
+            }
+
+            state = automaton.step(state, c);
+        }
+
+        return automaton.distance(state);
+    }
+
+
+    // Every string of up to the given length over the letters A-C.
+    std::vector<std::string> allStrings(unsigned int maxLength)
+    {
+        std::vector<std::string> strings{""};
+
+        for (std::size_t i = 0; i < strings.size(); ++i)
+        {
+            if (strings[i].size() < maxLength)
+            {
+                for (char c : {'A', 'B', 'C'})
+                {
+                    strings.push_back(strings[i] + c);
+                }
+            }
+        }
+
+        return strings;
+    }
+}
+
+
+TEST(LevenshteinAutomaton_Tests, acceptsEachKindOfEdit)
+{
+    LevenshteinAutomaton automaton{"HELLO", 1};
+
+    EXPECT_EQ(0, run(automaton, "HELLO", 1));
+    EXPECT_EQ(1, run(automaton, "HELO", 1));
+    EXPECT_EQ(1, run(automaton, "HELLOS", 1));
+    EXPECT_EQ(1, run(automaton, "JELLO", 1));
+    EXPECT_EQ(1, run(automaton, "HLELO", 1));
+    EXPECT_EQ(2, run(automaton, "HLEOL", 1));
+    EXPECT_EQ(2, run(automaton, "HELP", 1));
+}
+
+
+TEST(LevenshteinAutomaton_Tests, diesOnceNothingCanBeAccepted)
+{
+    LevenshteinAutomaton automaton{"CAT", 1};
+    LevenshteinAutomaton::State state = automaton.start();
+
+    state = automaton.step(state, 'X');
+    EXPECT_FALSE(automaton.isDead(state));
+
+    state = automaton.step(state, 'Y');
+    EXPECT_TRUE(automaton.isDead(state));
+}
+
+
+TEST(LevenshteinAutomaton_Tests, matchesEditDistanceForAllShortStrings)
+{
+    std::vector<std::string> strings = allStrings(5);
+
+    for (unsigned int maxDistance = 1; maxDistance <= LevenshteinAutomaton::maxSupportedDistance; ++maxDistance)
+    {
+        for (const std::string& word : strings)
+        {
+            LevenshteinAutomaton automaton{word, maxDistance};
+
+            for (const std::string& s : strings)
+            {
+                ASSERT_EQ(EditDistance::distance(word, s, maxDistance), run(automaton, s, maxDistance))
+                    << word << " " << s << " " << maxDistance;
+            }
+        }
+    }
+}
+
+
+TEST(LevenshteinAutomaton_Tests, handlesTheLongestWords)
+{
+    std::string word(LevenshteinAutomaton::maxWordLength, 'A');
+    LevenshteinAutomaton automaton{word, 2};
+
+    EXPECT_EQ(0, run(automaton, word, 2));
+    EXPECT_EQ(1, run(automaton, word + "A", 2));
+    EXPECT_EQ(2, run(automaton, word.substr(2), 2));
+    EXPECT_EQ(3, run(automaton, word.substr(3), 2));
+}
+
+
+TEST(LevenshteinAutomaton_Tests, acceptsNothingForLongerWords)
+{
+    std::string word(LevenshteinAutomaton::maxWordLength + 1, 'A');
+    LevenshteinAutomaton automaton{word, 2};
+
+    EXPECT_TRUE(automaton.isDead(automaton.start()));
+}
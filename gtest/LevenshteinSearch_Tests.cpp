@@ -0,0 +1,211 @@
+// LevenshteinSearch_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the LevenshteinSearch.  Its searches are checked against
+// measuring the distance to every word in the dictionary, and the number
+// of DAFSA states it visits against the number there are, to make sure
+// dead paths are abandoned.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "DafsaSet.hpp"
+#include "EditDistance.hpp"
+#include "LevenshteinSearch.hpp"
+#include "ListSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    const std::vector<std::string> sampleWords{
+        "A", "AN", "AND", "ANT", "ANTHEM", "ANTS", "BE", "BEE", "BEEN",
+        "BEET", "CART", "CAST", "CAT", "CATS", "COAT", "DOG", "GOD", "GOOD",
+        "HE", "HELLO", "HELM", "HELP", "TEA", "TEN", "THE", "THEN"};
+
+
+    LevenshteinSearch makeSearch(const std::vector<std::string>& words, unsigned int maxDistance = 2)
+    {
+        LevenshteinSearch search{maxDistance};
+
+        for (const std::string& word : words)
+        {
+            search.addWord(word);
+        }
+
+        search.finish();
+        return search;
+    }
+
+
+    std::vector<std::string> bruteForce(
+        const std::vector<std::string>& words, const std::string& word, unsigned int maxDistance)
+    {
+        std::vector<std::pair<unsigned int, std::string>> found;
+
+        for (const std::string& candidate : words)
+        {
+            unsigned int distance = EditDistance::distance(word, candidate, maxDistance);
+
+            if (distance <= maxDistance)
+            {
+                found.emplace_back(distance, candidate);
+            }
+        }
+
+        std::sort(found.begin(), found.end());
+
+        std::vector<std::string> result;
+
+        for (const auto& f : found)
+        {
+            result.push_back(f.second);
+        }
+
+        return result;
+    }
+
+
+    // Every string of exactly the given length over the letters A-D, in
+    // sorted order.
+    std::vector<std::string> allWords(unsigned int length)
+    {
+        std::vector<std::string> words{""};
+
+        for (unsigned int i = 0; i < length; ++i)
+        {
+            std::vector<std::string> longer;
+
+            for (const std::string& word : words)
+            {
+                for (char c : {'A', 'B', 'C', 'D'})
+                {
+                    longer.push_back(word + c);
+                }
+            }
+
+            words = longer;
+        }
+
+        return words;
+    }
+}
+
+
+TEST(LevenshteinSearch_Tests, findsWordsWithinTheDistanceClosestFirst)
+{
+    LevenshteinSearch search = makeSearch(sampleWords);
+
+    EXPECT_EQ(
+        (std::vector<std::string>{"HELLO", "HELM", "HELP", "HE"}),
+        search.findWithin("HELO", 2));
+
+    EXPECT_EQ((std::vector<std::string>{"CAST", "COAT"}), search.findWithin("COST", 1));
+
+    EXPECT_TRUE(search.findWithin("XYZZY", 2).empty());
+}
+
+
+TEST(LevenshteinSearch_Tests, swapsCostOne)
+{
+    LevenshteinSearch search = makeSearch(sampleWords);
+
+    EXPECT_EQ((std::vector<std::string>{"TEA", "TEN", "THE"}), search.findWithin("TEH", 1));
+}
+
+
+TEST(LevenshteinSearch_Tests, agreesWithBruteForce)
+{
+    std::vector<std::string> words = allWords(5);
+    LevenshteinSearch search = makeSearch(words);
+
+    for (const char* word : {"", "A", "ABCD", "ABCDA", "DDDDDD", "CABBAGE", "BADDAD"})
+    {
+        for (unsigned int maxDistance = 0; maxDistance <= 3; ++maxDistance)
+        {
+            EXPECT_EQ(bruteForce(words, word, maxDistance), search.findWithin(word, maxDistance))
+                << word << " " << maxDistance;
+        }
+    }
+
+    for (const std::string& word : sampleWords)
+    {
+        EXPECT_EQ(bruteForce(sampleWords, word, 2), makeSearch(sampleWords).findWithin(word, 2))
+            << word;
+    }
+}
+
+
+TEST(LevenshteinSearch_Tests, visitsOnlyPartOfTheDafsa)
+{
+    std::vector<std::string> words = allWords(6);
+    LevenshteinSearch search = makeSearch(words);
+
+    // The word itself, 18 replacements, and 5 swaps.
+    std::size_t visited;
+    EXPECT_EQ(24, search.findWithin("ABCDAB", 1, visited).size());
+
+    // A walk of the whole DAFSA would visit a state for every prefix of
+    // every word, which is more than there are words.
+    EXPECT_LT(visited, words.size() / 10);
+}
+
+
+TEST(LevenshteinSearch_Tests, findsNothingUntilFinished)
+{
+    LevenshteinSearch search;
+    search.addWord("CAT");
+
+    EXPECT_TRUE(search.findSuggestions("CAT").empty());
+
+    search.finish();
+
+    EXPECT_EQ((std::vector<std::string>{"CAT"}), search.findSuggestions("CAT"));
+}
+
+
+TEST(LevenshteinSearch_Tests, wordsMustBeAddedInOrder)
+{
+    LevenshteinSearch search;
+    search.addWord("DOG");
+
+    EXPECT_THROW(search.addWord("CAT"), DafsaSet::DafsaException);
+}
+
+
+TEST(LevenshteinSearch_Tests, distanceMustBeSupported)
+{
+    EXPECT_THROW(LevenshteinSearch{0}, LevenshteinSearch::LevenshteinSearchException);
+    EXPECT_THROW(LevenshteinSearch{4}, LevenshteinSearch::LevenshteinSearchException);
+}
+
+
+TEST(LevenshteinSearch_Tests, wordCheckerFindsTheSameSuggestionsAsByGeneratingCandidates)
+{
+    ListSet<std::string> words;
+
+    for (const std::string& word : sampleWords)
+    {
+        words.add(word);
+    }
+
+    LevenshteinSearch search = makeSearch(sampleWords, 1);
+
+    WordChecker generating{words};
+    WordChecker searching{words};
+    searching.useSuggestionStrategy(&search);
+
+    for (const char* word : {"ANTT", "THEA", "TEH", "HELO", "CAAT", "GOOOD", "XYZZY"})
+    {
+        std::vector<std::string> expected = generating.findSuggestions(word);
+        std::vector<std::string> actual = searching.findSuggestions(word);
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+
+        EXPECT_EQ(expected, actual) << word;
+    }
+}
@@ -0,0 +1,137 @@
+// LoudsTrieSet_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the LoudsTrieSet.
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "LoudsTrieSet.hpp"
+
+
+TEST(LoudsTrieSet_Tests, containsOnlyWhatWasAddedBeforeAndAfterFinishing)
+{
+    const std::vector<std::string> words{
+        "", "A", "I", "IN", "INN", "TEA", "TED", "TEN", "TO"};
+
+    LoudsTrieSet s;
+
+    for (const std::string& word : words)
+    {
+        s.add(word);
+    }
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        for (const std::string& word : words)
+        {
+            EXPECT_TRUE(s.contains(word));
+        }
+
+        EXPECT_FALSE(s.contains("T"));
+        EXPECT_FALSE(s.contains("TE"));
+        EXPECT_FALSE(s.contains("TEAS"));
+        EXPECT_FALSE(s.contains("INNS"));
+        EXPECT_FALSE(s.contains("B"));
+        EXPECT_EQ(words.size(), s.size());
+
+        s.finish();
+    }
+
+    // The classic example from the LOUDS literature: the root, T, A, I,
+    // TO, TE, IN, TEA, TED, TEN, INN.
+    EXPECT_EQ(11, s.nodeCount());
+
+    EXPECT_THROW(s.add("TEE"), LoudsTrieSet::LoudsTrieException);
+}
+
+
+TEST(LoudsTrieSet_Tests, emptySetsContainNothing)
+{
+    LoudsTrieSet s;
+    s.finish();
+
+    EXPECT_FALSE(s.contains(""));
+    EXPECT_FALSE(s.contains("A"));
+    EXPECT_EQ(1, s.nodeCount());
+}
+
+
+TEST(LoudsTrieSet_Tests, prefixesOfWordsAreNotWords)
+{
+    LoudsTrieSet s;
+    s.add("CAT");
+    s.add("CATALOG");
+    s.add("CATALOGS");
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        EXPECT_FALSE(s.contains("C"));
+        EXPECT_FALSE(s.contains("CA"));
+        EXPECT_TRUE(s.contains("CAT"));
+        EXPECT_FALSE(s.contains("CATA"));
+        EXPECT_FALSE(s.contains("CATALO"));
+        EXPECT_TRUE(s.contains("CATALOG"));
+        EXPECT_TRUE(s.contains("CATALOGS"));
+        EXPECT_FALSE(s.contains("CATALOGSS"));
+
+        s.finish();
+    }
+}
+
+
+TEST(LoudsTrieSet_Tests, theEmptyStringIsOnlyContainedWhenAdded)
+{
+    LoudsTrieSet without;
+    without.add("A");
+
+    LoudsTrieSet with;
+    with.add("");
+    with.add("A");
+
+    for (int pass = 0; pass < 2; ++pass)
+    {
+        EXPECT_FALSE(without.contains(""));
+        EXPECT_TRUE(with.contains(""));
+        EXPECT_TRUE(with.contains("A"));
+        EXPECT_EQ(2, with.size());
+
+        without.finish();
+        with.finish();
+    }
+
+    EXPECT_EQ(2, with.nodeCount());
+}
+
+
+TEST(LoudsTrieSet_Tests, longSingleChainsAreWalkedToTheEnd)
+{
+    const std::string chain(5000, 'Q');
+
+    LoudsTrieSet s;
+    s.add(chain);
+    s.finish();
+
+    EXPECT_EQ(chain.size() + 1, s.nodeCount());
+    EXPECT_TRUE(s.contains(chain));
+    EXPECT_FALSE(s.contains(chain.substr(0, chain.size() - 1)));
+    EXPECT_FALSE(s.contains(chain + "Q"));
+    EXPECT_FALSE(s.contains(chain.substr(0, 2500) + "R"));
+}
+
+
+TEST(LoudsTrieSet_Tests, duplicatesAreIgnoredButUnsortedInputIsRejected)
+{
+    LoudsTrieSet s;
+    s.add("BEE");
+    s.add("BEE");
+
+    EXPECT_EQ(1, s.size());
+    EXPECT_THROW(s.add("ANT"), LoudsTrieSet::LoudsTrieException);
+    EXPECT_THROW(s.add("BE"), LoudsTrieSet::LoudsTrieException);
+
+    s.add("BEES");
+    EXPECT_EQ(2, s.size());
+}
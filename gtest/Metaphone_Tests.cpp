@@ -0,0 +1,66 @@
+// Metaphone_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for Metaphone keys, mostly checking that pairs of words that
+// sound alike, as misspellings often do, get the same key.
+
+#include <string>
+#include <gtest/gtest.h>
+#include "Metaphone.hpp"
+
+
+TEST(Metaphone_Tests, keepsOnlyTheFirstVowel)
+{
+    EXPECT_EQ("KT", Metaphone::key("CAT"));
+    EXPECT_EQ("ANT", Metaphone::key("ANT"));
+    EXPECT_EQ("ATMN", Metaphone::key("AUTUMN"));
+}
+
+
+TEST(Metaphone_Tests, ignoresCaseAndCharactersThatAreNotLetters)
+{
+    EXPECT_EQ(Metaphone::key("DON'T"), Metaphone::key("dont"));
+    EXPECT_EQ("", Metaphone::key("'"));
+    EXPECT_EQ("", Metaphone::key(""));
+}
+
+
+TEST(Metaphone_Tests, dropsSilentLetters)
+{
+    EXPECT_EQ("NT", Metaphone::key("KNIGHT"));
+    EXPECT_EQ("RT", Metaphone::key("WRITE"));
+    EXPECT_EQ("0M", Metaphone::key("THUMB"));
+    EXPECT_EQ("SN", Metaphone::key("SIGN"));
+}
+
+
+TEST(Metaphone_Tests, countsDoubledLettersOnce)
+{
+    EXPECT_EQ(Metaphone::key("LETTER"), Metaphone::key("LETER"));
+    EXPECT_EQ("AKSPT", Metaphone::key("ACCEPT"));
+}
+
+
+TEST(Metaphone_Tests, givesSoundAlikesTheSameKey)
+{
+    const std::pair<std::string, std::string> soundAlikes[] = {
+        {"PHONE", "FONE"}, {"KNIGHT", "NITE"}, {"WRITE", "RIGHT"},
+        {"SCIENCE", "SIENSE"}, {"KNOWLEDGE", "NOLIJ"}, {"PHYSICS", "FIZIKS"},
+        {"XYLOPHONE", "ZYLOFONE"}, {"NATION", "NASHUN"}, {"CAT", "KAT"}};
+
+    for (const auto& pair : soundAlikes)
+    {
+        EXPECT_EQ(Metaphone::key(pair.first), Metaphone::key(pair.second))
+            << pair.first << " and " << pair.second;
+    }
+}
+
+
+TEST(Metaphone_Tests, givesDifferentSoundsDifferentKeys)
+{
+    EXPECT_NE(Metaphone::key("CAT"), Metaphone::key("BAT"));
+    EXPECT_NE(Metaphone::key("THIN"), Metaphone::key("TIN"));
+    EXPECT_NE(Metaphone::key("SHIP"), Metaphone::key("SIP"));
+}
@@ -0,0 +1,180 @@
+// PhoneticIndex_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the PhoneticIndex, and for a WordChecker that follows its
+// suggestions by the sound-alikes the index finds.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ListSet.hpp"
+#include "Metaphone.hpp"
+#include "PhoneticIndex.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    const std::vector<std::string> sampleWords{
+        "CAT", "CATS", "COAT", "KITE", "KNIGHT", "NIGHT", "NOTE", "PHONE",
+        "PHYSICS", "KNOWLEDGE", "RIGHT", "WRITE", "RATE", "THE", "SCIENCE"};
+
+
+    PhoneticIndex makeIndex(std::size_t maxSuggestions = 10)
+    {
+        PhoneticIndex index{maxSuggestions};
+
+        for (const std::string& word : sampleWords)
+        {
+            index.addWord(word);
+        }
+
+        index.finish();
+        return index;
+    }
+}
+
+
+TEST(PhoneticIndex_Tests, findsWordsThatSoundAlike)
+{
+    PhoneticIndex index = makeIndex();
+
+    EXPECT_EQ((std::vector<std::string>{"PHONE"}), index.findSuggestions("FONE"));
+    EXPECT_EQ((std::vector<std::string>{"PHYSICS"}), index.findSuggestions("FIZIKS"));
+    EXPECT_EQ((std::vector<std::string>{"KNOWLEDGE"}), index.findSuggestions("NOLIJ"));
+}
+
+
+TEST(PhoneticIndex_Tests, findsOnlyWordsWithTheSameKey)
+{
+    PhoneticIndex index = makeIndex();
+
+    for (const char* word : {"NITE", "RITE", "KAT", "SIENSE", "ZZZ"})
+    {
+        for (const std::string& found : index.findSuggestions(word))
+        {
+            EXPECT_EQ(Metaphone::key(word), Metaphone::key(found)) << word << " and " << found;
+        }
+    }
+}
+
+
+TEST(PhoneticIndex_Tests, returnsClosestFirstWithTiesInSortedOrder)
+{
+    PhoneticIndex index = makeIndex();
+
+    EXPECT_EQ((std::vector<std::string>{"NOTE", "NIGHT", "KNIGHT"}), index.findSuggestions("NITE"));
+    EXPECT_EQ((std::vector<std::string>{"RATE", "WRITE", "RIGHT"}), index.findSuggestions("RITE"));
+}
+
+
+TEST(PhoneticIndex_Tests, returnsNoMoreThanItsLimit)
+{
+    PhoneticIndex index = makeIndex(2);
+
+    EXPECT_EQ((std::vector<std::string>{"NOTE", "NIGHT"}), index.findSuggestions("NITE"));
+}
+
+
+TEST(PhoneticIndex_Tests, findsTheWordItselfOnce)
+{
+    PhoneticIndex index{10};
+    index.addWord("CAT");
+    index.addWord("CAT");
+    index.addWord("KAT");
+    index.finish();
+
+    EXPECT_EQ((std::vector<std::string>{"CAT", "KAT"}), index.findSuggestions("CAT"));
+}
+
+
+TEST(PhoneticIndex_Tests, findsNothingForWordsWithoutLetters)
+{
+    PhoneticIndex index{10};
+    index.addWord("'");
+    index.addWord("A");
+    index.finish();
+
+    EXPECT_EQ(1u, index.wordCount());
+    EXPECT_TRUE(index.findSuggestions("'").empty());
+}
+
+
+TEST(PhoneticIndex_Tests, findsNothingUntilFinished)
+{
+    PhoneticIndex index{10};
+    index.addWord("PHONE");
+
+    EXPECT_FALSE(index.isFinished());
+    EXPECT_TRUE(index.findSuggestions("FONE").empty());
+
+    index.finish();
+
+    EXPECT_TRUE(index.isFinished());
+    EXPECT_EQ((std::vector<std::string>{"PHONE"}), index.findSuggestions("FONE"));
+}
+
+
+TEST(PhoneticIndex_Tests, cannotAddWordsOnceFinished)
+{
+    PhoneticIndex index = makeIndex();
+
+    EXPECT_THROW(index.addWord("DOG"), PhoneticIndex::PhoneticException);
+}
+
+
+TEST(PhoneticIndex_Tests, cannotBeAskedForNoSuggestions)
+{
+    EXPECT_THROW(PhoneticIndex{0}, PhoneticIndex::PhoneticException);
+}
+
+
+TEST(PhoneticIndex_Tests, countsWordsAndKeys)
+{
+    PhoneticIndex index = makeIndex();
+
+    EXPECT_EQ(sampleWords.size(), index.wordCount());
+
+    std::vector<std::string> keys;
+
+    for (const std::string& word : sampleWords)
+    {
+        keys.push_back(Metaphone::key(word));
+    }
+
+    std::sort(keys.begin(), keys.end());
+    keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+
+    EXPECT_EQ(keys.size(), index.keyCount());
+    EXPECT_GE(index.largestBucket(), 3u);
+    EXPECT_GT(index.memoryUsage(), 0u);
+}
+
+
+TEST(PhoneticIndex_Tests, wordCheckerFollowsItsSuggestionsBySoundAlikes)
+{
+    ListSet<std::string> words;
+
+    for (const std::string& word : sampleWords)
+    {
+        words.add(word);
+    }
+
+    PhoneticIndex index = makeIndex();
+    WordChecker checker{words};
+
+    std::vector<std::string> withoutSoundAlikes = checker.findSuggestions("NITE");
+
+    checker.useSoundAlikes(&index);
+    std::vector<std::string> withSoundAlikes = checker.findSuggestions("NITE");
+
+    // KITE and NOTE are one edit away; NIGHT and KNIGHT only sound alike.
+    EXPECT_EQ((std::vector<std::string>{"KITE", "NOTE"}), withoutSoundAlikes);
+    EXPECT_EQ((std::vector<std::string>{"KITE", "NOTE", "NIGHT", "KNIGHT"}), withSoundAlikes);
+
+    checker.useSoundAlikes(nullptr);
+    EXPECT_EQ(withoutSoundAlikes, checker.findSuggestions("NITE"));
+}
@@ -0,0 +1,151 @@
+// RadixTrieSet_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the RadixTrieSet, including checks that the WordChecker
+// finds the same suggestions when it walks the trie directly as it does
+// when it probes an ordinary Set.
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ListSet.hpp"
+#include "RadixTrieSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    const std::vector<std::string> sampleWords{
+        "A", "AN", "AND", "ANT", "ANTS", "ANTHEM", "BE", "BEE", "BEEN",
+        "BEET", "CAT", "CATS", "CART", "CAST", "COAT", "DOG", "GOD", "GOOD",
+        "HE", "HELLO", "HELP", "HELM", "THE", "THEN", "TEN", "TEA"};
+}
+
+
+TEST(RadixTrieSet_Tests, containsOnlyWhatWasAdded)
+{
+    RadixTrieSet s;
+
+    for (const std::string& word : sampleWords)
+    {
+        s.add(word);
+    }
+
+    for (const std::string& word : sampleWords)
+    {
+        EXPECT_TRUE(s.contains(word));
+    }
+
+    EXPECT_FALSE(s.contains(""));
+    EXPECT_FALSE(s.contains("ANTHE"));
+    EXPECT_FALSE(s.contains("BEETS"));
+    EXPECT_FALSE(s.contains("C"));
+    EXPECT_FALSE(s.contains("ZEBRA"));
+}
+
+
+TEST(RadixTrieSet_Tests, sizeIgnoresDuplicates)
+{
+    RadixTrieSet s;
+    s.add("ANTHEM");
+    s.add("ANT");
+    s.add("ANTHEM");
+    s.add("ANT");
+    s.add("AN");
+
+    EXPECT_EQ(3, s.size());
+}
+
+
+TEST(RadixTrieSet_Tests, copiesAreIndependent)
+{
+    RadixTrieSet s1;
+    s1.add("HELLO");
+
+    RadixTrieSet s2{s1};
+    s2.add("HELP");
+
+    EXPECT_TRUE(s2.contains("HELLO"));
+    EXPECT_TRUE(s2.contains("HELP"));
+    EXPECT_FALSE(s1.contains("HELP"));
+    EXPECT_EQ(1, s1.size());
+}
+
+
+TEST(RadixTrieSet_Tests, cursorStopsWhereNoWordContinues)
+{
+    RadixTrieSet s;
+    s.add("HELLO");
+
+    RadixTrieSet::Cursor c = s.cursor();
+    EXPECT_TRUE(c.advance('H'));
+    EXPECT_TRUE(c.advance('E'));
+    EXPECT_FALSE(c.advance('X'));
+    EXPECT_TRUE(c.advance('L'));
+    EXPECT_FALSE(c.isWord());
+}
+
+
+TEST(RadixTrieSet_Tests, wordCheckerSuggestionsMatchOrdinarySet)
+{
+    RadixTrieSet trie;
+    ListSet<std::string> list;
+
+    for (const std::string& word : sampleWords)
+    {
+        trie.add(word);
+        list.add(word);
+    }
+
+    WordChecker trieChecker{trie};
+    WordChecker listChecker{list};
+
+    for (const char* word : {"TEH", "ANTT", "HELO", "CAAT", "GODO", "BEEE", "ANDTHE", "X", ""})
+    {
+        EXPECT_EQ(listChecker.findSuggestions(word), trieChecker.findSuggestions(word));
+    }
+}
+
+
+TEST(RadixTrieSet_Tests, findsEveryPrefixThatIsAWord)
+{
+    RadixTrieSet s;
+
+    for (const std::string& word : sampleWords)
+    {
+        s.add(word);
+    }
+
+    std::vector<std::string::size_type> lengths;
+    s.findWordPrefixes("ANTHEMS", lengths);
+    EXPECT_EQ((std::vector<std::string::size_type>{1, 2, 3, 6}), lengths);
+
+    lengths.clear();
+    s.findWordPrefixes("XANT", lengths);
+    EXPECT_TRUE(lengths.empty());
+}
+
+
+TEST(RadixTrieSet_Tests, rankedSplitsMatchOrdinarySet)
+{
+    RadixTrieSet trie;
+    ListSet<std::string> list;
+
+    for (const std::string& word : sampleWords)
+    {
+        trie.add(word);
+        list.add(word);
+    }
+
+    // Ranked suggestions are always looked up in batches, so the trie's
+    // prefix walk is what finds the splits here.
+    WordChecker trieChecker{trie};
+    WordChecker listChecker{list};
+
+    for (const char* word : {"ANDTHE", "THEDOG", "CATSDOG", "BEEGOD", "HELP"})
+    {
+        EXPECT_EQ(listChecker.findSuggestions(word, 10), trieChecker.findSuggestions(word, 10));
+    }
+}
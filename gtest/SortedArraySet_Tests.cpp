@@ -0,0 +1,98 @@
+// SortedArraySet_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the SortedArraySet.  Several of the words share their
+// first 8 characters, so that lookups have to fall back to the arena.
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "SortedArraySet.hpp"
+
+
+namespace
+{
+    const std::vector<std::string> sortedWords{
+        "A", "AN", "AND", "CAT", "CATS", "DOG", "INTERNAL", "INTERNALLY",
+        "INTERNATIONAL", "INTERNATIONALLY", "INTERNATIONALS", "INTERNET",
+        "WALK", "WALKED", "WALKING"};
+}
+
+
+TEST(SortedArraySet_Tests, containsOnlyWhatWasAdded)
+{
+    SortedArraySet s;
+
+    for (const std::string& word : sortedWords)
+    {
+        s.add(word);
+        EXPECT_TRUE(s.contains(word));
+        EXPECT_TRUE(s.contains("A"));
+    }
+
+    s.finish();
+
+    for (const std::string& word : sortedWords)
+    {
+        EXPECT_TRUE(s.contains(word));
+    }
+
+    EXPECT_EQ(sortedWords.size(), s.size());
+
+    for (const char* word : {"", "B", "ANT", "CA", "INTERNA", "INTERNALS",
+                             "INTERNATIONA", "INTERNATIONALLYS", "INTERNETS", "ZZZ"})
+    {
+        EXPECT_FALSE(s.contains(word)) << word;
+    }
+}
+
+
+TEST(SortedArraySet_Tests, emptySetContainsNothing)
+{
+    SortedArraySet s;
+    EXPECT_FALSE(s.contains(""));
+    EXPECT_FALSE(s.contains("A"));
+    EXPECT_EQ(0, s.size());
+
+    s.add("");
+    EXPECT_TRUE(s.contains(""));
+    EXPECT_FALSE(s.contains("A"));
+}
+
+
+TEST(SortedArraySet_Tests, duplicatesAreIgnoredButUnsortedInputIsRejected)
+{
+    SortedArraySet s;
+    s.add("DOG");
+    s.add("DOG");
+    EXPECT_EQ(1, s.size());
+
+    EXPECT_THROW(s.add("CAT"), SortedArraySet::SortedArrayException);
+
+    s.finish();
+    EXPECT_THROW(s.add("EMU"), SortedArraySet::SortedArrayException);
+}
+
+
+TEST(SortedArraySet_Tests, memoryIsOnlyTheArrays)
+{
+    SortedArraySet s;
+
+    for (const std::string& word : sortedWords)
+    {
+        s.add(word);
+    }
+
+    s.finish();
+
+    std::size_t characters = 0;
+
+    for (const std::string& word : sortedWords)
+    {
+        characters += word.size();
+    }
+
+    EXPECT_EQ(characters + 4 * (sortedWords.size() + 1) + 8 * sortedWords.size(), s.memoryUsage());
+}
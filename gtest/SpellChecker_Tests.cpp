@@ -0,0 +1,138 @@
+// SpellChecker_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for checking a text on several threads, whose misspellings
+// are checked against the ones reported when checking it on one.
+
+#include <fstream>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ListSet.hpp"
+#include "SpellChecker.hpp"
+#include "SpellCheckerListener.hpp"
+#include "TextFileReader.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    using Report = std::tuple<std::string, std::string, std::vector<std::string>>;
+
+
+    class RecordingListener : public SpellCheckerListener
+    {
+    public:
+        virtual void misspellingFound(
+            const std::string& word, const std::string& line,
+            const std::vector<std::string>& suggestions) override
+        {
+            reports.emplace_back(word, line, suggestions);
+        }
+
+        std::vector<Report> reports;
+    };
+
+
+    const std::vector<std::string> dictionary{
+        "THE", "CAT", "SAT", "ON", "A", "MAT", "AND", "DOG", "RAN", "OFF"};
+
+    const std::vector<std::string> misspellings{"TEH", "CTA", "SATT", "NO", "MATS", "DGO"};
+
+
+    std::string writeFile(const std::string& name, const std::string& contents)
+    {
+        std::string path = testing::TempDir() + name;
+        std::ofstream{path} << contents;
+        return path;
+    }
+
+
+    // A text whose lines run from one word to a few times the length of a
+    // chunk, some of them repeated, with a misspelling every so often.
+    std::string makeText()
+    {
+        std::string text;
+        unsigned int n = 0;
+
+        for (unsigned int lineNumber = 0; lineNumber < 200; ++lineNumber)
+        {
+            unsigned int length = lineNumber % 50 == 7 ? 3 * SpellChecker::chunkWords : 1 + lineNumber % 23;
+
+            for (unsigned int i = 0; i < length; ++i, ++n)
+            {
+                text += (i > 0 ? " " : "");
+                text += n % 11 == 3 ? misspellings[n % misspellings.size()] : dictionary[n % dictionary.size()];
+            }
+
+            text += "\n";
+
+            if (lineNumber % 40 == 0)
+            {
+                text += "the cat sat on teh mat\nthe cat sat on teh mat\n";
+            }
+        }
+
+        return text;
+    }
+
+
+    std::vector<Report> check(const std::string& path, unsigned int threadCount)
+    {
+        ListSet<std::string> words;
+
+        for (const std::string& word : dictionary)
+        {
+            words.add(word);
+        }
+
+        WordChecker wordChecker{words};
+        SpellChecker spellChecker;
+        std::shared_ptr<RecordingListener> listener = std::make_shared<RecordingListener>();
+        spellChecker.addObserver(listener);
+
+        TextFileReader reader{path};
+        spellChecker.run(wordChecker, reader, threadCount);
+
+        return listener->reports;
+    }
+}
+
+
+TEST(SpellChecker_Tests, reportsTheSameMisspellingsInTheSameOrderOnAnyNumberOfThreads)
+{
+    std::string path = writeFile("spellchecker_text.txt", makeText());
+    std::vector<Report> expected = check(path, 1);
+
+    ASSERT_GT(expected.size(), 100u);
+
+    for (unsigned int threadCount : {2, 3, 8})
+    {
+        EXPECT_EQ(expected, check(path, threadCount)) << threadCount << " threads";
+    }
+}
+
+
+TEST(SpellChecker_Tests, reportsEachMisspellingWithItsOwnLine)
+{
+    std::string path = writeFile("spellchecker_lines.txt", "the cat\nteh cat\n\nthe cta sat\n");
+    std::vector<Report> reports = check(path, 4);
+
+    ASSERT_EQ(2u, reports.size());
+    EXPECT_EQ("TEH", std::get<0>(reports[0]));
+    EXPECT_EQ("teh cat", std::get<1>(reports[0]));
+    EXPECT_EQ("CTA", std::get<0>(reports[1]));
+    EXPECT_EQ("the cta sat", std::get<1>(reports[1]));
+}
+
+
+TEST(SpellChecker_Tests, reportsNothingForAnEmptyText)
+{
+    std::string path = writeFile("spellchecker_empty.txt", "");
+
+    EXPECT_TRUE(check(path, 4).empty());
+}
@@ -0,0 +1,186 @@
+// SuggestionCache_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the SuggestionCache.  Caches holding fewer than a few
+// hundred words aren't split into shards, so the order in which the
+// CLOCK evicts their entries is predictable.
+
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ListSet.hpp"
+#include "SuggestionCache.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    std::vector<std::string> suggestionsFor(const std::string& word)
+    {
+        return {word + "S", word + "Y"};
+    }
+
+
+    bool isCached(SuggestionCache& cache, const std::string& word)
+    {
+        std::vector<std::string> suggestions;
+        return cache.find(word, suggestions);
+    }
+}
+
+
+TEST(SuggestionCache_Tests, findsWhatWasInserted)
+{
+    SuggestionCache cache{10};
+    cache.insert("CAT", suggestionsFor("CAT"));
+
+    std::vector<std::string> suggestions{"UNCHANGED"};
+
+    EXPECT_FALSE(cache.find("DOG", suggestions));
+    EXPECT_EQ(std::vector<std::string>{"UNCHANGED"}, suggestions);
+
+    EXPECT_TRUE(cache.find("CAT", suggestions));
+    EXPECT_EQ(suggestionsFor("CAT"), suggestions);
+}
+
+
+TEST(SuggestionCache_Tests, insertingAgainReplacesTheSuggestions)
+{
+    SuggestionCache cache{10};
+    cache.insert("CAT", suggestionsFor("CAT"));
+    cache.insert("CAT", suggestionsFor("DOG"));
+
+    std::vector<std::string> suggestions;
+
+    EXPECT_EQ(1, cache.size());
+    EXPECT_TRUE(cache.find("CAT", suggestions));
+    EXPECT_EQ(suggestionsFor("DOG"), suggestions);
+}
+
+
+TEST(SuggestionCache_Tests, countsHitsAndMisses)
+{
+    SuggestionCache cache{10};
+    EXPECT_EQ(0.0, cache.hitRate());
+
+    cache.insert("CAT", suggestionsFor("CAT"));
+
+    isCached(cache, "CAT");
+    isCached(cache, "CAT");
+    isCached(cache, "CAT");
+    isCached(cache, "DOG");
+
+    EXPECT_EQ(3, cache.hits());
+    EXPECT_EQ(1, cache.misses());
+    EXPECT_DOUBLE_EQ(0.75, cache.hitRate());
+}
+
+
+TEST(SuggestionCache_Tests, evictsTheOldestWordsThatHaventBeenUsed)
+{
+    SuggestionCache cache{100};
+
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+        cache.insert("W" + std::to_string(i), suggestionsFor("W"));
+    }
+
+    EXPECT_EQ(100, cache.size());
+    EXPECT_EQ(900, cache.evictions());
+
+    for (unsigned int i = 0; i < 1000; ++i)
+    {
+        EXPECT_EQ(i >= 900, isCached(cache, "W" + std::to_string(i))) << i;
+    }
+}
+
+
+TEST(SuggestionCache_Tests, wordsUsedSinceTheHandPassedGetASecondChance)
+{
+    SuggestionCache cache{3};
+    cache.insert("A", suggestionsFor("A"));
+    cache.insert("B", suggestionsFor("B"));
+    cache.insert("C", suggestionsFor("C"));
+
+    EXPECT_TRUE(isCached(cache, "A"));
+
+    cache.insert("D", suggestionsFor("D"));
+
+    EXPECT_TRUE(isCached(cache, "A"));
+    EXPECT_FALSE(isCached(cache, "B"));
+    EXPECT_TRUE(isCached(cache, "C"));
+    EXPECT_TRUE(isCached(cache, "D"));
+}
+
+
+TEST(SuggestionCache_Tests, holdingNothingIsNotAllowed)
+{
+    EXPECT_THROW(SuggestionCache{0}, SuggestionCache::SuggestionCacheException);
+}
+
+
+TEST(SuggestionCache_Tests, canBeSharedByThreads)
+{
+    SuggestionCache cache{1000};
+    std::vector<std::thread> threads;
+
+    for (unsigned int t = 0; t < 4; ++t)
+    {
+        threads.emplace_back(
+            [&cache, t]()
+            {
+                for (unsigned int i = 0; i < 20000; ++i)
+                {
+                    std::string word = "W" + std::to_string((i * 7 + t) % 1500);
+                    std::vector<std::string> suggestions;
+
+                    if (cache.find(word, suggestions))
+                    {
+                        EXPECT_EQ(suggestionsFor(word), suggestions);
+                    }
+                    else
+                    {
+                        cache.insert(word, suggestionsFor(word));
+                    }
+                }
+            });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_EQ(80000, cache.hits() + cache.misses());
+    EXPECT_LE(cache.size(), 1000);
+    EXPECT_GT(cache.hits(), 0);
+}
+
+
+TEST(SuggestionCache_Tests, wordCheckerFindsSuggestionsOnlyOnce)
+{
+    ListSet<std::string> words;
+
+    for (const char* word : {"THE", "TEA", "TEN", "THEN"})
+    {
+        words.add(word);
+    }
+
+    SuggestionCache cache{10};
+    WordChecker checker{words};
+    checker.useSuggestionCache(&cache);
+
+    std::vector<std::string> first = checker.findSuggestions("TEH");
+    std::vector<std::string> second = checker.findSuggestions("TEH");
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(1, cache.hits());
+    EXPECT_EQ(1, cache.misses());
+
+    checker.useSuggestionCache(nullptr);
+    EXPECT_EQ(first, checker.findSuggestions("TEH"));
+    EXPECT_EQ(1, cache.hits());
+}
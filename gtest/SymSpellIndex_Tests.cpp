@@ -0,0 +1,182 @@
+// SymSpellIndex_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the SymSpellIndex.  Its suggestions are checked against
+// a brute-force search measuring the edit distance to every word in the
+// dictionary, and the WordChecker's suggestions, when it uses the index,
+// against the ones it finds by generating candidates.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "EditDistance.hpp"
+#include "ListSet.hpp"
+#include "SymSpellIndex.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    const std::vector<std::string> sampleWords{
+        "A", "AN", "AND", "ANT", "ANTS", "ANTHEM", "BE", "BEE", "BEEN",
+        "BEET", "CAT", "CATS", "CART", "CAST", "COAT", "DOG", "GOD", "GOOD",
+        "HE", "HELLO", "HELP", "HELM", "THE", "THEN", "TEN", "TEA"};
+
+
+    SymSpellIndex makeIndex(unsigned int maxDistance)
+    {
+        SymSpellIndex index{maxDistance};
+
+        for (const std::string& word : sampleWords)
+        {
+            index.addWord(word);
+        }
+
+        index.finish();
+        return index;
+    }
+
+
+    // Every sample word within the given distance, closest first, with
+    // ties in sorted order.
+    std::vector<std::string> bruteForce(const std::string& word, unsigned int maxDistance)
+    {
+        std::vector<std::pair<unsigned int, std::string>> found;
+
+        for (const std::string& candidate : sampleWords)
+        {
+            unsigned int distance = EditDistance::distance(word, candidate, maxDistance);
+
+            if (distance <= maxDistance)
+            {
+                found.emplace_back(distance, candidate);
+            }
+        }
+
+        std::sort(found.begin(), found.end());
+
+        std::vector<std::string> words;
+
+        for (const auto& f : found)
+        {
+            words.push_back(f.second);
+        }
+
+        return words;
+    }
+}
+
+
+TEST(SymSpellIndex_Tests, findsWordsWithinOneEditClosestFirst)
+{
+    SymSpellIndex index = makeIndex(1);
+
+    EXPECT_EQ(
+        (std::vector<std::string>{"CAT", "CART", "CAST", "CATS", "COAT"}),
+        index.findSuggestions("CAT"));
+
+    EXPECT_EQ((std::vector<std::string>{"TEA", "TEN", "THE"}), index.findSuggestions("TEH"));
+    EXPECT_TRUE(index.findSuggestions("XYZZY").empty());
+}
+
+
+TEST(SymSpellIndex_Tests, findsWordsWithinTwoEdits)
+{
+    SymSpellIndex index = makeIndex(2);
+
+    EXPECT_EQ(
+        (std::vector<std::string>{"HELLO", "HELM", "HELP", "HE"}),
+        index.findSuggestions("HELO"));
+
+    EXPECT_EQ(
+        (std::vector<std::string>{"GOD", "DOG", "GOOD"}),
+        index.findSuggestions("GDO"));
+}
+
+
+TEST(SymSpellIndex_Tests, agreesWithBruteForce)
+{
+    for (unsigned int maxDistance = 1; maxDistance <= SymSpellIndex::maxSupportedDistance; ++maxDistance)
+    {
+        SymSpellIndex index = makeIndex(maxDistance);
+
+        for (const char* word : {
+                "", "Q", "AT", "TA", "ANTEHM", "BETE", "CATTS", "DOOG",
+                "HLELO", "THNE", "ZZZZ", "ANTHEMS", "TEAT", "ENT"})
+        {
+            EXPECT_EQ(bruteForce(word, maxDistance), index.findSuggestions(word))
+                << word << " " << maxDistance;
+        }
+    }
+}
+
+
+TEST(SymSpellIndex_Tests, suggestsEachWordOnceEvenIfAddedTwice)
+{
+    SymSpellIndex index{1};
+    index.addWord("CAT");
+    index.addWord("CAT");
+    index.addWord("CUT");
+    index.finish();
+
+    EXPECT_EQ((std::vector<std::string>{"CAT", "CUT"}), index.findSuggestions("CAT"));
+}
+
+
+TEST(SymSpellIndex_Tests, findsNothingUntilFinished)
+{
+    SymSpellIndex index{2};
+    index.addWord("CAT");
+
+    EXPECT_FALSE(index.isFinished());
+    EXPECT_TRUE(index.findSuggestions("CAT").empty());
+
+    index.finish();
+
+    EXPECT_EQ((std::vector<std::string>{"CAT"}), index.findSuggestions("CAT"));
+}
+
+
+TEST(SymSpellIndex_Tests, cannotAddWordsOnceFinished)
+{
+    SymSpellIndex index = makeIndex(2);
+    EXPECT_THROW(index.addWord("DOGS"), SymSpellIndex::SymSpellException);
+}
+
+
+TEST(SymSpellIndex_Tests, rejectsUnsupportedDistances)
+{
+    EXPECT_THROW(SymSpellIndex{0}, SymSpellIndex::SymSpellException);
+    EXPECT_THROW(SymSpellIndex{SymSpellIndex::maxSupportedDistance + 1}, SymSpellIndex::SymSpellException);
+}
+
+
+TEST(SymSpellIndex_Tests, wordCheckerFindsTheSameWordsAsGeneratingCandidates)
+{
+    ListSet<std::string> words;
+
+    for (const std::string& word : sampleWords)
+    {
+        words.add(word);
+    }
+
+    SymSpellIndex index = makeIndex(1);
+
+    WordChecker generating{words};
+    WordChecker indexed{words};
+    indexed.useSuggestionStrategy(&index);
+
+    for (const char* word : {"TEH", "ANTT", "HELO", "CAAT", "ANDTHE", "XQZ", "BEEET"})
+    {
+        std::vector<std::string> expected = generating.findSuggestions(word);
+        std::vector<std::string> actual = indexed.findSuggestions(word);
+
+        std::sort(expected.begin(), expected.end());
+        std::sort(actual.begin(), actual.end());
+
+        EXPECT_EQ(expected, actual) << word;
+    }
+}
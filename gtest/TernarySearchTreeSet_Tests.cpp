@@ -0,0 +1,199 @@
+// TernarySearchTreeSet_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the TernarySearchTreeSet.  The neighbor search is checked
+// against a brute-force edit distance over every word in the set, and the
+// WordChecker's suggestions against those it finds by probing an ordinary
+// Set (which are the same, though not necessarily in the same order).
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ListSet.hpp"
+#include "TernarySearchTreeSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    const std::vector<std::string> sampleWords{
+        "A", "AN", "AND", "ANT", "ANTS", "ANTHEM", "BE", "BEE", "BEEN",
+        "BEET", "CAT", "CATS", "CART", "CAST", "COAT", "DOG", "GOD", "GOOD",
+        "HE", "HELLO", "HELP", "HELM", "THE", "THEN", "TEN", "TEA"};
+
+
+    // The optimal string alignment distance, computed the obvious way.
+    unsigned int distance(const std::string& a, const std::string& b)
+    {
+        std::vector<std::vector<unsigned int>> d(
+            a.size() + 1, std::vector<unsigned int>(b.size() + 1));
+
+        for (unsigned int i = 0; i <= a.size(); ++i)
+        {
+            for (unsigned int j = 0; j <= b.size(); ++j)
+            {
+                if (i == 0 || j == 0)
+                {
+                    d[i][j] = i + j;
+                    continue;
+                }
+
+                d[i][j] = std::min({
+                    d[i - 1][j] + 1, d[i][j - 1] + 1,
+                    d[i - 1][j - 1] + (a[i - 1] == b[j - 1] ? 0 : 1)});
+
+                if (i >= 2 && j >= 2 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1])
+                {
+                    d[i][j] = std::min(d[i][j], d[i - 2][j - 2] + 1);
+                }
+            }
+        }
+
+        return d[a.size()][b.size()];
+    }
+
+
+    std::vector<std::string> sorted(std::vector<std::string> v)
+    {
+        std::sort(v.begin(), v.end());
+        return v;
+    }
+}
+
+
+TEST(TernarySearchTreeSet_Tests, containsOnlyWhatWasAdded)
+{
+    TernarySearchTreeSet s;
+
+    for (const std::string& word : sampleWords)
+    {
+        s.add(word);
+    }
+
+    for (const std::string& word : sampleWords)
+    {
+        EXPECT_TRUE(s.contains(word));
+    }
+
+    EXPECT_FALSE(s.contains(""));
+    EXPECT_FALSE(s.contains("ANTH"));
+    EXPECT_FALSE(s.contains("CA"));
+    EXPECT_FALSE(s.contains("HELPS"));
+    EXPECT_FALSE(s.contains("Z"));
+}
+
+
+TEST(TernarySearchTreeSet_Tests, sizeIgnoresDuplicates)
+{
+    TernarySearchTreeSet s;
+    s.add("HELLO");
+    s.add("HELP");
+    s.add("HELLO");
+    s.add("");
+    s.add("");
+
+    EXPECT_EQ(3, s.size());
+    EXPECT_TRUE(s.contains(""));
+}
+
+
+TEST(TernarySearchTreeSet_Tests, copiesAreIndependent)
+{
+    TernarySearchTreeSet s1;
+    s1.add("HELLO");
+
+    TernarySearchTreeSet s2{s1};
+    s2.add("HELP");
+
+    EXPECT_TRUE(s2.contains("HELLO"));
+    EXPECT_TRUE(s2.contains("HELP"));
+    EXPECT_FALSE(s1.contains("HELP"));
+    EXPECT_EQ(1, s1.size());
+}
+
+
+TEST(TernarySearchTreeSet_Tests, nearNeighborsMatchBruteForce)
+{
+    TernarySearchTreeSet s;
+
+    for (const std::string& word : sampleWords)
+    {
+        s.add(word);
+    }
+
+    for (const char* word : {"TEH", "ANTT", "HELO", "CAAT", "GODO", "BEEE", "ATN", "X", ""})
+    {
+        for (unsigned int maxDistance = 0; maxDistance <= 3; ++maxDistance)
+        {
+            std::vector<std::string> expected;
+
+            for (const std::string& candidate : sampleWords)
+            {
+                if (distance(word, candidate) <= maxDistance)
+                {
+                    expected.push_back(candidate);
+                }
+            }
+
+            EXPECT_EQ(sorted(expected), s.nearNeighbors(word, maxDistance))
+                << word << " within " << maxDistance;
+        }
+    }
+}
+
+
+TEST(TernarySearchTreeSet_Tests, swapsCostOne)
+{
+    TernarySearchTreeSet s;
+    s.add("THE");
+    s.add("HTE");
+
+    EXPECT_EQ((std::vector<std::string>{"THE"}), s.nearNeighbors("TEH", 1));
+    EXPECT_EQ((std::vector<std::string>{"HTE", "THE"}), s.nearNeighbors("TEH", 2));
+    EXPECT_EQ((std::vector<std::string>{"THE"}), s.nearNeighbors("THE", 0));
+}
+
+
+TEST(TernarySearchTreeSet_Tests, wordCheckerSuggestionsMatchOrdinarySet)
+{
+    TernarySearchTreeSet tree;
+    ListSet<std::string> list;
+
+    for (const std::string& word : sampleWords)
+    {
+        tree.add(word);
+        list.add(word);
+    }
+
+    WordChecker treeChecker{tree};
+    WordChecker listChecker{list};
+
+    for (const char* word : {"TEH", "ANTT", "HELO", "CAAT", "GODO", "BEEE", "ANDTHE", "X", ""})
+    {
+        EXPECT_EQ(
+            sorted(listChecker.findSuggestions(word)),
+            sorted(treeChecker.findSuggestions(word)));
+    }
+}
+
+
+TEST(TernarySearchTreeSet_Tests, findsEveryPrefixThatIsAWord)
+{
+    TernarySearchTreeSet s;
+
+    for (const std::string& word : sampleWords)
+    {
+        s.add(word);
+    }
+
+    std::vector<std::string::size_type> lengths;
+    s.findWordPrefixes("BEETS", lengths);
+    EXPECT_EQ((std::vector<std::string::size_type>{2, 3, 4}), lengths);
+
+    lengths.clear();
+    s.findWordPrefixes("", lengths);
+    EXPECT_TRUE(lengths.empty());
+}
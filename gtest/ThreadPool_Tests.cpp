@@ -0,0 +1,124 @@
+// ThreadPool_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the ThreadPool, and for a WordChecker spreading its
+// lookups across one.
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ListSet.hpp"
+#include "ThreadPool.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    // Runs a loop of the given length on the pool, returning how many
+    // times each iteration ran.
+    std::vector<unsigned int> runLoop(ThreadPool& pool, unsigned int count)
+    {
+        std::vector<std::atomic<unsigned int>> runs(count);
+
+        pool.forEach(
+            count,
+            [&runs](unsigned int i)
+            {
+                runs[i].fetch_add(1);
+            });
+
+        return std::vector<unsigned int>(runs.begin(), runs.end());
+    }
+}
+
+
+TEST(ThreadPool_Tests, runsEveryIterationOnce)
+{
+    for (unsigned int workers : {0u, 1u, 3u})
+    {
+        ThreadPool pool{workers};
+        EXPECT_EQ(workers + 1, pool.threadCount());
+
+        for (unsigned int count : {0u, 1u, 2u, 7u, 1000u})
+        {
+            EXPECT_EQ(std::vector<unsigned int>(count, 1), runLoop(pool, count))
+                << workers << " " << count;
+        }
+    }
+}
+
+
+TEST(ThreadPool_Tests, runsManyLoopsInARow)
+{
+    ThreadPool pool{3};
+    std::atomic<unsigned long long> total{0};
+
+    for (unsigned int loop = 0; loop < 2000; ++loop)
+    {
+        pool.forEach(
+            5,
+            [&total](unsigned int i)
+            {
+                total.fetch_add(i + 1);
+            });
+    }
+
+    EXPECT_EQ(2000 * 15, total.load());
+}
+
+
+TEST(ThreadPool_Tests, loopsFromSeveralThreadsTakeTurns)
+{
+    ThreadPool pool{2};
+    std::vector<std::thread> callers;
+    std::atomic<bool> allRanOnce{true};
+
+    for (unsigned int t = 0; t < 4; ++t)
+    {
+        callers.emplace_back(
+            [&pool, &allRanOnce]()
+            {
+                for (unsigned int loop = 0; loop < 200; ++loop)
+                {
+                    if (runLoop(pool, 50) != std::vector<unsigned int>(50, 1))
+                    {
+                        allRanOnce = false;
+                    }
+                }
+            });
+    }
+
+    for (std::thread& caller : callers)
+    {
+        caller.join();
+    }
+
+    EXPECT_TRUE(allRanOnce);
+}
+
+
+TEST(ThreadPool_Tests, wordCheckerFindsTheSameSuggestionsInTheSameOrder)
+{
+    ListSet<std::string> words;
+
+    for (const char* word : {
+            "A", "AN", "AND", "ANT", "ANTS", "ANTHEM", "ANTHEMS", "BE", "BEE",
+            "THE", "THEM", "THEN", "TEN", "TEA", "ANTHEMIC", "ANTHEMION"})
+    {
+        words.add(word);
+    }
+
+    ThreadPool pool{3};
+    WordChecker sequential{words};
+    WordChecker parallel{words};
+    parallel.useThreadPool(&pool, 4);
+
+    for (const char* word : {"TEH", "ANTHEMM", "ANTHEMSS", "ANTEHM", "ANTHEMTHE", "XYZZYXYZZY"})
+    {
+        EXPECT_EQ(sequential.findSuggestions(word), parallel.findSuggestions(word)) << word;
+    }
+}
@@ -0,0 +1,206 @@
+// WordChecker_BudgetTests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the WordChecker's budgeted search out to distance 2: that
+// given enough budget it finds every word two edits away, that it always
+// finds those one edit away, and that it says when it ran out of budget.
+
+#include <algorithm>
+#include <chrono>
+#include <set>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ListSet.hpp"
+#include "SuggestionCache.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    const std::vector<std::string> sampleWords{
+        "A", "AN", "AND", "ANT", "ANTS", "ANTHEM", "BE", "BEE", "BEEN",
+        "BEET", "CAT", "CATS", "CART", "CAST", "COAT", "DOG", "GOD", "GOOD",
+        "HE", "HELLO", "HELP", "HELM", "THE", "THEN", "TEN", "TEA"};
+
+
+    ListSet<std::string> makeWords()
+    {
+        ListSet<std::string> words;
+
+        for (const std::string& word : sampleWords)
+        {
+            words.add(word);
+        }
+
+        return words;
+    }
+
+
+    // Every string one swap, replacement, deletion, or insertion away from
+    // the given one, made the obvious way.
+    std::set<std::string> edits(const std::string& word)
+    {
+        const std::string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+        std::set<std::string> result;
+
+        for (std::string::size_type i = 0; i + 1 < word.length(); ++i)
+        {
+            std::string s = word;
+            std::swap(s[i], s[i + 1]);
+            result.insert(s);
+        }
+
+        for (std::string::size_type i = 0; i <= word.length(); ++i)
+        {
+            if (i < word.length())
+            {
+                result.insert(std::string{word}.erase(i, 1));
+            }
+
+            for (char c : alphabet)
+            {
+                result.insert(std::string{word}.insert(i, 1, c));
+
+                if (i < word.length())
+                {
+                    std::string s = word;
+                    s[i] = c;
+                    result.insert(s);
+                }
+            }
+        }
+
+        return result;
+    }
+
+
+    // The sample words within two edits of the given word.
+    std::set<std::string> wordsWithinTwo(const std::string& word)
+    {
+        std::set<std::string> result;
+
+        for (const std::string& first : edits(word))
+        {
+            for (const std::string& second : edits(first))
+            {
+                if (std::find(sampleWords.begin(), sampleWords.end(), second) != sampleWords.end())
+                {
+                    result.insert(second);
+                }
+            }
+
+            if (std::find(sampleWords.begin(), sampleWords.end(), first) != sampleWords.end())
+            {
+                result.insert(first);
+            }
+        }
+
+        return result;
+    }
+}
+
+
+TEST(WordChecker_BudgetTests, unlimitedBudgetFindsEveryWordWithinTwo)
+{
+    ListSet<std::string> words = makeWords();
+    WordChecker checker{words};
+
+    for (const char* word : {"HXLLX", "TAHE", "GODOD", "CTAS", "BNET", "ZZ"})
+    {
+        WordChecker::BudgetedSuggestions found = checker.findSuggestionsWithin(word, {});
+
+        EXPECT_TRUE(found.completed) << word;
+        EXPECT_EQ(found.seedCount, found.seedsExpanded) << word;
+        EXPECT_EQ(
+            wordsWithinTwo(word),
+            std::set<std::string>(found.suggestions.begin(), found.suggestions.end())) << word;
+    }
+}
+
+
+TEST(WordChecker_BudgetTests, distanceOneSuggestionsComeFirst)
+{
+    ListSet<std::string> words = makeWords();
+    WordChecker checker{words};
+
+    for (const char* word : {"HELO", "TEH", "CATT", "ANDTHE"})
+    {
+        std::vector<std::string> nearest = checker.findSuggestions(word);
+        std::vector<std::string> within = checker.findSuggestionsWithin(word, {}).suggestions;
+
+        ASSERT_LE(nearest.size(), within.size()) << word;
+        EXPECT_TRUE(std::equal(nearest.begin(), nearest.end(), within.begin())) << word;
+    }
+}
+
+
+TEST(WordChecker_BudgetTests, runningOutOfLookupsDegradesTheSearch)
+{
+    ListSet<std::string> words = makeWords();
+    WordChecker checker{words};
+
+    WordChecker::SearchBudget budget;
+    budget.maxLookups = 1;
+
+    WordChecker::BudgetedSuggestions found = checker.findSuggestionsWithin("HELO", budget);
+
+    // Distance 1 is searched whatever the budget.
+    EXPECT_FALSE(found.completed);
+    EXPECT_EQ(0, found.seedsExpanded);
+    EXPECT_EQ(checker.findSuggestions("HELO"), found.suggestions);
+
+    budget.maxLookups = 5000;
+    found = checker.findSuggestionsWithin("HELO", budget);
+
+    EXPECT_FALSE(found.completed);
+    EXPECT_GT(found.seedsExpanded, 0);
+    EXPECT_LT(found.seedsExpanded, found.seedCount);
+    EXPECT_LE(found.lookedUp, budget.maxLookups);
+
+    EXPECT_EQ(2, checker.degradedSearchCount());
+    EXPECT_EQ(0, checker.completedSearchCount());
+}
+
+
+TEST(WordChecker_BudgetTests, runningOutOfTimeDegradesTheSearch)
+{
+    ListSet<std::string> words = makeWords();
+    WordChecker checker{words};
+
+    WordChecker::SearchBudget budget;
+    budget.maxTime = std::chrono::microseconds{1};
+
+    WordChecker::BudgetedSuggestions found = checker.findSuggestionsWithin("ANTHME", budget);
+
+    EXPECT_FALSE(found.completed);
+    EXPECT_LT(found.seedsExpanded, found.seedCount);
+    EXPECT_EQ(1, checker.degradedSearchCount());
+}
+
+
+TEST(WordChecker_BudgetTests, degradedSearchesAreNotCached)
+{
+    ListSet<std::string> words = makeWords();
+    SuggestionCache cache{10};
+
+    WordChecker::SearchBudget tight;
+    tight.maxLookups = 1;
+
+    WordChecker checker{words};
+    checker.useSuggestionCache(&cache);
+    checker.useSearchBudget(&tight);
+
+    checker.findSuggestions("HXLLX");
+    EXPECT_EQ(0, cache.size());
+    EXPECT_EQ(1, checker.degradedSearchCount());
+
+    WordChecker::SearchBudget unlimited;
+    checker.useSearchBudget(&unlimited);
+
+    EXPECT_EQ((std::vector<std::string>{"HELLO"}), checker.findSuggestions("HXLLX"));
+    EXPECT_EQ(1, cache.size());
+    EXPECT_EQ(1, checker.completedSearchCount());
+}
@@ -0,0 +1,149 @@
+// WordChecker_PruningTests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for screening a WordChecker's candidates with a
+// DictionaryProfile: that no suggestion is lost by pruning, that the
+// profile's alphabet is the one that's tried, and that what was pruned
+// is counted.
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "DictionaryProfile.hpp"
+#include "ListSet.hpp"
+#include "WordChecker.hpp"
+#include "WordFrequencies.hpp"
+
+
+namespace
+{
+    const std::vector<std::string> sampleWords{
+        "A", "AN", "AND", "ANT", "ANTS", "ANTHEM", "BE", "BEE", "BEEN",
+        "BEET", "CAT", "CATS", "CART", "CAST", "COAT", "DOG", "GOD", "GOOD",
+        "HE", "HELLO", "HELP", "HELM", "THE", "THEN", "TEN", "TEA", "XYLEM"};
+
+
+    const std::vector<std::string> misspellings{
+        "HELO", "TEH", "CAAT", "TAC", "ANTHME", "BEEM", "THECAT", "GODO",
+        "XYLME", "ZZZ", "QAT", "ANDTHE", "OCAT", "BETE", "A", "HELMX"};
+
+
+    ListSet<std::string> makeWords(const std::vector<std::string>& list)
+    {
+        ListSet<std::string> words;
+
+        for (const std::string& word : list)
+        {
+            words.add(word);
+        }
+
+        return words;
+    }
+
+
+    DictionaryProfile makeProfile(const std::vector<std::string>& list)
+    {
+        DictionaryProfile profile;
+
+        for (const std::string& word : list)
+        {
+            profile.addWord(word);
+        }
+
+        return profile;
+    }
+}
+
+
+TEST(WordChecker_PruningTests, pruningLosesNoSuggestions)
+{
+    ListSet<std::string> words = makeWords(sampleWords);
+    DictionaryProfile profile = makeProfile(sampleWords);
+
+    WordChecker plain{words};
+    WordChecker pruned{words};
+    pruned.useDictionaryProfile(&profile);
+
+    for (const std::string& misspelling : misspellings)
+    {
+        EXPECT_EQ(plain.findSuggestions(misspelling), pruned.findSuggestions(misspelling))
+            << misspelling;
+    }
+}
+
+
+TEST(WordChecker_PruningTests, pruningLosesNoRankedSuggestions)
+{
+    ListSet<std::string> words = makeWords(sampleWords);
+    DictionaryProfile profile = makeProfile(sampleWords);
+    WordFrequencies frequencies;
+    frequencies.add("THE", 10000);
+    frequencies.add("HELLO", 1000);
+    frequencies.add("CAT", 300);
+
+    WordChecker plain{words};
+    plain.useRanking(&frequencies, 3);
+
+    WordChecker pruned{words};
+    pruned.useRanking(&frequencies, 3);
+    pruned.useDictionaryProfile(&profile);
+
+    for (const std::string& misspelling : misspellings)
+    {
+        EXPECT_EQ(plain.findSuggestions(misspelling), pruned.findSuggestions(misspelling))
+            << misspelling;
+    }
+}
+
+
+TEST(WordChecker_PruningTests, candidatesAreCountedAsPruned)
+{
+    ListSet<std::string> words = makeWords(sampleWords);
+    DictionaryProfile profile = makeProfile(sampleWords);
+
+    WordChecker checker{words};
+    EXPECT_EQ(0, checker.screenedWordCount());
+
+    checker.findSuggestions("HELO");
+    EXPECT_EQ(0, checker.screenedWordCount());
+    EXPECT_EQ(0, checker.prunedCandidateCount());
+
+    checker.useDictionaryProfile(&profile);
+    checker.findSuggestions("HELO");
+    checker.findSuggestions("TEH");
+
+    EXPECT_EQ(2, checker.screenedWordCount());
+    EXPECT_GT(checker.prunedCandidateCount(), 0);
+}
+
+
+TEST(WordChecker_PruningTests, theProfilesAlphabetIsTried)
+{
+    const std::vector<std::string> list{"DON'T", "WON'T", "CAT"};
+    ListSet<std::string> words = makeWords(list);
+    DictionaryProfile profile = makeProfile(list);
+
+    WordChecker checker{words};
+    EXPECT_TRUE(checker.findSuggestions("DONT").empty());
+
+    checker.useDictionaryProfile(&profile);
+    EXPECT_EQ((std::vector<std::string>{"DON'T"}), checker.findSuggestions("DONT"));
+    EXPECT_EQ((std::vector<std::string>{"WON'T"}), checker.findSuggestions("WONAT"));
+}
+
+
+TEST(WordChecker_PruningTests, noProfileMeansNoPruning)
+{
+    ListSet<std::string> words = makeWords(sampleWords);
+    DictionaryProfile profile = makeProfile(sampleWords);
+
+    WordChecker checker{words};
+    checker.useDictionaryProfile(&profile);
+    checker.useDictionaryProfile(nullptr);
+
+    checker.findSuggestions("HELO");
+    EXPECT_EQ(0, checker.screenedWordCount());
+    EXPECT_EQ(0, checker.prunedCandidateCount());
+}
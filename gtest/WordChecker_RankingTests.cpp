@@ -0,0 +1,128 @@
+// WordChecker_RankingTests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the WordChecker's ranked suggestions: that frequent
+// words come first, that no more than the requested number are returned,
+// and that the search stops once nothing left to try could make the cut.
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ListSet.hpp"
+#include "WordChecker.hpp"
+#include "WordFrequencies.hpp"
+
+
+namespace
+{
+    const std::vector<std::string> sampleWords{
+        "A", "AN", "AND", "ANT", "ANTS", "ANTHEM", "BE", "BEE", "BEEN",
+        "BEET", "CAT", "CATS", "CART", "CAST", "COAT", "DOG", "GOD", "GOOD",
+        "HE", "HELLO", "HELP", "HELM", "THE", "THEN", "TEN", "TEA"};
+
+
+    ListSet<std::string> makeWords()
+    {
+        ListSet<std::string> words;
+
+        for (const std::string& word : sampleWords)
+        {
+            words.add(word);
+        }
+
+        return words;
+    }
+
+
+    WordFrequencies makeFrequencies()
+    {
+        WordFrequencies frequencies;
+        frequencies.add("THE", 10000);
+        frequencies.add("HELLO", 1000);
+        frequencies.add("HELP", 500);
+        frequencies.add("TEA", 200);
+        frequencies.add("A", 5000);
+        frequencies.add("HELM", 5);
+        return frequencies;
+    }
+}
+
+
+TEST(WordChecker_RankingTests, frequentWordsComeFirst)
+{
+    ListSet<std::string> words = makeWords();
+    WordFrequencies frequencies = makeFrequencies();
+
+    WordChecker checker{words};
+    checker.useRanking(&frequencies, 5);
+
+    EXPECT_EQ(
+        (std::vector<std::string>{"HELLO", "HELP", "HELM"}),
+        checker.findSuggestions("HELO", 5));
+}
+
+
+TEST(WordChecker_RankingTests, onlyTheBestAreReturned)
+{
+    ListSet<std::string> words = makeWords();
+    WordFrequencies frequencies = makeFrequencies();
+
+    WordChecker checker{words};
+    checker.useRanking(&frequencies, 5);
+
+    EXPECT_EQ((std::vector<std::string>{"HELLO", "HELP"}), checker.findSuggestions("HELO", 2));
+    EXPECT_TRUE(checker.findSuggestions("HELO", 0).empty());
+}
+
+
+TEST(WordChecker_RankingTests, cheaperEditsWinTiesInFrequency)
+{
+    ListSet<std::string> words = makeWords();
+    WordChecker checker{words};
+
+    // With no frequencies, the deletions (TEA and THE) beat the replacement
+    // (THEN), which beats the split.
+    EXPECT_EQ(
+        (std::vector<std::string>{"TEA", "THE", "THEN", "THE A"}),
+        checker.findSuggestions("THEA", 10));
+}
+
+
+TEST(WordChecker_RankingTests, searchStopsOnceNothingCanBeatTheWorst)
+{
+    ListSet<std::string> words = makeWords();
+    WordFrequencies frequencies = makeFrequencies();
+
+    WordChecker checker{words};
+    checker.useRanking(&frequencies, 1);
+
+    // THE is found by swapping, and is the most frequent word of all, so
+    // no other edit is even tried.
+    std::size_t lookedUp;
+    EXPECT_EQ((std::vector<std::string>{"THE"}), checker.findSuggestions("TEH", 1, lookedUp));
+    EXPECT_EQ(2, lookedUp);
+
+    // Asking for more means trying everything.
+    EXPECT_EQ(
+        (std::vector<std::string>{"THE", "TEA", "TEN"}),
+        checker.findSuggestions("TEH", 5, lookedUp));
+    EXPECT_GT(lookedUp, 100);
+}
+
+
+TEST(WordChecker_RankingTests, rankingAppliesToOrdinarySuggestions)
+{
+    ListSet<std::string> words = makeWords();
+    WordFrequencies frequencies = makeFrequencies();
+
+    WordChecker checker{words};
+    checker.useRanking(&frequencies, 2);
+
+    EXPECT_EQ((std::vector<std::string>{"HELLO", "HELP"}), checker.findSuggestions("HELO"));
+
+    checker.useRanking(nullptr, 0);
+
+    EXPECT_EQ(3, checker.findSuggestions("HELO").size());
+}
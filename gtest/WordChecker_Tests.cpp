@@ -0,0 +1,90 @@
+// WordChecker_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for the WordChecker's suggestions: that each appears only
+// once, no matter how many edits lead to it, and in the order the edits
+// are tried.
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ListSet.hpp"
+#include "RadixTrieSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    const std::string alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+
+    // Every string of two letters.
+    template <typename S>
+    void addAllPairs(S& words)
+    {
+        for (char first : alphabet)
+        {
+            for (char second : alphabet)
+            {
+                words.add(std::string{first, second});
+            }
+        }
+    }
+
+
+    // The suggestions for "QQ" when every two-letter string is a word:
+    // swapping gives QQ itself, then each letter replaces the first
+    // character and then the second, with QQ skipped the second and third
+    // times it turns up.
+    std::vector<std::string> expectedForQQ()
+    {
+        std::vector<std::string> expected{"QQ"};
+
+        for (char c : alphabet)
+        {
+            if (c != 'Q')
+            {
+                expected.push_back(std::string{c, 'Q'});
+                expected.push_back(std::string{'Q', c});
+            }
+        }
+
+        return expected;
+    }
+}
+
+
+TEST(WordChecker_Tests, suggestionsReachedByDifferentEditsAppearOnce)
+{
+    ListSet<std::string> words;
+    words.add("A");
+    words.add("AB");
+    words.add("BA");
+
+    WordChecker checker{words};
+
+    // Deleting either A gives the same word.
+    EXPECT_EQ((std::vector<std::string>{"A A", "BA", "AB", "A"}), checker.findSuggestions("AA"));
+    EXPECT_EQ((std::vector<std::string>{"AB", "BA"}), checker.findSuggestions("BB"));
+}
+
+
+TEST(WordChecker_Tests, manySuggestionsKeepTheirOrder)
+{
+    ListSet<std::string> list;
+    RadixTrieSet trie;
+    addAllPairs(list);
+    addAllPairs(trie);
+
+    std::vector<std::string> expected = expectedForQQ();
+
+    // Twice each, so that the second time starts with the table left over
+    // from the first.
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        EXPECT_EQ(expected, WordChecker{list}.findSuggestions("QQ"));
+        EXPECT_EQ(expected, WordChecker{trie}.findSuggestions("QQ"));
+    }
+}
@@ -0,0 +1,90 @@
+// WordFrequencies_Tests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Unit tests for WordFrequencies, including loading them from a file.
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <gtest/gtest.h>
+#include "WordFrequencies.hpp"
+
+
+namespace
+{
+    std::string writeFile(const std::string& name, const std::string& contents)
+    {
+        std::string path = testing::TempDir() + name;
+        std::ofstream{path} << contents;
+        return path;
+    }
+}
+
+
+TEST(WordFrequencies_Tests, wordsWithoutFrequenciesHaveNone)
+{
+    WordFrequencies frequencies;
+
+    EXPECT_EQ(0, frequencies.frequency("THE"));
+    EXPECT_EQ(0, frequencies.maxFrequency());
+    EXPECT_EQ(0, frequencies.size());
+}
+
+
+TEST(WordFrequencies_Tests, countsAddUp)
+{
+    WordFrequencies frequencies;
+    frequencies.add("THE", 10);
+    frequencies.add("CAT", 3);
+    frequencies.add("CAT", 9);
+
+    EXPECT_EQ(10, frequencies.frequency("THE"));
+    EXPECT_EQ(12, frequencies.frequency("CAT"));
+    EXPECT_EQ(12, frequencies.maxFrequency());
+    EXPECT_EQ(2, frequencies.size());
+}
+
+
+TEST(WordFrequencies_Tests, loadedWordsAreConvertedToUppercase)
+{
+    std::string path = writeFile(
+        "WordFrequencies_Tests.txt",
+        "the 23135851162\n"
+        "\n"
+        "  cat's\t42\n"
+        "The 8\n");
+
+    WordFrequencies frequencies;
+    frequencies.load(path);
+    std::remove(path.c_str());
+
+    EXPECT_EQ(23135851170ull, frequencies.frequency("THE"));
+    EXPECT_EQ(42, frequencies.frequency("CAT'S"));
+    EXPECT_EQ(0, frequencies.frequency("the"));
+    EXPECT_EQ(2, frequencies.size());
+}
+
+
+TEST(WordFrequencies_Tests, malformedLinesAreRejected)
+{
+    for (const char* line : {"the\n", "the many\n", "the 12 13\n"})
+    {
+        std::string path = writeFile("WordFrequencies_Tests.txt", line);
+
+        WordFrequencies frequencies;
+        EXPECT_THROW(frequencies.load(path), WordFrequencies::WordFrequenciesException) << line;
+        std::remove(path.c_str());
+    }
+}
+
+
+TEST(WordFrequencies_Tests, missingFilesAreRejected)
+{
+    WordFrequencies frequencies;
+
+    EXPECT_THROW(
+        frequencies.load(testing::TempDir() + "WordFrequencies_Tests_missing.txt"),
+        WordFrequencies::WordFrequenciesException);
+}
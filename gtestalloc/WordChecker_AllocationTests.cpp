@@ -0,0 +1,165 @@
+// WordChecker_AllocationTests.cpp
+//
+// ICS 46 Spring 2017
+// Project #3: Set the Controls for the Heart of the Sun
+//
+// Checks that WordChecker::findSuggestions() allocates no memory other
+// than what the suggestions it returns require.  This file replaces the
+// global operator new with one that counts the calls made on the current
+// thread, which affects the whole program it's linked into, so it's built
+// into a test program of its own (a.out.gtestalloc) rather than alongside
+// the other unit tests.
+
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include "ListSet.hpp"
+#include "RadixTrieSet.hpp"
+#include "WordChecker.hpp"
+
+
+namespace
+{
+    thread_local unsigned long long allocationCount = 0;
+
+
+    const std::vector<std::string> sampleWords{
+        "A", "AN", "AND", "ANT", "ANTS", "ANTHEM", "BE", "BEE", "BEEN",
+        "BEET", "CAT", "CATS", "CART", "CAST", "COAT", "DOG", "GOD", "GOOD",
+        "HE", "HELLO", "HELP", "HELM", "THE", "THEN", "TEN", "TEA"};
+
+
+    // Returns the number of allocations made by findSuggestions() for the
+    // given word, after one call to let any reusable buffers grow.
+    unsigned long long allocationsFor(
+        const WordChecker& checker, const std::string& word, std::vector<std::string>& suggestions)
+    {
+        checker.findSuggestions(word);
+
+        unsigned long long before = allocationCount;
+        suggestions = checker.findSuggestions(word);
+        return allocationCount - before;
+    }
+
+
+    // The suggestions need the vector that holds them (which grows by
+    // doubling) plus one allocation for each that's too long to fit into
+    // a std::string without one.
+    unsigned long long allowanceFor(const std::vector<std::string>& suggestions)
+    {
+        unsigned long long allowance = 0;
+
+        for (std::vector<std::string>::size_type capacity = 1;
+             capacity / 2 < suggestions.size(); capacity *= 2)
+        {
+            ++allowance;
+        }
+
+        for (const std::string& suggestion : suggestions)
+        {
+            if (suggestion.size() > std::string{}.capacity())
+            {
+                ++allowance;
+            }
+        }
+
+        return allowance;
+    }
+}
+
+
+// The replacement operators pair malloc() with free() on purpose.  Once
+// operator new is inlined into its callers, g++ sees memory from it being
+// released with free() and warns, not knowing the two were replaced
+// together.
+#if defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 11
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+
+void* operator new(std::size_t size)
+{
+    ++allocationCount;
+
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+    {
+        return p;
+    }
+
+    throw std::bad_alloc{};
+}
+
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+
+
+TEST(WordChecker_AllocationTests, misspellingsWithoutSuggestionsAllocateNothing)
+{
+    ListSet<std::string> words;
+
+    for (const std::string& word : sampleWords)
+    {
+        words.add(word);
+    }
+
+    WordChecker checker{words};
+    std::vector<std::string> suggestions;
+
+    for (const char* word : {"XQZ", "ZZZZZZZZZZZZZZZZZZZZZZZZZZZZZZ", "QQ"})
+    {
+        EXPECT_EQ(0, allocationsFor(checker, word, suggestions)) << word;
+        EXPECT_TRUE(suggestions.empty());
+    }
+}
+
+
+TEST(WordChecker_AllocationTests, onlyTheSuggestionsAreAllocated)
+{
+    ListSet<std::string> words;
+
+    for (const std::string& word : sampleWords)
+    {
+        words.add(word);
+    }
+
+    WordChecker checker{words};
+    std::vector<std::string> suggestions;
+
+    for (const char* word : {"TEH", "ANTT", "HELO", "CAAT", "ANDTHE", "BEEEEEEEEEEEEEEEEEEEEEEEEN"})
+    {
+        unsigned long long allocations = allocationsFor(checker, word, suggestions);
+        EXPECT_LE(allocations, allowanceFor(suggestions)) << word;
+    }
+}
+
+
+TEST(WordChecker_AllocationTests, walkingATrieAllocatesOnlyTheSuggestions)
+{
+    RadixTrieSet words;
+
+    for (const std::string& word : sampleWords)
+    {
+        words.add(word);
+    }
+
+    WordChecker checker{words};
+    std::vector<std::string> suggestions;
+
+    for (const char* word : {"XQZ", "TEH", "ANTT", "HELO", "ANDTHE"})
+    {
+        unsigned long long allocations = allocationsFor(checker, word, suggestions);
+        EXPECT_LE(allocations, allowanceFor(suggestions)) << word;
+    }
+}
@@ -38,11 +38,30 @@ public:
     virtual bool contains(const T& element) const = 0;
 
 
+    // containsBatch() looks up count elements at once, setting found[i] to
+    // whether elements[i] is in the set.  By default, it calls contains()
+    // on each in turn; a derived class can override it to overlap the
+    // lookups, so that each one's cache misses aren't waited out before
+    // the next one starts.
+    virtual void containsBatch(const T* elements, unsigned int count, bool* found) const;
+
+
     // size() returns the number of elements in the set.
     virtual unsigned int size() const = 0;
 };
 
 
 
+template <typename T>
+void Set<T>::containsBatch(const T* elements, unsigned int count, bool* found) const
+{
+    for (unsigned int i = 0; i < count; ++i)
+    {
+        found[i] = contains(elements[i]);
+    }
+}
+
+
+
 #endif // SET_HPP
 
@@ -3,24 +3,51 @@
 // ICS 46 Spring 2017
 // Project #3: Set the Controls for the Heart of the Sun
 
+#include <algorithm>
+#include <cctype>
+#include <chrono>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <sstream>
+#include <thread>
 #include "SpellCheckShell.hpp"
 #include "AVLSet.hpp"
+#include "BinaryFuseFilter.hpp"
+#include "BKTree.hpp"
+#include "BloomFilter.hpp"
 #include "BSTSet.hpp"
+#include "DafsaSet.hpp"
+#include "DictionaryProfile.hpp"
+#include "DoubleArrayTrieSet.hpp"
 #include "EmptySet.hpp"
+#include "FilteredSet.hpp"
 #include "HashSet.hpp"
+#include "HatTrieSet.hpp"
+#include "LengthBucketScan.hpp"
+#include "LevenshteinAutomaton.hpp"
+#include "LevenshteinSearch.hpp"
 #include "ListSet.hpp"
+#include "LoudsTrieSet.hpp"
 #include "OutputSpellCheckerListener.hpp"
+#include "PhoneticIndex.hpp"
+#include "RadixTrieSet.hpp"
 #include "Set.hpp"
 #include "SkipListSet.hpp"
+#include "SortedArraySet.hpp"
 #include "SpellChecker.hpp"
 #include "Stopwatch.hpp"
 #include "StringHashing.hpp"
+#include "SuggestionCache.hpp"
+#include "SuggestionStrategy.hpp"
+#include "SymSpellIndex.hpp"
+#include "TernarySearchTreeSet.hpp"
 #include "TextFileReader.hpp"
+#include "ThreadPool.hpp"
 #include "WordChecker.hpp"
+#include "WordFrequencies.hpp"
 #include "WordSetLoader.hpp"
 
 
@@ -58,6 +85,14 @@ namespace
         {
             return std::make_unique<BSTSet<std::string>>();
         }
+        else if (setType == "DAFSA")
+        {
+            return std::make_unique<DafsaSet>();
+        }
+        else if (setType == "DOUBLE ARRAY")
+        {
+            return std::make_unique<DoubleArrayTrieSet>();
+        }
         else if (setType == "EMPTY")
         {
             return std::make_unique<EmptySet<std::string>>();
@@ -74,14 +109,34 @@ namespace
         {
             return std::make_unique<HashSet<std::string>>(hashStringAsProduct);
         }
+        else if (setType == "HAT TRIE")
+        {
+            return std::make_unique<HatTrieSet>();
+        }
         else if (setType == "LIST")
         {
             return std::make_unique<ListSet<std::string>>();
         }
+        else if (setType == "LOUDS TRIE")
+        {
+            return std::make_unique<LoudsTrieSet>();
+        }
+        else if (setType == "RADIX TRIE")
+        {
+            return std::make_unique<RadixTrieSet>();
+        }
         else if (setType == "SKIPLIST")
         {
             return std::make_unique<SkipListSet<std::string>>();
         }
+        else if (setType == "SORTED ARRAY")
+        {
+            return std::make_unique<SortedArraySet>();
+        }
+        else if (setType == "TERNARY TREE")
+        {
+            return std::make_unique<TernarySearchTreeSet>();
+        }
         else
         {
             throw SpellCheckShell::ShellException{"Invalid search structure type: " + setType};
@@ -113,6 +168,862 @@ namespace
     }
 
 
+    // Loads the words in the given file into the given set.  Sets that are
+    // laid out all at once are finished afterward, and a DoubleArrayTrieSet
+    // can instead be mapped directly from a file it saved previously.  If
+    // the set is a FilteredSet, the set behind it is the one loaded, and
+    // the filter is built once it has been.
+    //
+    // The shell never saves a DoubleArrayTrieSet itself; the DOUBLE ARRAY
+    // experiment writes one next to the word set, with .dat appended to
+    // its name, and giving that file as the word set maps it.
+    void loadWordSet(const std::string& wordFilePath, Set<std::string>& wordSet)
+    {
+        FilteredSet* filtered = dynamic_cast<FilteredSet*>(&wordSet);
+        Set<std::string>& words = filtered != nullptr ? filtered->wrappedSet() : wordSet;
+
+        try
+        {
+            DoubleArrayTrieSet* doubleArray = dynamic_cast<DoubleArrayTrieSet*>(&words);
+
+            if (doubleArray != nullptr && DoubleArrayTrieSet::isSavedFile(wordFilePath))
+            {
+                *doubleArray = DoubleArrayTrieSet::map(wordFilePath);
+            }
+            else
+            {
+                WordSetLoader{}.load(wordFilePath, wordSet);
+
+                if (DafsaSet* dafsa = dynamic_cast<DafsaSet*>(&words))
+                {
+                    dafsa->finish();
+                }
+                else if (doubleArray != nullptr)
+                {
+                    doubleArray->finish();
+                }
+                else if (LoudsTrieSet* louds = dynamic_cast<LoudsTrieSet*>(&words))
+                {
+                    louds->finish();
+                }
+                else if (SortedArraySet* sortedArray = dynamic_cast<SortedArraySet*>(&words))
+                {
+                    sortedArray->finish();
+                }
+            }
+
+            if (filtered != nullptr)
+            {
+                filtered->finish();
+            }
+        }
+        catch (DafsaSet::DafsaException& e)
+        {
+            throw SpellCheckShell::ShellException{e.reason()};
+        }
+        catch (DoubleArrayTrieSet::DoubleArrayTrieException& e)
+        {
+            throw SpellCheckShell::ShellException{e.reason()};
+        }
+        catch (LoudsTrieSet::LoudsTrieException& e)
+        {
+            throw SpellCheckShell::ShellException{e.reason()};
+        }
+        catch (SortedArraySet::SortedArrayException& e)
+        {
+            throw SpellCheckShell::ShellException{e.reason()};
+        }
+    }
+
+
+    // Optional settings, each given on a line of its own after the output
+    // type; a blank line (or the end of the input) ends them.
+    //
+    //     BLOOM rate     puts a blocked Bloom filter with the given false
+    //                    positive rate (0.01 if none is given) in front of
+    //                    the search structure
+    //     FUSE bits      puts a binary fuse filter with 8- or 16-bit
+    //                    fingerprints (8 if not given) in front of it
+    //     SUGGEST SYMSPELL distance
+    //                    finds suggestions with a SymSpellIndex that finds
+    //                    the words within the given edit distance (2 if
+    //                    none is given), instead of generating candidates
+    //     SUGGEST BKTREE distance
+    //                    likewise, but with a BKTree that finds the words
+    //                    within the given Levenshtein distance
+    //     SUGGEST AUTOMATON distance
+    //                    likewise, but by walking a Levenshtein automaton
+    //                    for the misspelled word through a DAFSA of the
+    //                    dictionary (whose words must be in sorted order)
+    //     SUGGEST SCAN distance
+    //                    likewise, but by measuring the distance to every
+    //                    word of a nearby length with bit-parallel kernels
+    //     SOUNDALIKE count
+    //                    follows the suggestions for each misspelled word
+    //                    by up to the given number (10 if none is given)
+    //                    of words that sound like it, by Metaphone key
+    //     CACHE capacity caches the suggestions for up to the given number
+    //                    of misspellings (10000 if none is given), so that
+    //                    recurring misspellings are only checked once
+    //     PARALLEL threads length
+    //                    looks up the candidates for misspelled words of
+    //                    at least the given length (12 if none is given)
+    //                    on the given number of threads (as many as the
+    //                    machine has if none is given)
+    //     PIPELINE threads
+    //                    checks the words on the given number of threads
+    //                    (as many as the machine has if none is given), a
+    //                    chunk of lines at a time, reporting misspellings
+    //                    in the same order as when checking on one
+    //     RANK count path
+    //                    offers only the given number of suggestions (5 if
+    //                    none is given), ranked by how frequent each word
+    //                    is according to the given frequency file (by
+    //                    default, wordfreq.txt alongside the word set;
+    //                    if that doesn't exist, by edit alone)
+    //     PRUNE          tries only the characters that appear in the word
+    //                    set when generating candidates, and skips those
+    //                    with a pair of adjacent characters that no word has
+    //     EXPAND time lookups
+    //                    suggests words within distance 2, not just 1, but
+    //                    stops expanding toward distance 2 once the given
+    //                    number of microseconds (1000 if none is given) or
+    //                    candidate lookups (unlimited if none is given) per
+    //                    word is used up; 0 means no limit
+    struct ShellOptions
+    {
+        // Empty if there is to be no filter.
+        FilteredSet::FilterFactory makeFilter;
+
+        // Empty if suggestions are to be found by generating candidates.
+        std::function<std::unique_ptr<SuggestionStrategy>()> makeStrategy;
+
+        // 0 if sound-alikes aren't to be suggested.
+        std::size_t soundAlikeCount = 0;
+
+        // 0 if suggestions aren't to be cached.
+        unsigned int cacheCapacity = 0;
+
+        // 0 if candidates are only to be looked up on the calling thread.
+        unsigned int parallelThreads = 0;
+        std::string::size_type parallelLength = 0;
+
+        // 0 if words are only to be checked on the calling thread.
+        unsigned int pipelineThreads = 0;
+
+        // 0 if suggestions aren't to be ranked; the frequency file's path
+        // is empty if none was given.
+        unsigned int rankCount = 0;
+        std::string frequencyPath;
+
+        // false if candidates aren't to be screened by a DictionaryProfile.
+        bool prune = false;
+
+        // false if suggestions are only to be found at distance 1.
+        bool expand = false;
+        WordChecker::SearchBudget budget;
+    };
+
+
+    double readRate(std::istringstream& in, const std::string& option, double defaultRate)
+    {
+        double rate = defaultRate;
+
+        if (!(in >> std::ws).eof() && !(in >> rate))
+        {
+            throw SpellCheckShell::ShellException{"Invalid value for " + option};
+        }
+
+        if (rate <= 0.0 || rate >= 1.0)
+        {
+            throw SpellCheckShell::ShellException{
+                "The rate for " + option + " must be between 0 and 1"};
+        }
+
+        return rate;
+    }
+
+
+    FilteredSet::FilterFactory makeFuseFilterFactory(std::istringstream& in)
+    {
+        unsigned int bits = 8;
+
+        if (!(in >> std::ws).eof() && !(in >> bits))
+        {
+            throw SpellCheckShell::ShellException{"Invalid value for FUSE"};
+        }
+
+        if (bits == 8)
+        {
+            return [](const std::vector<std::uint64_t>& hashes)
+            {
+                return std::make_unique<BinaryFuseFilter<std::uint8_t>>(hashes);
+            };
+        }
+        else if (bits == 16)
+        {
+            return [](const std::vector<std::uint64_t>& hashes)
+            {
+                return std::make_unique<BinaryFuseFilter<std::uint16_t>>(hashes);
+            };
+        }
+        else
+        {
+            throw SpellCheckShell::ShellException{"The fingerprints for FUSE must be 8 or 16 bits"};
+        }
+    }
+
+
+    unsigned int readDistance(std::istringstream& in, const std::string& option)
+    {
+        unsigned int distance = 2;
+
+        if (!(in >> std::ws).eof() && !(in >> distance))
+        {
+            throw SpellCheckShell::ShellException{"Invalid value for " + option};
+        }
+
+        if (distance == 0)
+        {
+            throw SpellCheckShell::ShellException{"The distance for " + option + " must be at least 1"};
+        }
+
+        return distance;
+    }
+
+
+    unsigned int readCacheCapacity(std::istringstream& in)
+    {
+        unsigned int capacity = 10000;
+
+        if (!(in >> std::ws).eof() && !(in >> capacity))
+        {
+            throw SpellCheckShell::ShellException{"Invalid value for CACHE"};
+        }
+
+        if (capacity == 0)
+        {
+            throw SpellCheckShell::ShellException{"The capacity for CACHE must be at least 1"};
+        }
+
+        return capacity;
+    }
+
+
+    std::size_t readSoundAlikeCount(std::istringstream& in)
+    {
+        std::size_t count = 10;
+
+        if (!(in >> std::ws).eof() && !(in >> count))
+        {
+            throw SpellCheckShell::ShellException{"Invalid number of suggestions for SOUNDALIKE"};
+        }
+
+        if (count == 0)
+        {
+            throw SpellCheckShell::ShellException{"The number of suggestions for SOUNDALIKE must be at least 1"};
+        }
+
+        return count;
+    }
+
+
+    void readParallelOptions(std::istringstream& in, ShellOptions& options)
+    {
+        unsigned int threads = std::max(std::thread::hardware_concurrency(), 1u);
+        std::string::size_type length = 12;
+
+        if (!(in >> std::ws).eof() && !(in >> threads))
+        {
+            throw SpellCheckShell::ShellException{"Invalid number of threads for PARALLEL"};
+        }
+
+        if (!(in >> std::ws).eof() && !(in >> length))
+        {
+            throw SpellCheckShell::ShellException{"Invalid word length for PARALLEL"};
+        }
+
+        if (threads == 0)
+        {
+            throw SpellCheckShell::ShellException{"The number of threads for PARALLEL must be at least 1"};
+        }
+
+        options.parallelThreads = threads;
+        options.parallelLength = length;
+    }
+
+
+    unsigned int readPipelineThreads(std::istringstream& in)
+    {
+        unsigned int threads = std::max(std::thread::hardware_concurrency(), 1u);
+
+        if (!(in >> std::ws).eof() && !(in >> threads))
+        {
+            throw SpellCheckShell::ShellException{"Invalid number of threads for PIPELINE"};
+        }
+
+        if (threads == 0)
+        {
+            throw SpellCheckShell::ShellException{"The number of threads for PIPELINE must be at least 1"};
+        }
+
+        return threads;
+    }
+
+
+    void readRankOptions(std::istringstream& in, ShellOptions& options)
+    {
+        unsigned int count = 5;
+
+        if (!(in >> std::ws).eof() && !(in >> count))
+        {
+            throw SpellCheckShell::ShellException{"Invalid number of suggestions for RANK"};
+        }
+
+        if (count == 0)
+        {
+            throw SpellCheckShell::ShellException{"The number of suggestions for RANK must be at least 1"};
+        }
+
+        options.rankCount = count;
+        std::getline(in >> std::ws, options.frequencyPath);
+    }
+
+
+    void readExpandOptions(std::istringstream& in, ShellOptions& options)
+    {
+        unsigned long long time = 1000;
+        std::size_t lookups = 0;
+
+        if (!(in >> std::ws).eof() && !(in >> time))
+        {
+            throw SpellCheckShell::ShellException{"Invalid time for EXPAND"};
+        }
+
+        if (!(in >> std::ws).eof() && !(in >> lookups))
+        {
+            throw SpellCheckShell::ShellException{"Invalid number of lookups for EXPAND"};
+        }
+
+        options.expand = true;
+        options.budget.maxTime = std::chrono::microseconds{time};
+        options.budget.maxLookups = lookups;
+    }
+
+
+    std::function<std::unique_ptr<SuggestionStrategy>()> makeStrategyFactory(std::istringstream& in)
+    {
+        std::string strategy;
+        in >> strategy;
+
+        if (strategy == "SYMSPELL")
+        {
+            unsigned int distance = readDistance(in, "SUGGEST SYMSPELL");
+
+            if (distance > SymSpellIndex::maxSupportedDistance)
+            {
+                throw SpellCheckShell::ShellException{
+                    "The distance for SUGGEST SYMSPELL must be between 1 and "
+                    + std::to_string(SymSpellIndex::maxSupportedDistance)};
+            }
+
+            return [distance]()
+            {
+                return std::make_unique<SymSpellIndex>(distance);
+            };
+        }
+        else if (strategy == "BKTREE")
+        {
+            unsigned int distance = readDistance(in, "SUGGEST BKTREE");
+
+            return [distance]()
+            {
+                return std::make_unique<BKTree>(distance);
+            };
+        }
+        else if (strategy == "AUTOMATON")
+        {
+            unsigned int distance = readDistance(in, "SUGGEST AUTOMATON");
+
+            if (distance > LevenshteinAutomaton::maxSupportedDistance)
+            {
+                throw SpellCheckShell::ShellException{
+                    "The distance for SUGGEST AUTOMATON must be between 1 and "
+                    + std::to_string(LevenshteinAutomaton::maxSupportedDistance)};
+            }
+
+            return [distance]()
+            {
+                return std::make_unique<LevenshteinSearch>(distance);
+            };
+        }
+        else if (strategy == "SCAN")
+        {
+            unsigned int distance = readDistance(in, "SUGGEST SCAN");
+
+            return [distance]()
+            {
+                return std::make_unique<LengthBucketScan>(distance);
+            };
+        }
+        else
+        {
+            throw SpellCheckShell::ShellException{"Invalid suggestion strategy: " + strategy};
+        }
+    }
+
+
+    ShellOptions readOptions()
+    {
+        ShellOptions options;
+
+        for (std::string line = readString(); !line.empty(); line = readString())
+        {
+            std::istringstream in{line};
+            std::string option;
+            in >> option;
+
+            if (option == "BLOOM")
+            {
+                double rate = readRate(in, option, 0.01);
+
+                options.makeFilter = [rate](const std::vector<std::uint64_t>& hashes)
+                {
+                    return std::make_unique<BloomFilter>(hashes, rate);
+                };
+            }
+            else if (option == "FUSE")
+            {
+                options.makeFilter = makeFuseFilterFactory(in);
+            }
+            else if (option == "SUGGEST")
+            {
+                options.makeStrategy = makeStrategyFactory(in);
+            }
+            else if (option == "SOUNDALIKE")
+            {
+                options.soundAlikeCount = readSoundAlikeCount(in);
+            }
+            else if (option == "CACHE")
+            {
+                options.cacheCapacity = readCacheCapacity(in);
+            }
+            else if (option == "PARALLEL")
+            {
+                readParallelOptions(in, options);
+            }
+            else if (option == "PIPELINE")
+            {
+                options.pipelineThreads = readPipelineThreads(in);
+            }
+            else if (option == "RANK")
+            {
+                readRankOptions(in, options);
+            }
+            else if (option == "PRUNE")
+            {
+                options.prune = true;
+            }
+            else if (option == "EXPAND")
+            {
+                readExpandOptions(in, options);
+            }
+            else
+            {
+                throw SpellCheckShell::ShellException{"Invalid option: " + line};
+            }
+        }
+
+        return options;
+    }
+
+
+    // Wraps the given set in a FilteredSet if the options call for a
+    // filter; otherwise, there's nothing to wrap, and nullptr is returned.
+    std::unique_ptr<FilteredSet> makeFilteredSet(Set<std::string>& wordSet, const ShellOptions& options)
+    {
+        if (options.makeFilter)
+        {
+            return std::make_unique<FilteredSet>(wordSet, options.makeFilter);
+        }
+
+        return nullptr;
+    }
+
+
+    // The optional helpers a WordChecker can be given for finding
+    // suggestions, any of which may be missing.
+    struct SuggestionHelpers
+    {
+        std::unique_ptr<SuggestionStrategy> strategy;
+        std::unique_ptr<PhoneticIndex> soundAlikes;
+        std::unique_ptr<SuggestionCache> cache;
+        std::unique_ptr<ThreadPool> pool;
+        std::string::size_type parallelLength = 0;
+        std::unique_ptr<WordFrequencies> frequencies;
+        unsigned int rankCount = 0;
+        std::string frequencyPath;
+        std::unique_ptr<DictionaryProfile> profile;
+        std::unique_ptr<WordChecker::SearchBudget> budget;
+
+
+        void applyTo(WordChecker& wordChecker) const
+        {
+            wordChecker.useSuggestionStrategy(strategy.get());
+            wordChecker.useSoundAlikes(soundAlikes.get());
+            wordChecker.useSuggestionCache(cache.get());
+            wordChecker.useThreadPool(pool.get(), parallelLength);
+            wordChecker.useRanking(frequencies.get(), rankCount);
+            wordChecker.useDictionaryProfile(profile.get());
+            wordChecker.useSearchBudget(budget.get());
+        }
+    };
+
+
+    SuggestionHelpers makeSuggestionHelpers(const ShellOptions& options)
+    {
+        SuggestionHelpers helpers;
+
+        if (options.makeStrategy)
+        {
+            helpers.strategy = options.makeStrategy();
+        }
+
+        if (options.soundAlikeCount > 0)
+        {
+            helpers.soundAlikes = std::make_unique<PhoneticIndex>(options.soundAlikeCount);
+        }
+
+        if (options.cacheCapacity > 0)
+        {
+            helpers.cache = std::make_unique<SuggestionCache>(options.cacheCapacity);
+        }
+
+        if (options.parallelThreads > 0)
+        {
+            // The calling thread is one of the threads.
+            helpers.pool = std::make_unique<ThreadPool>(options.parallelThreads - 1);
+            helpers.parallelLength = options.parallelLength;
+        }
+
+        if (options.rankCount > 0)
+        {
+            helpers.frequencies = std::make_unique<WordFrequencies>();
+            helpers.rankCount = options.rankCount;
+            helpers.frequencyPath = options.frequencyPath;
+        }
+
+        if (options.prune)
+        {
+            helpers.profile = std::make_unique<DictionaryProfile>();
+        }
+
+        if (options.expand)
+        {
+            helpers.budget = std::make_unique<WordChecker::SearchBudget>(options.budget);
+        }
+
+        return helpers;
+    }
+
+
+    // A WordListLoader lets a WordSetLoader, which loads words into a Set,
+    // hand them to something else instead, such as a SuggestionStrategy or
+    // a DictionaryProfile.
+    class WordListLoader : public Set<std::string>
+    {
+    public:
+        WordListLoader(std::function<void(const std::string&)> addWord)
+            : addWord{std::move(addWord)}, count{0}
+        {
+        }
+
+        virtual bool isImplemented() const
+        {
+            return true;
+        }
+
+        virtual void add(const std::string& element)
+        {
+            addWord(element);
+            ++count;
+        }
+
+        virtual bool contains(const std::string& element) const
+        {
+            return false;
+        }
+
+        virtual unsigned int size() const
+        {
+            return count;
+        }
+
+    private:
+        std::function<void(const std::string&)> addWord;
+        unsigned int count;
+    };
+
+
+    // Loads the words in the given file into the given strategy, if there
+    // is one, and finishes it.
+    void loadSuggestionStrategy(const std::string& wordFilePath, SuggestionStrategy* strategy)
+    {
+        if (strategy == nullptr)
+        {
+            return;
+        }
+
+        if (DoubleArrayTrieSet::isSavedFile(wordFilePath))
+        {
+            throw SpellCheckShell::ShellException{
+                "A suggestion strategy must be loaded from a word list, not a saved set"};
+        }
+
+        try
+        {
+            WordListLoader loader{[strategy](const std::string& word) { strategy->addWord(word); }};
+            WordSetLoader{}.load(wordFilePath, loader);
+            strategy->finish();
+        }
+        catch (DafsaSet::DafsaException& e)
+        {
+            throw SpellCheckShell::ShellException{e.reason()};
+        }
+    }
+
+
+    // Loads the words in the given file into the given profile, if there
+    // is one.
+    void loadDictionaryProfile(const std::string& wordFilePath, DictionaryProfile* profile)
+    {
+        if (profile == nullptr)
+        {
+            return;
+        }
+
+        if (DoubleArrayTrieSet::isSavedFile(wordFilePath))
+        {
+            throw SpellCheckShell::ShellException{
+                "A dictionary profile must be loaded from a word list, not a saved set"};
+        }
+
+        // A word set file starts with a line giving the number of words in
+        // it, which is loaded as though it were a word.  That line is
+        // skipped; every other word the Set is loaded with goes into the
+        // profile, whatever characters it has.
+        bool firstLine = true;
+
+        WordListLoader loader{
+            [profile, &firstLine](const std::string& word)
+            {
+                bool isCountLine = firstLine && !word.empty()
+                    && std::all_of(word.begin(), word.end(), [](unsigned char c) { return std::isdigit(c); });
+
+                firstLine = false;
+
+                if (!isCountLine)
+                {
+                    profile->addWord(word);
+                }
+            }};
+
+        WordSetLoader{}.load(wordFilePath, loader);
+    }
+
+
+    // Loads the word frequencies that suggestions are to be ranked by, if
+    // they are, from the frequency file given in the options, or else from
+    // wordfreq.txt in the same directory as the word set, if there is one.
+    void loadWordFrequencies(const std::string& wordFilePath, const SuggestionHelpers& helpers)
+    {
+        if (helpers.frequencies == nullptr)
+        {
+            return;
+        }
+
+        std::string path = helpers.frequencyPath;
+
+        if (path.empty())
+        {
+            std::string::size_type slash = wordFilePath.find_last_of('/');
+            path = (slash == std::string::npos ? "" : wordFilePath.substr(0, slash + 1)) + "wordfreq.txt";
+
+            if (!std::ifstream{path})
+            {
+                return;
+            }
+        }
+
+        try
+        {
+            helpers.frequencies->load(path);
+        }
+        catch (WordFrequencies::WordFrequenciesException& e)
+        {
+            throw SpellCheckShell::ShellException{e.reason()};
+        }
+    }
+
+
+    void reportRankingStatistics(const SuggestionHelpers& helpers)
+    {
+        if (helpers.frequencies == nullptr)
+        {
+            return;
+        }
+
+        std::cout << std::endl;
+        std::cout << "Ranking: up to " << helpers.rankCount << " suggestions, by ";
+
+        if (helpers.frequencies->size() > 0)
+        {
+            std::cout << "the frequencies of " << helpers.frequencies->size() << " words";
+        }
+        else
+        {
+            std::cout << "edit alone (no word frequencies were loaded)";
+        }
+
+        std::cout << std::endl;
+    }
+
+
+    void reportPruningStatistics(const SuggestionHelpers& helpers, const WordChecker& wordChecker)
+    {
+        if (helpers.profile == nullptr)
+        {
+            return;
+        }
+
+        unsigned long long words = wordChecker.screenedWordCount();
+        unsigned long long pruned = wordChecker.prunedCandidateCount();
+
+        std::cout << std::endl;
+        std::cout << "Pruning: alphabet of " << helpers.profile->alphabet().size() << " characters, "
+                  << helpers.profile->bigramCount() << " bigrams, " << pruned
+                  << " candidates pruned for " << words << " misspelled words";
+
+        if (words > 0)
+        {
+            std::cout << " (" << std::fixed << std::setprecision(1)
+                      << double(pruned) / words << " per word)";
+        }
+
+        std::cout << std::endl;
+    }
+
+
+    void reportExpansionStatistics(const SuggestionHelpers& helpers, const WordChecker& wordChecker)
+    {
+        if (helpers.budget == nullptr)
+        {
+            return;
+        }
+
+        unsigned long long completed = wordChecker.completedSearchCount();
+        unsigned long long degraded = wordChecker.degradedSearchCount();
+
+        std::cout << std::endl;
+        std::cout << "Distance 2: " << completed << " searches completed, " << degraded
+                  << " degraded";
+
+        if (completed + degraded > 0)
+        {
+            std::cout << " (" << std::fixed << std::setprecision(1)
+                      << 100.0 * degraded / (completed + degraded) << "%)";
+        }
+
+        std::cout << ", within " << helpers.budget->maxTime.count() << " usec and "
+                  << helpers.budget->maxLookups << " lookups per word (0 is no limit)" << std::endl;
+    }
+
+
+    void reportStrategyStatistics(const SuggestionStrategy* strategy)
+    {
+        if (strategy == nullptr)
+        {
+            return;
+        }
+
+        std::cout << std::endl;
+        std::cout << "Suggestion strategy: " << strategy->memoryUsage() << " bytes" << std::endl;
+    }
+
+
+    void reportSoundAlikeStatistics(const PhoneticIndex* soundAlikes)
+    {
+        if (soundAlikes == nullptr)
+        {
+            return;
+        }
+
+        std::cout << std::endl;
+        std::cout << "Sound-alikes: " << soundAlikes->wordCount() << " words under "
+                  << soundAlikes->keyCount() << " keys, " << soundAlikes->memoryUsage()
+                  << " bytes, up to " << soundAlikes->maxSuggestions() << " per word" << std::endl;
+    }
+
+
+    void reportCacheStatistics(const SuggestionCache* cache)
+    {
+        if (cache == nullptr)
+        {
+            return;
+        }
+
+        std::cout << std::endl;
+        std::cout << "Suggestion cache: " << cache->size() << " of " << cache->capacity()
+                  << " words, " << cache->hits() << " hits, " << cache->misses() << " misses"
+                  << " (" << std::fixed << std::setprecision(1) << 100.0 * cache->hitRate()
+                  << "% hit rate), " << cache->evictions() << " evictions" << std::endl;
+    }
+
+
+    void reportFilterStatistics(const Set<std::string>& wordSet)
+    {
+        const FilteredSet* filtered = dynamic_cast<const FilteredSet*>(&wordSet);
+
+        if (filtered == nullptr)
+        {
+            return;
+        }
+
+        std::cout << std::endl;
+
+        if (!filtered->isFiltering())
+        {
+            std::cout << "Filter: not built (the word set was not loaded from a word list)"
+                      << std::endl;
+            return;
+        }
+
+        unsigned long long lookups = filtered->lookupCount();
+        unsigned long long rejections = filtered->rejectionCount();
+        unsigned long long falsePositives = filtered->falsePositiveCount();
+        unsigned long long misses = rejections + falsePositives;
+
+        std::cout << "Filter: " << filtered->filter()->memoryUsage() << " bytes, "
+                  << lookups << " lookups, " << rejections << " avoided";
+
+        if (lookups > 0)
+        {
+            std::cout << " (" << std::fixed << std::setprecision(1)
+                      << 100.0 * rejections / lookups << "%)";
+        }
+
+        std::cout << ", " << falsePositives << " false positives";
+
+        if (misses > 0)
+        {
+            std::cout << " (" << std::fixed << std::setprecision(2)
+                      << 100.0 * falsePositives / misses << "% of misses)";
+        }
+
+        std::cout << std::endl;
+    }
+
+
     enum class OutputType
     {
         Display,
@@ -138,7 +1049,7 @@ namespace
 
 
     void runWithDisplay(
-        Set<std::string>& wordSet,
+        Set<std::string>& wordSet, const SuggestionHelpers& helpers, unsigned int pipelineThreads,
         const std::string& wordFilePath, const std::string& textFilePath)
     {
         SpellChecker spellChecker;
@@ -151,19 +1062,32 @@ namespace
         std::cout << std::endl;
         std::cout << "Loading word set from " << wordFilePath << " ..." << std::endl;
 
-        WordSetLoader{}.load(wordFilePath, wordSet);
+        loadWordSet(wordFilePath, wordSet);
+        loadSuggestionStrategy(wordFilePath, helpers.strategy.get());
+        loadSuggestionStrategy(wordFilePath, helpers.soundAlikes.get());
+        loadWordFrequencies(wordFilePath, helpers);
+        loadDictionaryProfile(wordFilePath, helpers.profile.get());
 
         std::cout << "Checking spelling in " << textFilePath << " ..." << std::endl;
 
         WordChecker wordChecker{wordSet};
+        helpers.applyTo(wordChecker);
         TextFileReader reader{textFilePath};
 
-        spellChecker.run(wordChecker, reader);
+        spellChecker.run(wordChecker, reader, pipelineThreads);
+
+        reportFilterStatistics(wordSet);
+        reportStrategyStatistics(helpers.strategy.get());
+        reportSoundAlikeStatistics(helpers.soundAlikes.get());
+        reportCacheStatistics(helpers.cache.get());
+        reportRankingStatistics(helpers);
+        reportPruningStatistics(helpers, wordChecker);
+        reportExpansionStatistics(helpers, wordChecker);
     }
 
 
     void runTimingTest(
-        Set<std::string>& wordSet,
+        Set<std::string>& wordSet, const SuggestionHelpers& helpers, unsigned int pipelineThreads,
         const std::string& wordFilePath, const std::string& textFilePath)
     {
         std::cout << std::endl;
@@ -177,7 +1101,11 @@ namespace
 
         {
             stopwatch.start();
-            WordSetLoader{}.load(wordFilePath, wordSet);
+            loadWordSet(wordFilePath, wordSet);
+            loadSuggestionStrategy(wordFilePath, helpers.strategy.get());
+            loadSuggestionStrategy(wordFilePath, helpers.soundAlikes.get());
+            loadWordFrequencies(wordFilePath, helpers);
+            loadDictionaryProfile(wordFilePath, helpers.profile.get());
             stopwatch.stop();
         }
 
@@ -186,11 +1114,15 @@ namespace
         std::cout << "Checking spelling of words in " << textFilePath
                   << " using search structure ..." << std::endl;
 
+        // The WordChecker outlives the timing, so that what it counted can
+        // be reported afterward; making one costs next to nothing.
+        WordChecker wordChecker{wordSet};
+        helpers.applyTo(wordChecker);
+
         {
             stopwatch.start();
-            WordChecker wordChecker{wordSet};
             TextFileReader reader{textFilePath};
-            spellChecker.run(wordChecker, reader);
+            spellChecker.run(wordChecker, reader, pipelineThreads);
             stopwatch.stop();
         }
 
@@ -215,7 +1147,7 @@ namespace
             stopwatch.start();
             WordChecker wordChecker{emptySet};
             TextFileReader reader{textFilePath};
-            spellChecker.run(wordChecker, reader);
+            spellChecker.run(wordChecker, reader, pipelineThreads);
             stopwatch.stop();
         }
 
@@ -266,6 +1198,14 @@ namespace
                      - (emptySetLoadDuration + emptySetSpellCheckDuration) << "usec";
 
         std::cout << std::endl;
+
+        reportFilterStatistics(wordSet);
+        reportStrategyStatistics(helpers.strategy.get());
+        reportSoundAlikeStatistics(helpers.soundAlikes.get());
+        reportCacheStatistics(helpers.cache.get());
+        reportRankingStatistics(helpers);
+        reportPruningStatistics(helpers, wordChecker);
+        reportExpansionStatistics(helpers, wordChecker);
     }
 }
 
@@ -289,14 +1229,21 @@ void SpellCheckShell::run()
 
     OutputType outputType = makeOutputType(readString());
 
+    ShellOptions options = readOptions();
+
+    std::unique_ptr<FilteredSet> filteredSet = makeFilteredSet(*wordSet, options);
+    Set<std::string>& searchSet = filteredSet != nullptr ? *filteredSet : *wordSet;
+
+    SuggestionHelpers helpers = makeSuggestionHelpers(options);
+
     switch (outputType)
     {
     case OutputType::Display:
-        runWithDisplay(*wordSet, wordFilePath, textFilePath);
+        runWithDisplay(searchSet, helpers, options.pipelineThreads, wordFilePath, textFilePath);
         break;
 
     case OutputType::TimeOnly:
-        runTimingTest(*wordSet, wordFilePath, textFilePath);
+        runTimingTest(searchSet, helpers, options.pipelineThreads, wordFilePath, textFilePath);
         break;
     }
 }
@@ -3,10 +3,218 @@
 // ICS 46 Spring 2017
 // Project #3: Set the Controls for the Heart of the Sun
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
 #include "SpellChecker.hpp"
 
 
 
+namespace
+{
+    // A chunk of the text, made of whole lines, along with the misspellings
+    // found in it once it's been checked.
+    struct Chunk
+    {
+        struct Misspelling
+        {
+            std::string word;
+            std::size_t line;
+            std::vector<std::string> suggestions;
+        };
+
+
+        std::vector<std::string> lines;
+
+        // Each word, alongside the index in lines of the line it's on.
+        std::vector<std::pair<std::string, std::size_t>> words;
+
+        std::vector<Misspelling> misspellings;
+
+        // Set if checking the chunk threw, so that the exception can be
+        // rethrown on the calling thread when the chunk's turn comes.
+        std::exception_ptr error;
+
+        bool checked = false;
+    };
+
+
+    // Reads words into the given chunk until it has at least the given
+    // number and the next word starts a new line, or there are no more.
+    void readChunk(TextFileReader& reader, std::size_t minimumWords, Chunk& chunk)
+    {
+        while (!reader.noMoreWords())
+        {
+            std::string line = reader.currentLine();
+
+            if (chunk.lines.empty() || chunk.lines.back() != line)
+            {
+                if (chunk.words.size() >= minimumWords)
+                {
+                    return;
+                }
+
+                chunk.lines.push_back(std::move(line));
+            }
+
+            chunk.words.emplace_back(reader.currentWord(), chunk.lines.size() - 1);
+            reader.advanceToNextWord();
+        }
+    }
+
+
+    void checkChunk(const WordChecker& wordChecker, Chunk& chunk)
+    {
+        for (const std::pair<std::string, std::size_t>& word : chunk.words)
+        {
+            if (!wordChecker.wordExists(word.first))
+            {
+                chunk.misspellings.push_back(
+                    Chunk::Misspelling{word.first, word.second, wordChecker.findSuggestions(word.first)});
+            }
+        }
+    }
+
+
+    // The worker threads and the chunks they share with the calling
+    // thread.  The workers are stopped and joined when it's destroyed, so
+    // that an exception leaving run() doesn't leave them running.
+    class CheckingPipeline
+    {
+    public:
+        CheckingPipeline(const WordChecker& wordChecker, unsigned int threadCount)
+            : wordChecker{wordChecker}, stopping{false}
+        {
+            for (unsigned int i = 0; i < threadCount; ++i)
+            {
+                workers.emplace_back([this]() { work(); });
+            }
+        }
+
+
+        ~CheckingPipeline()
+        {
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                stopping = true;
+            }
+
+            workReady.notify_all();
+
+            for (std::thread& worker : workers)
+            {
+                worker.join();
+            }
+        }
+
+
+        std::size_t inFlight()
+        {
+            std::lock_guard<std::mutex> lock{mutex};
+            return window.size();
+        }
+
+
+        // Appends the chunk to the reorder buffer and hands it to a worker.
+        void submit(Chunk&& chunk)
+        {
+            {
+                std::lock_guard<std::mutex> lock{mutex};
+                window.push_back(std::move(chunk));
+                pending.push(&window.back());
+            }
+
+            workReady.notify_one();
+        }
+
+
+        // Removes the oldest chunk from the reorder buffer into chunk, if
+        // it's been checked, returning true; otherwise, returns false, or,
+        // if wait is true, waits for it to be checked first.  There must
+        // be a chunk in the buffer when waiting.
+        bool takeOldest(Chunk& chunk, bool wait)
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+
+            if (wait)
+            {
+                chunkChecked.wait(lock, [this]() { return window.front().checked; });
+            }
+            else if (window.empty() || !window.front().checked)
+            {
+                return false;
+            }
+
+            chunk = std::move(window.front());
+            window.pop_front();
+            return true;
+        }
+
+
+    private:
+        void work()
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+
+            while (true)
+            {
+                workReady.wait(lock, [this]() { return stopping || !pending.empty(); });
+
+                if (stopping)
+                {
+                    return;
+                }
+
+                Chunk* chunk = pending.front();
+                pending.pop();
+
+                // The chunk stays where it is in the buffer while it's
+                // checked, since a deque never moves its elements when
+                // others are added or removed at either end.
+                lock.unlock();
+
+                try
+                {
+                    checkChunk(wordChecker, *chunk);
+                }
+                catch (...)
+                {
+                    chunk->error = std::current_exception();
+                }
+
+                lock.lock();
+                chunk->checked = true;
+
+                // Only the calling thread waits for a chunk to be checked.
+                chunkChecked.notify_one();
+            }
+        }
+
+
+    private:
+        const WordChecker& wordChecker;
+        std::vector<std::thread> workers;
+
+        // Guards everything below.
+        std::mutex mutex;
+        std::condition_variable workReady;
+        std::condition_variable chunkChecked;
+
+        // The reorder buffer: every chunk that has been read but not yet
+        // delivered, oldest first, along with those not yet being checked.
+        std::deque<Chunk> window;
+        std::queue<Chunk*> pending;
+
+        bool stopping;
+    };
+}
+
+
+
 void SpellChecker::run(const WordChecker& wordChecker, TextFileReader& reader)
 {
     while (!reader.noMoreWords())
@@ -23,6 +231,61 @@ void SpellChecker::run(const WordChecker& wordChecker, TextFileReader& reader)
 }
 
 
+void SpellChecker::run(const WordChecker& wordChecker, TextFileReader& reader, unsigned int threadCount)
+{
+    if (threadCount < 2)
+    {
+        run(wordChecker, reader);
+        return;
+    }
+
+    CheckingPipeline pipeline{wordChecker, threadCount};
+    const std::size_t maxInFlight = chunksPerThread * threadCount;
+
+    Chunk chunk;
+
+    auto deliver = [this, &chunk]()
+    {
+        if (chunk.error)
+        {
+            std::rethrow_exception(chunk.error);
+        }
+
+        for (const Chunk::Misspelling& misspelling : chunk.misspellings)
+        {
+            notifyMisspellingFound(misspelling.word, chunk.lines[misspelling.line], misspelling.suggestions);
+        }
+    };
+
+    // Read ahead as far as the buffer allows, delivering any chunks that
+    // are ready between reads, and only wait for the oldest chunk once the
+    // buffer is full or there's nothing left to read.
+    while (!reader.noMoreWords())
+    {
+        while (pipeline.takeOldest(chunk, false))
+        {
+            deliver();
+        }
+
+        if (pipeline.inFlight() >= maxInFlight)
+        {
+            pipeline.takeOldest(chunk, true);
+            deliver();
+        }
+
+        Chunk next;
+        readChunk(reader, chunkWords, next);
+        pipeline.submit(std::move(next));
+    }
+
+    while (pipeline.inFlight() > 0)
+    {
+        pipeline.takeOldest(chunk, true);
+        deliver();
+    }
+}
+
+
 void SpellChecker::notifyMisspellingFound(
     const std::string& word, const std::string& line,
     const std::vector<std::string>& suggestions)
@@ -33,4 +296,3 @@ void SpellChecker::notifyMisspellingFound(
             listener->misspellingFound(word, line, suggestions);
         });
 }
-
@@ -11,6 +11,7 @@
 #ifndef SPELLCHECKER_HPP
 #define SPELLCHECKER_HPP
 
+#include <cstddef>
 #include <ics46/observable/Observable.hpp>
 #include "SpellCheckerListener.hpp"
 #include "TextFileReader.hpp"
@@ -20,9 +21,33 @@
 
 class SpellChecker : public ics46::observable::Observable<SpellCheckerListener>
 {
+public:
+    // The number of words, rounded up to the end of a line, that are read
+    // into each chunk when checking on several threads.
+    static constexpr std::size_t chunkWords = 256;
+
+    // The number of chunks per thread that may have been read but not yet
+    // delivered, which bounds the memory a run on several threads takes
+    // when one slow chunk holds up the ones after it.
+    static constexpr std::size_t chunksPerThread = 4;
+
+
 public:
     void run(const WordChecker& wordChecker, TextFileReader& reader);
 
+
+    // This run() checks the words on the given number of worker threads.
+    // The calling thread reads the words, a chunk of whole lines at a
+    // time, and hands each chunk to whichever worker is free; the checked
+    // chunks wait in a reorder buffer until every chunk before them has
+    // been delivered, so observers are notified on the calling thread, of
+    // the same misspellings in the same order, as they would be by the
+    // run() above, to which this falls back when given fewer than two
+    // threads.  The WordChecker is used from every worker at once, which
+    // all of its Sets and helpers allow.
+    void run(const WordChecker& wordChecker, TextFileReader& reader, unsigned int threadCount);
+
+
 private:
     void notifyMisspellingFound(
         const std::string& word, const std::string& line,